@@ -0,0 +1,85 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-20, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/COPYRIGHT file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#include <fstream>
+#include <iostream>
+#include <vector>
+
+#include "RAJA/RAJA.hpp"
+#include "RAJA/util/KernelTuner.hpp"
+
+/*
+ *  Kernel Policy Tuning Example
+ *
+ *  A matrix transpose is run with every loop order of a family of
+ *  KernelPolicy types, untiled and with several tile sizes, on a few
+ *  problem sizes. The fastest policy for each size is written to a
+ *  header, to the file named by the first argument or to stdout.
+ *
+ *  An application includes the generated header and picks the policy
+ *  with transpose_tuning::select_policy(N) and KernelTuner::run, so the
+ *  tuning can be rerun on each machine as a build step.
+ *
+ *  RAJA features shown:
+ *    - RAJA::kernel_policy_family
+ *    - RAJA::KernelTuner
+ *    - RAJA::KernelTuningTable
+ */
+
+#if defined(RAJA_ENABLE_OPENMP)
+using outer_exec = RAJA::omp_parallel_for_exec;
+#else
+using outer_exec = RAJA::loop_exec;
+#endif
+
+using family = RAJA::kernel_policy_family<outer_exec,
+                                          RAJA::loop_exec,
+                                          RAJA::loop_orders_t<2>,
+                                          camp::idx_seq<16, 32, 64>>;
+
+using tuner = RAJA::KernelTuner<family::type>;
+
+
+int main(int argc, char **argv)
+{
+
+  std::cout << "\n\nRAJA kernel policy tuning example...\n";
+
+  RAJA::KernelTuningTable table(family::names());
+
+  for (int N : {64, 256, 1024, 2048}) {
+
+    std::vector<double> A(N * N, 1.0);
+    std::vector<double> At(N * N, 0.0);
+    const double *a = A.data();
+    double *at = At.data();
+
+    auto segments = RAJA::make_tuple(RAJA::RangeSegment(0, N),
+                                     RAJA::RangeSegment(0, N));
+
+    std::vector<double> times =
+        tuner::time(segments,
+                    [=](int c, int r) { at[r + N * c] = a[c + N * r]; });
+
+    table.add(N, times);
+    std::cout << "\n N = " << N << " : policy " << table.best(N) << ", "
+              << family::names()[table.best(N)] << "\n";
+  }
+
+  if (argc > 1) {
+    std::ofstream header(argv[1]);
+    table.write_header(header, "transpose");
+    std::cout << "\n Wrote " << argv[1] << "\n";
+  } else {
+    std::cout << "\n";
+    table.write_header(std::cout, "transpose");
+  }
+
+  std::cout << "\n DONE!...\n";
+
+  return 0;
+}
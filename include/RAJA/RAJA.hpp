@@ -82,6 +82,7 @@
 #endif
 
 #include "RAJA/index/IndexSet.hpp"
+#include "RAJA/index/ContiguousIndexSet.hpp"
 
 //
 // Strongly typed index class
@@ -107,6 +108,8 @@
 #include "RAJA/util/PermutedLayout.hpp"
 #include "RAJA/util/StaticLayout.hpp"
 #include "RAJA/util/View.hpp"
+#include "RAJA/util/PaddedLayout.hpp"
+#include "RAJA/util/ConvertingView.hpp"
 
 
 //
@@ -144,6 +147,7 @@
 //
 #include "RAJA/policy/WorkGroup.hpp"
 #include "RAJA/pattern/WorkGroup.hpp"
+#include "RAJA/pattern/halo.hpp"
 
 //
 // Reduction objects
@@ -174,10 +178,23 @@
 
 #include "RAJA/pattern/scan.hpp"
 
-#if defined(RAJA_ENABLE_RUNTIME_PLUGINS)
+#if defined(RAJA_ENABLE_RUNTIME_PLUGINS) || defined(RAJA_ENABLE_PERF_COUNTERS)
 #include "RAJA/util/PluginLinker.hpp"
 #endif
 
 #include "RAJA/pattern/sort.hpp"
 
+#include "RAJA/pattern/permutation.hpp"
+
+#include "RAJA/pattern/sparse.hpp"
+
+#include "RAJA/pattern/batched.hpp"
+
+#include "RAJA/pattern/stream.hpp"
+#include "RAJA/util/FileReader.hpp"
+
+#include "RAJA/pattern/graph.hpp"
+
+#include "RAJA/pattern/taskgraph.hpp"
+
 #endif  // closing endif for header file include guard
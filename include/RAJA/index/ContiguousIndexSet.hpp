@@ -0,0 +1,281 @@
+/*!
+ ******************************************************************************
+ *
+ * \file
+ *
+ * \brief   RAJA header file defining an index set that stores its segments
+ *          by value in contiguous arrays.
+ *
+ ******************************************************************************
+ */
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-20, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/COPYRIGHT file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#ifndef RAJA_ContiguousIndexSet_HPP
+#define RAJA_ContiguousIndexSet_HPP
+
+#include "RAJA/config.hpp"
+
+#include <memory>
+#include <type_traits>
+
+#include "RAJA/index/IndexSet.hpp"
+#include "RAJA/index/ListSegment.hpp"
+#include "RAJA/index/RangeSegment.hpp"
+
+#include "RAJA/internal/Iterators.hpp"
+#include "RAJA/internal/RAJAVec.hpp"
+
+#include "RAJA/util/Span.hpp"
+#include "RAJA/util/types.hpp"
+
+namespace RAJA
+{
+
+/*!
+ ******************************************************************************
+ *
+ * \brief  Index set that keeps range, range-stride and list segments by
+ *         value in contiguous arrays.
+ *
+ * Range and range-stride segments are stored in one array per type, and
+ * the indices of all list segments are copied into a single index pool
+ * with an offset per list. Adding a segment does not allocate once the
+ * arrays have grown, and clear() keeps their capacity, so an index set
+ * that is rebuilt every cycle stops allocating after the first one.
+ *
+ * The index set can be used with the same ExecPolicy types as
+ * TypedIndexSet. Range segments are passed to the segment execution
+ * policy as TypedRangeSegment and TypedRangeStrideSegment, list segments
+ * as a RAJA::Span over the index pool. The pool is allocated with
+ * IndexAllocator, which must provide memory the segment execution policy
+ * can access; the default allocates host memory.
+ *
+ *     RAJA::ContiguousIndexSet iset;
+ *     iset.reserve(num_segments, num_list_indices);
+ *
+ *     for (int cycle = 0; ...) {
+ *       iset.clear();
+ *       iset.push_back(RAJA::RangeSegment(0, 100));
+ *       iset.push_back_list(indices, num_indices);
+ *
+ *       RAJA::forall<RAJA::ExecPolicy<RAJA::seq_segit, RAJA::loop_exec>>(
+ *           iset, [=](RAJA::Index_type i) { ... });
+ *     }
+ *
+ ******************************************************************************
+ */
+template <typename T, typename IndexAllocator = std::allocator<T>>
+class TypedContiguousIndexSet
+{
+public:
+  using value_type = T;
+
+  using range_segment_type = TypedRangeSegment<T>;
+  using range_stride_segment_type = TypedRangeStrideSegment<T>;
+  using list_segment_type = Span<T const*, Index_type>;
+
+  //! ids stored per segment to identify the array holding it
+  enum SegmentType : Index_type { RANGE = 0, RANGE_STRIDE = 1, LIST = 2 };
+
+  using iterator = Iterators::numeric_iterator<Index_type>;
+
+  //! Construct empty index set
+  TypedContiguousIndexSet() : m_len(0) { m_list_offsets.push_back(0); }
+
+  //! Construct index set holding copies of the segments of iset
+  template <typename... SegmentTypes>
+  explicit TypedContiguousIndexSet(TypedIndexSet<SegmentTypes...> const& iset)
+      : TypedContiguousIndexSet()
+  {
+    append(iset);
+  }
+
+  ///
+  /// Grow storage to hold num_segments segments and num_list_indices list
+  /// segment indices without reallocating.
+  ///
+  void reserve(size_t num_segments, size_t num_list_indices = 0)
+  {
+    m_segment_types.reserve(num_segments);
+    m_segment_offsets.reserve(num_segments);
+    m_segment_icounts.reserve(num_segments);
+    m_list_pool.reserve(num_list_indices);
+  }
+
+  //! Remove all segments, keeping the allocated storage for reuse.
+  void clear()
+  {
+    m_segment_types.clear();
+    m_segment_offsets.clear();
+    m_segment_icounts.clear();
+    m_ranges.clear();
+    m_range_strides.clear();
+    m_list_offsets.clear();
+    m_list_offsets.push_back(0);
+    m_list_pool.clear();
+    m_len = 0;
+  }
+
+  //! Add copy of range segment to back end of index set.
+  void push_back(range_segment_type const& seg)
+  {
+    m_ranges.push_back(seg);
+    push_segment(RANGE, m_ranges.size() - 1, seg.size());
+  }
+
+  //! Add copy of range-stride segment to back end of index set.
+  void push_back(range_stride_segment_type const& seg)
+  {
+    m_range_strides.push_back(seg);
+    push_segment(RANGE_STRIDE, m_range_strides.size() - 1, seg.size());
+  }
+
+  ///
+  /// Add list segment holding a copy of the given indices to back end of
+  /// index set. The indices are read on the host.
+  ///
+  void push_back_list(T const* values, Index_type length)
+  {
+    for (Index_type i = 0; i < length; ++i) {
+      m_list_pool.push_back(values[i]);
+    }
+    m_list_offsets.push_back(static_cast<Index_type>(m_list_pool.size()));
+    push_segment(LIST, m_list_offsets.size() - 2, length);
+  }
+
+  //! Add copy of list segment to back end of index set.
+  void push_back(TypedListSegment<T> const& seg)
+  {
+    push_back_list(seg.begin(), seg.size());
+  }
+
+  //! Append copies of all segments of iset, in order.
+  template <typename... SegmentTypes>
+  void append(TypedIndexSet<SegmentTypes...> const& iset)
+  {
+    for (size_t segid = 0; segid < iset.getNumSegments(); ++segid) {
+      iset.segmentCall(segid, PushBack{}, *this);
+    }
+  }
+
+  //! Return total length -- sum of lengths of all segments
+  size_t getLength() const { return static_cast<size_t>(m_len); }
+
+  //! Return total number of segments in index set.
+  size_t getNumSegments() const { return m_segment_types.size(); }
+
+  //! Return the icount of the first index of segment segid.
+  Index_type getStartingIcount(int segid) const
+  {
+    return m_segment_icounts[segid];
+  }
+
+  //! Return the type of segment segid.
+  SegmentType getSegmentType(size_t segid) const
+  {
+    return static_cast<SegmentType>(m_segment_types[segid]);
+  }
+
+  //! Return number of list segment indices held in the index pool.
+  size_t getNumListIndices() const { return m_list_pool.size(); }
+
+  ///
+  /// Calls the operator "body" with the segment stored at segid.
+  ///
+  /// This requires that "body" be templated, as the segment will be passed
+  /// in as a properly typed object.
+  ///
+  /// The "args..." are passed-thru to the body as arguments AFTER the segment.
+  ///
+  template <typename BODY, typename... ARGS>
+  void segmentCall(size_t segid, BODY&& body, ARGS&&... args) const
+  {
+    const Index_type offset = m_segment_offsets[segid];
+    switch (m_segment_types[segid]) {
+      case RANGE:
+        body(m_ranges[offset], std::forward<ARGS>(args)...);
+        break;
+      case RANGE_STRIDE:
+        body(m_range_strides[offset], std::forward<ARGS>(args)...);
+        break;
+      default:
+        body(list_segment_type(m_list_pool.data() + m_list_offsets[offset],
+                               m_list_pool.data() + m_list_offsets[offset + 1]),
+             std::forward<ARGS>(args)...);
+        break;
+    }
+  }
+
+  //! Get an iterator to the end.
+  iterator end() const { return iterator(getNumSegments()); }
+
+  //! Get an iterator to the beginning.
+  iterator begin() const { return iterator(0); }
+
+  //! Return the number of elements in the range.
+  Index_type size() const { return getNumSegments(); }
+
+private:
+  //! pushes a copy of each TypedIndexSet segment into the index set
+  struct PushBack {
+    template <typename Segment>
+    void operator()(Segment const& seg, TypedContiguousIndexSet& iset) const
+    {
+      iset.push_back(seg);
+    }
+  };
+
+  void push_segment(SegmentType type, size_t offset, Index_type length)
+  {
+    m_segment_types.push_back(type);
+    m_segment_offsets.push_back(static_cast<Index_type>(offset));
+    m_segment_icounts.push_back(m_len);
+    m_len += length;
+  }
+
+  //! Vector of segment types:    seg_index -> seg_type
+  RAJA::RAJAVec<Index_type> m_segment_types;
+
+  //! offsets into the array of each type:    seg_index -> seg_offset
+  RAJA::RAJAVec<Index_type> m_segment_offsets;
+
+  //! the icount of each segment
+  RAJA::RAJAVec<Index_type> m_segment_icounts;
+
+  //! range segments by value
+  RAJA::RAJAVec<range_segment_type> m_ranges;
+
+  //! range-stride segments by value
+  RAJA::RAJAVec<range_stride_segment_type> m_range_strides;
+
+  //! list segment i holds pool indices [m_list_offsets[i], m_list_offsets[i+1])
+  RAJA::RAJAVec<Index_type> m_list_offsets;
+
+  //! indices of all list segments
+  RAJA::RAJAVec<T, IndexAllocator> m_list_pool;
+
+  //! Total length of all segments.
+  Index_type m_len;
+};
+
+using ContiguousIndexSet = TypedContiguousIndexSet<Index_type>;
+
+namespace type_traits
+{
+
+template <typename T, typename IndexAllocator>
+struct is_index_set_class<TypedContiguousIndexSet<T, IndexAllocator>>
+    : std::true_type {
+};
+
+}  // namespace type_traits
+
+}  // namespace RAJA
+
+#endif  // closing endif for header file include guard
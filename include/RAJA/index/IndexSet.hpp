@@ -60,10 +60,28 @@ struct ExecPolicy
   using seg_exec = SEG_EXEC_POLICY_T;
 };
 
+///
+/// Segment iteration policy that ignores segment boundaries.
+///
+/// The iteration space of the index set is split into chunks of
+/// CHUNK_SIZE iterations, which are executed with CHUNK_ITER_POLICY_T
+/// in a single loop. A chunk may span several segments, each chunk runs
+/// the slices of the segments it overlaps with the segment execution
+/// policy. This keeps a parallel chunk policy in one parallel region
+/// and balances the work when segment lengths vary.
+///
+template <typename CHUNK_ITER_POLICY_T, size_t CHUNK_SIZE = 1024>
+struct flatten_segit {
+  static_assert(CHUNK_SIZE > 0, "flatten_segit chunk size must be positive");
+  using chunk_it = CHUNK_ITER_POLICY_T;
+  static constexpr size_t chunk_size = CHUNK_SIZE;
+};
+
 }  // end namespace indexset
 }  // end namespace policy
 
 using policy::indexset::ExecPolicy;
+using policy::indexset::flatten_segit;
 
 
 /*!
@@ -760,9 +778,14 @@ private:
 namespace type_traits
 {
 
+//! specialize for other index set classes usable with ExecPolicy
+template <typename T>
+struct is_index_set_class
+    : ::RAJA::type_traits::SpecializationOf<RAJA::TypedIndexSet, T> {
+};
+
 template <typename T>
-struct is_index_set
-    : ::RAJA::type_traits::SpecializationOf<RAJA::TypedIndexSet, typename std::decay<T>::type> {
+struct is_index_set : is_index_set_class<typename std::decay<T>::type> {
 };
 
 template <typename T>
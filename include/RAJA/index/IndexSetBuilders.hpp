@@ -20,10 +20,21 @@
 
 #include "RAJA/config.hpp"
 
+#include <algorithm>
+#include <atomic>
+#include <cstdint>
+#include <memory>
+#include <utility>
+#include <vector>
+
 #include "RAJA/index/IndexSet.hpp"
 #include "RAJA/index/ListSegment.hpp"
 #include "RAJA/index/RangeSegment.hpp"
 
+#include "RAJA/pattern/forall.hpp"
+#include "RAJA/pattern/scan.hpp"
+#include "RAJA/pattern/sort.hpp"
+
 #include "RAJA/util/types.hpp"
 
 #include "camp/resource.hpp"
@@ -126,6 +137,785 @@ void buildLockFreeColorIndexset(
     RAJA::Index_type* elemPermutation = nullptr,
     RAJA::Index_type* ielemPermutation = nullptr);
 
+
+namespace detail
+{
+
+//! hashed priority of domain entity i used by the parallel coloring
+RAJA_INLINE std::uint64_t colorPriority(Index_type i)
+{
+  std::uint64_t x = static_cast<std::uint64_t>(i) + 0x9e3779b97f4a7c15ull;
+  x = (x ^ (x >> 30)) * 0xbf58476d1ce4e5b9ull;
+  x = (x ^ (x >> 27)) * 0x94d049bb133111ebull;
+  return x ^ (x >> 31);
+}
+
+/*!
+ * \brief Domain entities are neighbors if they share a range entity.
+ *
+ * rangeToDomain holds the domain entities of range entity r at positions
+ * [rangeOffsets[r], rangeOffsets[r+1]).
+ */
+struct DomainAdjacency {
+  Index_type const* domainToRange;
+  Index_type const* rangeOffsets;
+  Index_type const* rangeToDomain;
+  int numRangePerDomain;
+
+  //! call func(j) for every neighbor j of i, possibly more than once
+  template <typename Func>
+  RAJA_INLINE void forEachNeighbor(Index_type i, Func&& func) const
+  {
+    for (int k = 0; k < numRangePerDomain; ++k) {
+      const Index_type r = domainToRange[i * numRangePerDomain + k];
+      for (Index_type p = rangeOffsets[r]; p < rangeOffsets[r + 1]; ++p) {
+        const Index_type j = rangeToDomain[p];
+        if (j != i) {
+          func(j);
+        }
+      }
+    }
+  }
+
+  //! true if pred(j) holds for some neighbor j of i
+  template <typename Pred>
+  RAJA_INLINE bool anyNeighbor(Index_type i, Pred&& pred) const
+  {
+    for (int k = 0; k < numRangePerDomain; ++k) {
+      const Index_type r = domainToRange[i * numRangePerDomain + k];
+      for (Index_type p = rangeOffsets[r]; p < rangeOffsets[r + 1]; ++p) {
+        const Index_type j = rangeToDomain[p];
+        if (j != i && pred(j)) {
+          return true;
+        }
+      }
+    }
+    return false;
+  }
+
+  //! smallest color not held by any neighbor of i
+  Index_type firstFreeColor(Index_type i, Index_type const* color) const
+  {
+    for (Index_type base = 0;; base += 64) {
+      std::uint64_t used = 0;
+      forEachNeighbor(i, [&](Index_type j) {
+        const Index_type c = color[j] - base;
+        if (c >= 0 && c < 64) {
+          used |= std::uint64_t(1) << c;
+        }
+      });
+      if (~used) {
+        Index_type c = 0;
+        while (used & (std::uint64_t(1) << c)) {
+          ++c;
+        }
+        return base + c;
+      }
+    }
+  }
+
+  //! true if no neighbor of i holds color c
+  bool colorIsFree(Index_type i, Index_type c, Index_type const* color) const
+  {
+    return !anyNeighbor(i, [&](Index_type j) { return color[j] == c; });
+  }
+
+  //! number of neighbors of i, counted once per shared range entity
+  RAJA_INLINE Index_type degree(Index_type i) const
+  {
+    Index_type deg = 0;
+    for (int k = 0; k < numRangePerDomain; ++k) {
+      const Index_type r = domainToRange[i * numRangePerDomain + k];
+      deg += rangeOffsets[r + 1] - rangeOffsets[r] - 1;
+    }
+    return deg;
+  }
+};
+
+/*!
+ * \brief Sort values by key and set offsets[b] to the first position of
+ *        the sorted keys holding a key >= b, for b in [0, numBuckets].
+ *
+ * Values with equal keys keep their relative order.
+ */
+template <typename EXEC_POLICY_T>
+void sortIntoBuckets(std::vector<Index_type>& keys,
+                     std::vector<Index_type>& values,
+                     Index_type numBuckets,
+                     Index_type* offsets)
+{
+  RAJA::stable_sort_pairs<EXEC_POLICY_T>(keys, values);
+
+  const Index_type len = static_cast<Index_type>(keys.size());
+  Index_type const* key = keys.data();
+
+  // each position fills the offsets of the buckets that start there
+  forall<EXEC_POLICY_T>(TypedRangeSegment<Index_type>(0, len + 1),
+                        [=](Index_type p) {
+    const Index_type first = (p == 0) ? 0 : key[p - 1] + 1;
+    const Index_type last = (p == len) ? numBuckets : key[p];
+    for (Index_type b = first; b <= last; ++b) {
+      offsets[b] = p;
+    }
+  });
+}
+
+/*!
+ * \brief Invert the domain to range map into rangeToDomain and
+ *        rangeOffsets, sorted by range entity, and return the adjacency
+ *        referring to them.
+ */
+template <typename EXEC_POLICY_T>
+DomainAdjacency makeDomainAdjacency(Index_type const* domainToRange,
+                                    int numEntity,
+                                    int numRangePerDomain,
+                                    int numEntityRange,
+                                    std::vector<Index_type>& rangeToDomain,
+                                    std::vector<Index_type>& rangeOffsets)
+{
+  const Index_type numPairs =
+      static_cast<Index_type>(numEntity) * numRangePerDomain;
+
+  std::vector<Index_type> rangeKeys(domainToRange, domainToRange + numPairs);
+  rangeToDomain.resize(numPairs);
+  rangeOffsets.resize(numEntityRange + 1);
+
+  Index_type* r2d = rangeToDomain.data();
+  forall<EXEC_POLICY_T>(TypedRangeSegment<Index_type>(0, numPairs),
+                        [=](Index_type p) { r2d[p] = p / numRangePerDomain; });
+
+  sortIntoBuckets<EXEC_POLICY_T>(rangeKeys,
+                                 rangeToDomain,
+                                 numEntityRange,
+                                 rangeOffsets.data());
+
+  return DomainAdjacency{domainToRange,
+                         rangeOffsets.data(),
+                         rangeToDomain.data(),
+                         numRangePerDomain};
+}
+
+/*!
+ * \brief Split [0, len) into numSegments range segments of nearly equal
+ *        length and append them to iset.
+ */
+RAJA_INLINE void pushEqualRangeSegments(
+    RAJA::TypedIndexSet<RAJA::RangeSegment>& iset,
+    Index_type len,
+    Index_type numSegments)
+{
+  numSegments = (numSegments < len) ? numSegments : len;
+  numSegments = (numSegments > 1) ? numSegments : 1;
+  for (Index_type s = 0; s < numSegments && len > 0; ++s) {
+    iset.push_back(RAJA::RangeSegment(len * s / numSegments,
+                                      len * (s + 1) / numSegments));
+  }
+}
+
+//! smallest and largest of the n values of coord, found in parallel chunks
+template <typename EXEC_POLICY_T>
+void coordinateBounds(double const* coord, Index_type n, double& lo, double& hi)
+{
+  const Index_type chunkLen = 4096;
+  const Index_type numChunks = (n + chunkLen - 1) / chunkLen;
+
+  std::vector<double> chunkLo(numChunks);
+  std::vector<double> chunkHi(numChunks);
+  double* clo = chunkLo.data();
+  double* chi = chunkHi.data();
+
+  forall<EXEC_POLICY_T>(TypedRangeSegment<Index_type>(0, numChunks),
+                        [=](Index_type c) {
+    const Index_type end = ((c + 1) * chunkLen < n) ? (c + 1) * chunkLen : n;
+    double l = coord[c * chunkLen];
+    double h = l;
+    for (Index_type i = c * chunkLen + 1; i < end; ++i) {
+      l = (coord[i] < l) ? coord[i] : l;
+      h = (coord[i] > h) ? coord[i] : h;
+    }
+    clo[c] = l;
+    chi[c] = h;
+  });
+
+  lo = 0.0;
+  hi = 0.0;
+  for (Index_type c = 0; c < numChunks; ++c) {
+    lo = (c == 0 || clo[c] < lo) ? clo[c] : lo;
+    hi = (c == 0 || chi[c] > hi) ? chi[c] : hi;
+  }
+}
+
+//! interleave the low bits of dims coordinates, q[0] most significant
+RAJA_INLINE std::uint64_t interleaveBits(std::uint32_t const* q,
+                                         int dims,
+                                         int bits)
+{
+  std::uint64_t key = 0;
+  for (int b = bits - 1; b >= 0; --b) {
+    for (int d = 0; d < dims; ++d) {
+      key = (key << 1) | ((q[d] >> b) & 1u);
+    }
+  }
+  return key;
+}
+
+/*!
+ * \brief Position of the point q on the Hilbert curve through the
+ *        2^bits grid in dims dimensions.
+ *
+ * Uses Skilling's transform of the coordinates to the transposed Hilbert
+ * index ("Programming the Hilbert curve", AIP Conf. Proc. 707, 2004),
+ * whose bits are then interleaved.
+ */
+RAJA_INLINE std::uint64_t hilbertKey(std::uint32_t const* q,
+                                     int dims,
+                                     int bits)
+{
+  std::uint32_t x[3] = {q[0], q[1], (dims > 2) ? q[2] : 0u};
+  const std::uint32_t top = std::uint32_t(1) << (bits - 1);
+
+  for (std::uint32_t b = top; b > 1; b >>= 1) {
+    const std::uint32_t low = b - 1;
+    for (int d = 0; d < dims; ++d) {
+      if (x[d] & b) {
+        x[0] ^= low;
+      } else {
+        const std::uint32_t t = (x[0] ^ x[d]) & low;
+        x[0] ^= t;
+        x[d] ^= t;
+      }
+    }
+  }
+
+  for (int d = 1; d < dims; ++d) {
+    x[d] ^= x[d - 1];
+  }
+  std::uint32_t t = 0;
+  for (std::uint32_t b = top; b > 1; b >>= 1) {
+    if (x[dims - 1] & b) {
+      t ^= b - 1;
+    }
+  }
+  for (int d = 0; d < dims; ++d) {
+    x[d] ^= t;
+  }
+
+  return interleaveBits(x, dims, bits);
+}
+
+}  // namespace detail
+
+/*!
+ ******************************************************************************
+ *
+ * \brief Generate a lock-free "color" index set in parallel.
+ *
+ *        Builds the same kind of index set as buildLockFreeColorIndexset,
+ *        one segment per color, where no two domain entities in a segment
+ *        share a range entity. All steps run with EXEC_POLICY_T, which must
+ *        be a host policy supported by both RAJA::forall and
+ *        RAJA::stable_sort_pairs (e.g. seq_exec, omp_parallel_for_exec,
+ *        tbb_for_exec).
+ *
+ *        Colors are found with the Jones-Plassmann algorithm: in each
+ *        round every uncolored entity whose hashed priority is highest
+ *        among its uncolored neighbors takes the smallest color free among
+ *        its neighbors. Entities are then moved from colors larger than
+ *        the average color size to smaller colors where no neighbor
+ *        conflicts, to balance the segments. Entities in each segment are
+ *        in increasing order.
+ *
+ *        The coloring itself is deterministic. With a parallel policy, the
+ *        balancing step may move different entities from run to run.
+ *
+ * \param iset reference to index set generated. Method assumes index set
+ *        is empty (no segments).
+ * \param work_res camp resource object that identifies the memory space in
+ *        which list segment index data will live (passed to list segment
+ *        ctor).
+ * \param domainToRange numRangePerDomain range entities of each domain
+ *        entity, stored contiguously.
+ * \param numEntity number of domain entities.
+ * \param numRangePerDomain number of range entities per domain entity.
+ * \param numEntityRange number of range entities.
+ * \param elemPermutation if given, receives the domain entities ordered by
+ *        segment and the index set holds range segments over it.
+ * \param ielemPermutation if given with elemPermutation, receives the
+ *        inverse permutation.
+ *
+ ******************************************************************************
+ */
+template <typename EXEC_POLICY_T>
+void buildParallelColorIndexset(
+    RAJA::TypedIndexSet<RAJA::RangeSegment, RAJA::ListSegment>& iset,
+    camp::resources::Resource& work_res,
+    RAJA::Index_type const* domainToRange,
+    int numEntity,
+    int numRangePerDomain,
+    int numEntityRange,
+    RAJA::Index_type* elemPermutation = nullptr,
+    RAJA::Index_type* ielemPermutation = nullptr)
+{
+  using segment_type = TypedRangeSegment<Index_type>;
+
+  //
+  // Invert the domain to range map, sorted by range entity.
+  //
+  std::vector<Index_type> rangeToDomain;
+  std::vector<Index_type> rangeOffsets;
+  const detail::DomainAdjacency adj =
+      detail::makeDomainAdjacency<EXEC_POLICY_T>(domainToRange,
+                                                 numEntity,
+                                                 numRangePerDomain,
+                                                 numEntityRange,
+                                                 rangeToDomain,
+                                                 rangeOffsets);
+
+  //
+  // Jones-Plassmann rounds. Colors of the previous round are read from
+  // color and this round's colors written to next, so a round never reads
+  // a color written by the same round.
+  //
+  std::vector<Index_type> colorVec(numEntity, -1);
+  std::vector<Index_type> nextVec(numEntity);
+  Index_type* color = colorVec.data();
+  Index_type* next = nextVec.data();
+
+  std::atomic<bool> uncolored(numEntity > 0);
+  std::atomic<bool>* uncolored_ptr = &uncolored;
+
+  while (uncolored.load()) {
+    uncolored.store(false);
+
+    forall<EXEC_POLICY_T>(segment_type(0, numEntity), [=](Index_type i) {
+      Index_type c = color[i];
+      if (c < 0) {
+        // uncolored neighbors with higher priority, ties broken by index
+        const std::uint64_t pi = detail::colorPriority(i);
+        const bool highest = !adj.anyNeighbor(i, [&](Index_type j) {
+          if (color[j] >= 0) {
+            return false;
+          }
+          const std::uint64_t pj = detail::colorPriority(j);
+          return pj > pi || (pj == pi && j > i);
+        });
+        if (highest) {
+          c = adj.firstFreeColor(i, color);
+        } else if (!uncolored_ptr->load(std::memory_order_relaxed)) {
+          uncolored_ptr->store(true, std::memory_order_relaxed);
+        }
+      }
+      next[i] = c;
+    });
+
+    std::swap(color, next);
+  }
+
+  //
+  // Group entities by color.
+  //
+  std::vector<Index_type> order(numEntity);
+  std::vector<Index_type> colorKeys(numEntity);
+  auto groupByColor = [&](Index_type numColors,
+                          std::vector<Index_type>& colorStart) {
+    Index_type* ord = order.data();
+    Index_type* key = colorKeys.data();
+    Index_type const* col = color;
+    forall<EXEC_POLICY_T>(segment_type(0, numEntity), [=](Index_type i) {
+      ord[i] = i;
+      key[i] = col[i];
+    });
+    colorStart.resize(numColors + 1);
+    detail::sortIntoBuckets<EXEC_POLICY_T>(colorKeys,
+                                           order,
+                                           numColors,
+                                           colorStart.data());
+  };
+
+  Index_type numColors = 0;
+  for (Index_type i = 0; i < numEntity; ++i) {
+    numColors = (color[i] + 1 > numColors) ? color[i] + 1 : numColors;
+  }
+
+  std::vector<Index_type> colorStart;
+  groupByColor(numColors, colorStart);
+
+  //
+  // Balance colors. Entities of one color are mutually independent, so
+  // all entities of a color can be moved at once; colors at or below the
+  // average size only receive entities and are never moved from.
+  //
+  if (numColors > 1) {
+    const Index_type target = (numEntity + numColors - 1) / numColors;
+
+    std::unique_ptr<std::atomic<Index_type>[]> count(
+        new std::atomic<Index_type>[numColors]);
+    for (Index_type c = 0; c < numColors; ++c) {
+      count[c].store(colorStart[c + 1] - colorStart[c]);
+    }
+    std::atomic<Index_type>* cnt = count.get();
+    Index_type const* ord = order.data();
+
+    for (Index_type c = 0; c < numColors; ++c) {
+      if (cnt[c].load() <= target) {
+        continue;
+      }
+      forall<EXEC_POLICY_T>(segment_type(colorStart[c], colorStart[c + 1]),
+                            [=](Index_type p) {
+        const Index_type i = ord[p];
+        for (Index_type t = 0; t < numColors; ++t) {
+          if (t == c || cnt[t].load(std::memory_order_relaxed) >= target ||
+              !adj.colorIsFree(i, t, color)) {
+            continue;
+          }
+          if (cnt[t].fetch_add(1) >= target) {
+            cnt[t].fetch_sub(1);
+            continue;
+          }
+          if (cnt[c].fetch_sub(1) <= target) {
+            cnt[c].fetch_add(1);
+            cnt[t].fetch_sub(1);
+            return;
+          }
+          color[i] = t;
+          return;
+        }
+      });
+    }
+
+    groupByColor(numColors, colorStart);
+  }
+
+  //
+  // Build segments, as buildLockFreeColorIndexset does.
+  //
+  Index_type const* workset = order.data();
+
+  if (elemPermutation != nullptr) {
+    Index_type* perm = elemPermutation;
+    Index_type* iperm = ielemPermutation;
+    forall<EXEC_POLICY_T>(segment_type(0, numEntity), [=](Index_type p) {
+      perm[p] = workset[p];
+      if (iperm != nullptr) {
+        iperm[workset[p]] = p;
+      }
+    });
+    for (Index_type c = 0; c < numColors; ++c) {
+      iset.push_back(RAJA::RangeSegment(colorStart[c], colorStart[c + 1]));
+    }
+  } else {
+    for (Index_type c = 0; c < numColors; ++c) {
+      const Index_type begin = colorStart[c];
+      const Index_type end = colorStart[c + 1];
+      if (workset[end - 1] - workset[begin] == end - begin - 1) {
+        iset.push_back(
+            RAJA::RangeSegment(workset[begin], workset[end - 1] + 1));
+      } else {
+        iset.push_back(
+            RAJA::ListSegment(&workset[begin], end - begin, work_res));
+      }
+    }
+  }
+}
+
+
+////////////////////////////////////////////////////////////////////////////////
+////////////////////////////////////////////////////////////////////////////////
+//
+// The following methods build "reordering" index sets.
+//
+// Reordering index sets hold range segments over a permutation of the
+// domain entities that places entities close in the mesh close in memory.
+// A loop over the index set visits entity elemPermutation[i] at position i,
+// or the entity data is renumbered with ielemPermutation and the loop
+// then runs over contiguous data. The segments are of nearly equal length
+// so that each can be given to one thread.
+//
+////////////////////////////////////////////////////////////////////////////////
+////////////////////////////////////////////////////////////////////////////////
+
+/*!
+ ******************************************************************************
+ *
+ * \brief Generate an index set of range segments over the Reverse
+ *        Cuthill-McKee ordering of the domain entities.
+ *
+ *        Domain entities are neighbors if they share a range entity, as
+ *        for the color index set builders. Each connected component is
+ *        ordered breadth first from a pseudo-peripheral entity, found by
+ *        restarting from the lowest degree entity of the last level of a
+ *        first search. The entities of a level are ordered by the position
+ *        of their earliest neighbor in the previous level, then by degree.
+ *        The ordering is reversed at the end.
+ *
+ *        Each level is built in parallel with EXEC_POLICY_T, which must be
+ *        a host policy supported by RAJA::forall, RAJA::exclusive_scan and
+ *        RAJA::stable_sort_pairs (e.g. seq_exec, omp_parallel_for_exec).
+ *        The ordering is the same for every policy.
+ *
+ * \param iset reference to index set generated. Method assumes index set
+ *        is empty (no segments).
+ * \param domainToRange numRangePerDomain range entities of each domain
+ *        entity, stored contiguously.
+ * \param numEntity number of domain entities.
+ * \param numRangePerDomain number of range entities per domain entity.
+ * \param numEntityRange number of range entities.
+ * \param numSegments number of segments, e.g. a multiple of the number of
+ *        threads.
+ * \param elemPermutation receives the domain entities in the new order.
+ * \param ielemPermutation if given, receives the inverse permutation.
+ *
+ ******************************************************************************
+ */
+template <typename EXEC_POLICY_T>
+void buildReverseCuthillMcKeeIndexset(
+    RAJA::TypedIndexSet<RAJA::RangeSegment>& iset,
+    RAJA::Index_type const* domainToRange,
+    int numEntity,
+    int numRangePerDomain,
+    int numEntityRange,
+    int numSegments,
+    RAJA::Index_type* elemPermutation,
+    RAJA::Index_type* ielemPermutation = nullptr)
+{
+  using segment_type = TypedRangeSegment<Index_type>;
+
+  std::vector<Index_type> rangeToDomain;
+  std::vector<Index_type> rangeOffsets;
+  const detail::DomainAdjacency adj =
+      detail::makeDomainAdjacency<EXEC_POLICY_T>(domainToRange,
+                                                 numEntity,
+                                                 numRangePerDomain,
+                                                 numEntityRange,
+                                                 rangeToDomain,
+                                                 rangeOffsets);
+
+  std::vector<Index_type> degreeVec(numEntity);
+  Index_type* degree = degreeVec.data();
+  forall<EXEC_POLICY_T>(segment_type(0, numEntity), [=](Index_type i) {
+    degree[i] = adj.degree(i);
+  });
+
+  Index_type maxDegree = 0;
+  for (Index_type i = 0; i < numEntity; ++i) {
+    maxDegree = (degree[i] > maxDegree) ? degree[i] : maxDegree;
+  }
+
+  // sort key of an entity reached from more than one parent, other than
+  // from its earliest one; larger than any parent and degree key
+  const Index_type dupKey = static_cast<Index_type>(numEntity) * (maxDegree + 1);
+
+  std::vector<Index_type> orderVec(numEntity);
+  std::vector<char> visitedVec(numEntity, 0);
+  Index_type* order = orderVec.data();
+  char* visited = visitedVec.data();
+
+  std::vector<Index_type> counts;
+  std::vector<Index_type> candChild;
+  std::vector<Index_type> candKey;
+
+  //
+  // Order the component of start breadth first, appending it to order at
+  // position end. Returns the position of the first entity of the last
+  // level.
+  //
+  auto orderComponent = [&](Index_type start, Index_type& end) {
+    order[end] = start;
+    visited[start] = 1;
+    Index_type levelBegin = end;
+    Index_type levelEnd = end + 1;
+
+    for (;;) {
+      // count unvisited neighbors of each entity in the level
+      const Index_type width = levelEnd - levelBegin;
+      counts.resize(width + 1);
+      Index_type* cnt = counts.data();
+      const Index_type first = levelBegin;
+      forall<EXEC_POLICY_T>(segment_type(0, width + 1), [=](Index_type q) {
+        Index_type c = 0;
+        if (q < width) {
+          adj.forEachNeighbor(order[first + q], [&](Index_type j) {
+            c += visited[j] ? 0 : 1;
+          });
+        }
+        cnt[q] = c;
+      });
+      RAJA::exclusive_scan_inplace<EXEC_POLICY_T>(counts);
+
+      const Index_type numCand = counts[width];
+      if (numCand == 0) {
+        break;
+      }
+
+      candChild.resize(numCand);
+      candKey.resize(numCand);
+      Index_type* child = candChild.data();
+      Index_type* key = candKey.data();
+      forall<EXEC_POLICY_T>(segment_type(0, width), [=](Index_type q) {
+        Index_type p = cnt[q];
+        adj.forEachNeighbor(order[first + q], [&](Index_type j) {
+          if (!visited[j]) {
+            child[p] = j;
+            key[p] = q;
+            ++p;
+          }
+        });
+      });
+
+      // group candidates by entity, each keeps the parent found first
+      RAJA::stable_sort_pairs<EXEC_POLICY_T>(candChild, candKey);
+      forall<EXEC_POLICY_T>(segment_type(0, numCand), [=](Index_type p) {
+        const Index_type j = child[p];
+        key[p] = (p > 0 && child[p - 1] == j)
+                     ? dupKey
+                     : key[p] * (maxDegree + 1) + degree[j];
+      });
+      RAJA::stable_sort_pairs<EXEC_POLICY_T>(candKey, candChild);
+
+      const Index_type numNext =
+          std::lower_bound(candKey.begin(), candKey.end(), dupKey) -
+          candKey.begin();
+      const Index_type next = levelEnd;
+      forall<EXEC_POLICY_T>(segment_type(0, numNext), [=](Index_type p) {
+        order[next + p] = child[p];
+        visited[child[p]] = 1;
+      });
+
+      levelBegin = levelEnd;
+      levelEnd += numNext;
+    }
+
+    end = levelEnd;
+    return levelBegin;
+  };
+
+  Index_type end = 0;
+  Index_type cursor = 0;
+  while (end < numEntity) {
+    while (visited[cursor]) {
+      ++cursor;
+    }
+
+    const Index_type componentBegin = end;
+    const Index_type lastLevel = orderComponent(cursor, end);
+
+    Index_type start = order[lastLevel];
+    for (Index_type p = lastLevel + 1; p < end; ++p) {
+      start = (degree[order[p]] < degree[start]) ? order[p] : start;
+    }
+
+    if (start != cursor) {
+      forall<EXEC_POLICY_T>(segment_type(componentBegin, end),
+                            [=](Index_type p) { visited[order[p]] = 0; });
+      end = componentBegin;
+      orderComponent(start, end);
+    }
+  }
+
+  Index_type* perm = elemPermutation;
+  Index_type* iperm = ielemPermutation;
+  const Index_type last = numEntity - 1;
+  forall<EXEC_POLICY_T>(segment_type(0, numEntity), [=](Index_type p) {
+    perm[p] = order[last - p];
+    if (iperm != nullptr) {
+      iperm[perm[p]] = p;
+    }
+  });
+
+  detail::pushEqualRangeSegments(iset, numEntity, numSegments);
+}
+
+//! Space-filling curves used by buildSpaceFillingCurveIndexset.
+enum class SpaceFillingCurve { morton, hilbert };
+
+/*!
+ ******************************************************************************
+ *
+ * \brief Generate an index set of range segments over the order in which
+ *        a space-filling curve visits the domain entities.
+ *
+ *        Entity coordinates are scaled to a 2^21 grid per dimension in 3D,
+ *        2^31 in 2D, over their bounding box, and entities are sorted by
+ *        their position on the Morton (Z-order) or Hilbert curve through
+ *        the grid. Entities in the same grid cell keep their relative
+ *        order. The Hilbert order only moves between neighboring cells and
+ *        usually gives better locality; the Morton order is cheaper.
+ *
+ *        All steps run with EXEC_POLICY_T, which must be a host policy
+ *        supported by RAJA::forall and RAJA::stable_sort_pairs.
+ *
+ * \param iset reference to index set generated. Method assumes index set
+ *        is empty (no segments).
+ * \param curve space-filling curve to order by.
+ * \param x, y, z coordinates of each domain entity, e.g. zone centers.
+ *        z is nullptr for 2D meshes.
+ * \param numEntity number of domain entities.
+ * \param numSegments number of segments, e.g. a multiple of the number of
+ *        threads.
+ * \param elemPermutation receives the domain entities in the new order.
+ * \param ielemPermutation if given, receives the inverse permutation.
+ *
+ ******************************************************************************
+ */
+template <typename EXEC_POLICY_T>
+void buildSpaceFillingCurveIndexset(
+    RAJA::TypedIndexSet<RAJA::RangeSegment>& iset,
+    SpaceFillingCurve curve,
+    double const* x,
+    double const* y,
+    double const* z,
+    int numEntity,
+    int numSegments,
+    RAJA::Index_type* elemPermutation,
+    RAJA::Index_type* ielemPermutation = nullptr)
+{
+  using segment_type = TypedRangeSegment<Index_type>;
+
+  const int dims = (z != nullptr) ? 3 : 2;
+  const int bits = (dims == 3) ? 21 : 31;
+  const double cells = static_cast<double>(std::uint64_t(1) << bits);
+  const std::uint32_t maxCell = (std::uint32_t(1) << bits) - 1;
+
+  double const* coord[3] = {x, y, z};
+  double lo[3] = {0.0, 0.0, 0.0};
+  double scale[3] = {0.0, 0.0, 0.0};
+  for (int d = 0; d < dims; ++d) {
+    double hi;
+    detail::coordinateBounds<EXEC_POLICY_T>(coord[d], numEntity, lo[d], hi);
+    scale[d] = (hi > lo[d]) ? cells / (hi - lo[d]) : 0.0;
+  }
+
+  std::vector<std::uint64_t> keyVec(numEntity);
+  std::vector<Index_type> orderVec(numEntity);
+  std::uint64_t* key = keyVec.data();
+  Index_type* order = orderVec.data();
+  const bool hilbert = (curve == SpaceFillingCurve::hilbert);
+
+  forall<EXEC_POLICY_T>(segment_type(0, numEntity), [=](Index_type i) {
+    std::uint32_t q[3] = {0u, 0u, 0u};
+    for (int d = 0; d < dims; ++d) {
+      const double c = (coord[d][i] - lo[d]) * scale[d];
+      q[d] = (c < maxCell) ? static_cast<std::uint32_t>(c) : maxCell;
+    }
+    key[i] = hilbert ? detail::hilbertKey(q, dims, bits)
+                     : detail::interleaveBits(q, dims, bits);
+    order[i] = i;
+  });
+
+  RAJA::stable_sort_pairs<EXEC_POLICY_T>(keyVec, orderVec);
+
+  Index_type* perm = elemPermutation;
+  Index_type* iperm = ielemPermutation;
+  forall<EXEC_POLICY_T>(segment_type(0, numEntity), [=](Index_type p) {
+    perm[p] = order[p];
+    if (iperm != nullptr) {
+      iperm[order[p]] = p;
+    }
+  });
+
+  detail::pushEqualRangeSegments(iset, numEntity, numSegments);
+}
+
 }  // namespace RAJA
 
 #endif  // closing endif for header file include guard
@@ -0,0 +1,230 @@
+/*!
+ ******************************************************************************
+ *
+ * \file
+ *
+ * \brief   Header file defining a per-thread scratch memory arena used for
+ *          RAJA local arrays on the host.
+ *
+ ******************************************************************************
+ */
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-20, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/COPYRIGHT file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#ifndef RAJA_ScratchArena_CPU_HPP
+#define RAJA_ScratchArena_CPU_HPP
+
+#include "RAJA/config.hpp"
+
+#include <cstddef>
+#include <new>
+#include <type_traits>
+#include <vector>
+
+#include "RAJA/internal/MemUtils_CPU.hpp"
+
+namespace RAJA
+{
+
+namespace detail
+{
+
+/*!
+ * \brief Per-thread stack of aligned scratch memory.
+ *
+ * Allocations are released in reverse order. Each one starts on a
+ * boundary of at least DATA_ALIGN bytes and a cache line. When an
+ * allocation does not fit, a new block is added; once everything is
+ * released the next allocation merges the blocks into one block of their
+ * total size, so after the first use a thread's arena is a single block
+ * that is reused. Releasing never allocates. Each thread allocates and
+ * first touches its own blocks.
+ */
+class ScratchArenaCPU
+{
+public:
+  static constexpr size_t alignment = (DATA_ALIGN > 64) ? DATA_ALIGN : 64;
+
+  //! smallest block allocated
+  static constexpr size_t min_block_bytes = 64 * 1024;
+
+  static constexpr size_t padded_bytes(size_t bytes)
+  {
+    return (bytes + alignment - 1) / alignment * alignment;
+  }
+
+  //! arena of the calling thread
+  static ScratchArenaCPU& get()
+  {
+    static thread_local ScratchArenaCPU arena;
+    return arena;
+  }
+
+  ScratchArenaCPU() = default;
+  ScratchArenaCPU(ScratchArenaCPU const&) = delete;
+  ScratchArenaCPU& operator=(ScratchArenaCPU const&) = delete;
+
+  ~ScratchArenaCPU()
+  {
+    for (Block& b : m_blocks) {
+      free_aligned(b.data);
+    }
+  }
+
+  //! allocate bytes on top of the stack
+  void* allocate(size_t bytes)
+  {
+    bytes = padded_bytes(bytes);
+
+    if (m_blocks.size() > 1 && m_current == 0 && m_blocks[0].used == 0) {
+      coalesce();
+    }
+    if (m_blocks.empty()) {
+      addBlock(bytes);
+    }
+    while (m_blocks[m_current].capacity - m_blocks[m_current].used < bytes) {
+      // blocks after the current one are empty
+      const size_t next = m_current + 1;
+      if (next == m_blocks.size()) {
+        addBlock(bytes);
+      } else if (m_blocks[next].capacity < bytes) {
+        Block b = makeBlock(bytes);
+        free_aligned(m_blocks[next].data);
+        m_blocks[next] = b;
+      }
+      m_current = next;
+    }
+
+    Block& b = m_blocks[m_current];
+    void* ptr = b.data + b.used;
+    b.used += bytes;
+    return ptr;
+  }
+
+  //! release the top allocation of the stack, made with the same bytes
+  void deallocate(size_t bytes)
+  {
+    m_blocks[m_current].used -= padded_bytes(bytes);
+
+    while (m_current > 0 && m_blocks[m_current].used == 0) {
+      --m_current;
+    }
+  }
+
+  //! total bytes held by the arena
+  size_t capacity() const
+  {
+    size_t total = 0;
+    for (Block const& b : m_blocks) {
+      total += b.capacity;
+    }
+    return total;
+  }
+
+private:
+  struct Block {
+    char* data;
+    size_t capacity;
+    size_t used;
+  };
+
+  //! returns a block with null data if the allocation fails
+  static Block tryMakeBlock(size_t bytes)
+  {
+    bytes = (bytes < min_block_bytes) ? min_block_bytes : padded_bytes(bytes);
+    return Block{allocate_aligned_type<char>(alignment, bytes), bytes, 0};
+  }
+
+  static Block makeBlock(size_t bytes)
+  {
+    Block b = tryMakeBlock(bytes);
+    if (b.data == nullptr) {
+      throw std::bad_alloc();
+    }
+    return b;
+  }
+
+  void addBlock(size_t bytes)
+  {
+    // grow geometrically so deep nesting adds few blocks
+    const size_t last = m_blocks.empty() ? 0 : m_blocks.back().capacity;
+    m_blocks.reserve(m_blocks.size() + 1);
+    m_blocks.push_back(makeBlock((bytes > 2 * last) ? bytes : 2 * last));
+  }
+
+  // merge the empty blocks into one, keeps them if that cannot be allocated
+  void coalesce()
+  {
+    size_t total = 0;
+    for (Block const& b : m_blocks) {
+      total += b.capacity;
+    }
+    Block merged = tryMakeBlock(total);
+    if (merged.data == nullptr) {
+      return;
+    }
+    for (Block& b : m_blocks) {
+      free_aligned(b.data);
+    }
+    m_blocks.clear();
+    m_blocks.push_back(merged);
+  }
+
+  std::vector<Block> m_blocks;
+  size_t m_current = 0;
+};
+
+/*!
+ * \brief Array of num T allocated on the calling thread's scratch arena,
+ *        released when the object goes out of scope.
+ */
+template <typename T>
+class ScratchArrayCPU
+{
+public:
+  explicit ScratchArrayCPU(size_t num)
+      : m_arena(ScratchArenaCPU::get()),
+        m_num(num),
+        m_data(static_cast<T*>(m_arena.allocate(num * sizeof(T))))
+  {
+    for (size_t i = 0; i < m_num; ++i) {
+      new (&m_data[i]) T;
+    }
+  }
+
+  ScratchArrayCPU(ScratchArrayCPU const&) = delete;
+  ScratchArrayCPU& operator=(ScratchArrayCPU const&) = delete;
+
+  ~ScratchArrayCPU()
+  {
+    destroy(std::is_trivially_destructible<T>{});
+    m_arena.deallocate(m_num * sizeof(T));
+  }
+
+  T* data() const { return m_data; }
+
+private:
+  void destroy(std::true_type) {}
+
+  void destroy(std::false_type)
+  {
+    for (size_t i = m_num; i > 0; --i) {
+      m_data[i - 1].~T();
+    }
+  }
+
+  ScratchArenaCPU& m_arena;
+  size_t m_num;
+  T* m_data;
+};
+
+}  // namespace detail
+
+}  // namespace RAJA
+
+#endif  // closing endif for header file include guard
@@ -3,6 +3,7 @@
 
 #include "RAJA/util/Operators.hpp"
 #include "RAJA/internal/foldl.hpp"
+#include "RAJA/index/IndexSet.hpp"
 #include "RAJA/pattern/kernel/internal.hpp"
 
 namespace RAJA
@@ -86,6 +87,15 @@ struct get_platform<RAJA::ExecPolicy<SEG, EXEC>>
     : public get_platform_from_list<SEG, EXEC> {
 };
 
+/*!
+ * Specialization to define the platform for a flattened segment iteration
+ * policy, which is that of its chunk iteration policy.
+ */
+template <typename CHUNK, size_t CHUNK_SIZE>
+struct get_platform<RAJA::policy::indexset::flatten_segit<CHUNK, CHUNK_SIZE>>
+    : public get_platform<CHUNK> {
+};
+
 
 template <typename T>
 struct get_statement_platform {
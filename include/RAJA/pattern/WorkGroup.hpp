@@ -278,7 +278,9 @@ private:
   using workrunner_type = detail::WorkRunner<
       exec_policy, order_policy, Allocator, index_type, Args...>;
   using storage_type = detail::WorkStorage<
-      storage_policy, Allocator, typename workrunner_type::vtable_type>;
+      typename detail::workrunner_storage_policy<
+          storage_policy, workrunner_type>::type,
+      Allocator, typename workrunner_type::vtable_type>;
 
   friend workgroup_type;
   friend worksite_type;
@@ -1041,6 +1041,296 @@ private:
   }
 };
 
+/*!
+ * Storage for work groups whose holder types are all known at compile time.
+ * Loops are stored by value in a contiguous array of VariantWorkStructs.
+ */
+template < typename ALLOCATOR_T, typename Vtable_T, typename ... holders >
+class WorkStorage<RAJA::variant_array_of_objects<holders...>,
+                  ALLOCATOR_T,
+                  Vtable_T>
+{
+  using allocator_traits_type = std::allocator_traits<ALLOCATOR_T>;
+  using propagate_on_container_copy_assignment =
+      typename allocator_traits_type::propagate_on_container_copy_assignment;
+  using propagate_on_container_move_assignment =
+      typename allocator_traits_type::propagate_on_container_move_assignment;
+  using propagate_on_container_swap            =
+      typename allocator_traits_type::propagate_on_container_swap;
+  static_assert(std::is_same<typename allocator_traits_type::value_type, char>::value,
+      "WorkStorage expects an allocator for 'char's.");
+public:
+  using storage_policy = RAJA::variant_array_of_objects<holders...>;
+  using vtable_type = Vtable_T;
+
+  using value_type = VariantWorkStruct<camp::list<holders...>, vtable_type>;
+
+  template < typename holder >
+  using true_value_type = value_type;
+
+  using allocator_type = ALLOCATOR_T;
+  using size_type = std::size_t;
+  using difference_type = std::ptrdiff_t;
+  using reference = value_type&;
+  using const_reference = const value_type&;
+  using pointer = value_type*;
+  using const_pointer = const value_type*;
+
+  // iterator base class for accessing stored WorkStructs outside of the container
+  struct const_iterator_base
+  {
+    using value_type = const typename WorkStorage::value_type;
+    using pointer = typename WorkStorage::const_pointer;
+    using reference = typename WorkStorage::const_reference;
+    using difference_type = typename WorkStorage::difference_type;
+    using iterator_category = std::random_access_iterator_tag;
+
+    const_iterator_base(const_pointer value_ptr)
+      : m_value_ptr(value_ptr)
+    { }
+
+    RAJA_HOST_DEVICE reference operator*() const
+    {
+      return *m_value_ptr;
+    }
+
+    RAJA_HOST_DEVICE const_iterator_base& operator+=(difference_type n)
+    {
+      m_value_ptr += n;
+      return *this;
+    }
+
+    RAJA_HOST_DEVICE friend inline difference_type operator-(
+        const_iterator_base const& lhs_iter, const_iterator_base const& rhs_iter)
+    {
+      return lhs_iter.m_value_ptr - rhs_iter.m_value_ptr;
+    }
+
+    RAJA_HOST_DEVICE friend inline bool operator==(
+        const_iterator_base const& lhs_iter, const_iterator_base const& rhs_iter)
+    {
+      return lhs_iter.m_value_ptr == rhs_iter.m_value_ptr;
+    }
+
+    RAJA_HOST_DEVICE friend inline bool operator<(
+        const_iterator_base const& lhs_iter, const_iterator_base const& rhs_iter)
+    {
+      return lhs_iter.m_value_ptr < rhs_iter.m_value_ptr;
+    }
+
+  private:
+    const_pointer m_value_ptr;
+  };
+
+  using const_iterator = random_access_iterator<const_iterator_base>;
+
+
+  explicit WorkStorage(allocator_type const& aloc)
+    : m_aloc(aloc)
+  { }
+
+  WorkStorage(WorkStorage const&) = delete;
+  WorkStorage& operator=(WorkStorage const&) = delete;
+
+  WorkStorage(WorkStorage&& rhs)
+    : m_aloc(std::move(rhs.m_aloc))
+    , m_array_begin(rhs.m_array_begin)
+    , m_array_end(rhs.m_array_end)
+    , m_array_cap(rhs.m_array_cap)
+  {
+    rhs.m_array_begin = nullptr;
+    rhs.m_array_end   = nullptr;
+    rhs.m_array_cap   = nullptr;
+  }
+
+  WorkStorage& operator=(WorkStorage&& rhs)
+  {
+    if (this != &rhs) {
+      move_assign_private(std::move(rhs), propagate_on_container_move_assignment{});
+    }
+    return *this;
+  }
+
+  // reserve space for at least num_loops or loop_storage_size bytes of loops
+  void reserve(size_type num_loops, size_type loop_storage_size)
+  {
+    array_reserve(std::max(num_loops,
+        (loop_storage_size + sizeof(value_type) - 1) / sizeof(value_type)));
+  }
+
+  // number of loops stored
+  size_type size() const
+  {
+    return m_array_end - m_array_begin;
+  }
+
+  const_iterator begin() const
+  {
+    return const_iterator(m_array_begin);
+  }
+
+  const_iterator end() const
+  {
+    return const_iterator(m_array_end);
+  }
+
+  // amount of storage in bytes used to store loops
+  size_type storage_size() const
+  {
+    return size() * sizeof(value_type);
+  }
+
+  template < typename holder, typename ... holder_ctor_args >
+  void emplace(const vtable_type* vtable, holder_ctor_args&&... ctor_args)
+  {
+    if (m_array_end == m_array_cap) {
+      array_reserve(std::max(size() + 1, 2*capacity()));
+    }
+    value_type::template construct<holder>(
+        m_array_end, vtable, std::forward<holder_ctor_args>(ctor_args)...);
+    ++m_array_end;
+  }
+
+  // destroy stored loop bodies and deallocates all storage
+  void clear()
+  {
+    array_clear();
+    if (m_array_begin != nullptr) {
+      allocator_traits_type::deallocate(m_aloc,
+          reinterpret_cast<char*>(m_array_begin), capacity() * sizeof(value_type));
+      m_array_begin = nullptr;
+      m_array_end   = nullptr;
+      m_array_cap   = nullptr;
+    }
+  }
+
+  ~WorkStorage()
+  {
+    clear();
+  }
+
+private:
+  allocator_type m_aloc;
+  pointer m_array_begin = nullptr;
+  pointer m_array_end   = nullptr;
+  pointer m_array_cap   = nullptr;
+
+  // move assignment if allocator propagates on move assignment
+  void move_assign_private(WorkStorage&& rhs, std::true_type)
+  {
+    clear();
+
+    m_aloc        = std::move(rhs.m_aloc);
+    m_array_begin = rhs.m_array_begin;
+    m_array_end   = rhs.m_array_end  ;
+    m_array_cap   = rhs.m_array_cap  ;
+
+    rhs.m_array_begin = nullptr;
+    rhs.m_array_end   = nullptr;
+    rhs.m_array_cap   = nullptr;
+  }
+
+  // move assignment if allocator does not propagate on move assignment
+  void move_assign_private(WorkStorage&& rhs, std::false_type)
+  {
+    clear();
+    if (m_aloc == rhs.m_aloc) {
+
+      m_array_begin = rhs.m_array_begin;
+      m_array_end   = rhs.m_array_end  ;
+      m_array_cap   = rhs.m_array_cap  ;
+
+      rhs.m_array_begin = nullptr;
+      rhs.m_array_end   = nullptr;
+      rhs.m_array_cap   = nullptr;
+    } else {
+
+      array_reserve(rhs.size());
+
+      for (pointer other = rhs.m_array_begin; other != rhs.m_array_end; ++other) {
+        value_type::move_destroy(m_array_end, other);
+        ++m_array_end;
+      }
+      rhs.m_array_end = rhs.m_array_begin;
+      rhs.clear();
+    }
+  }
+
+  // number of loops that fit in the allocated storage
+  size_type capacity() const
+  {
+    return m_array_cap - m_array_begin;
+  }
+
+  // allocate storage for at least num_loops loops
+  void array_reserve(size_type num_loops)
+  {
+    if (num_loops > capacity()) {
+
+      pointer new_array_begin = reinterpret_cast<pointer>(
+          allocator_traits_type::allocate(m_aloc, num_loops * sizeof(value_type)));
+      pointer new_array_end   = new_array_begin + size();
+      pointer new_array_cap   = new_array_begin + num_loops;
+
+      for (size_type i = 0; i < size(); ++i) {
+        value_type::move_destroy(new_array_begin + i, m_array_begin + i);
+      }
+
+      if (m_array_begin != nullptr) {
+        allocator_traits_type::deallocate(m_aloc,
+            reinterpret_cast<char*>(m_array_begin), capacity() * sizeof(value_type));
+      }
+
+      m_array_begin = new_array_begin;
+      m_array_end   = new_array_end  ;
+      m_array_cap   = new_array_cap  ;
+    }
+  }
+
+  // destroy the loops in storage (does not deallocate loop storage)
+  void array_clear()
+  {
+    while (m_array_end != m_array_begin) {
+      --m_array_end;
+      value_type::destroy(m_array_end);
+    }
+  }
+};
+
+
+/*!
+ * Converts the workgroup_loops in a variant_array_of_objects storage policy
+ * into the holder types used by the WorkRunner, other storage policies are
+ * unchanged.
+ */
+template < typename STORAGE_POLICY_T, typename WorkRunner_T >
+struct workrunner_storage_policy
+{
+  using type = STORAGE_POLICY_T;
+};
+
+template < typename Loop, typename WorkRunner_T >
+struct workrunner_holder
+{
+  using type = Loop;
+};
+
+template < typename SEGMENT_T, typename LOOP_BODY_T, typename WorkRunner_T >
+struct workrunner_holder<RAJA::workgroup_loop<SEGMENT_T, LOOP_BODY_T>,
+                         WorkRunner_T>
+{
+  using type = typename WorkRunner_T::template holder_type<SEGMENT_T,
+                                                           LOOP_BODY_T>;
+};
+
+template < typename ... Loops, typename WorkRunner_T >
+struct workrunner_storage_policy<RAJA::variant_array_of_objects<Loops...>,
+                                 WorkRunner_T>
+{
+  using type = RAJA::variant_array_of_objects<
+      typename workrunner_holder<Loops, WorkRunner_T>::type...>;
+};
+
 }  // namespace detail
 
 }  // namespace RAJA
@@ -22,6 +22,11 @@
 
 #include <utility>
 #include <cstddef>
+#include <type_traits>
+
+#include "camp/camp.hpp"
+
+#include "RAJA/util/macros.hpp"
 
 #include "RAJA/pattern/WorkGroup/Vtable.hpp"
 
@@ -108,6 +113,139 @@ struct WorkStruct<size, Vtable<VtableID, CallArgs...>>
   typename std::aligned_storage<size, alignof(std::max_align_t)>::type obj;
 };
 
+
+/*!
+ * Struct used to store one of a set of holder types known at compile time.
+ * The holder is stored in a union with an index into holder_list, and the
+ * index is used to select the holder type without going through a vtable.
+ */
+template < typename holder_list, typename Vtable_T >
+struct VariantWorkStruct;
+
+template < typename T, typename ... holders >
+struct variant_holder_index;
+
+template < typename T >
+struct variant_holder_index<T>
+    : std::integral_constant<size_t, 0> {
+};
+
+template < typename T, typename ... holders >
+struct variant_holder_index<T, T, holders...>
+    : std::integral_constant<size_t, 0> {
+};
+
+template < typename T, typename holder, typename ... holders >
+struct variant_holder_index<T, holder, holders...>
+    : std::integral_constant<size_t,
+                             1 + variant_holder_index<T, holders...>::value> {
+};
+
+template < typename ... holders, typename VtableID, typename ... CallArgs >
+struct VariantWorkStruct<camp::list<holders...>, Vtable<VtableID, CallArgs...>>
+{
+  using vtable_type = Vtable<VtableID, CallArgs...>;
+  using holder_list = camp::list<holders...>;
+
+  // construct a VariantWorkStruct with a value of type holder from the args,
+  // the vtable is not used
+  template < typename holder, typename ... holder_ctor_args >
+  static RAJA_INLINE
+  void construct(void* ptr, const vtable_type*, holder_ctor_args&&... ctor_args)
+  {
+    static constexpr size_t holder_index =
+        variant_holder_index<holder, holders...>::value;
+    static_assert(holder_index < sizeof...(holders),
+        "holder must be one of the loop types of variant_array_of_objects");
+
+    VariantWorkStruct* value_ptr = static_cast<VariantWorkStruct*>(ptr);
+
+    value_ptr->index = holder_index;
+    new(&value_ptr->obj) holder(std::forward<holder_ctor_args>(ctor_args)...);
+  }
+
+  // move construct in dst from the value in src and destroy the value in src
+  static RAJA_INLINE
+  void move_destroy(VariantWorkStruct* value_dst,
+                    VariantWorkStruct* value_src)
+  {
+    value_dst->index = value_src->index;
+    move_destroy_index(value_src->index, &value_dst->obj, &value_src->obj,
+                       holder_list{});
+  }
+
+  // destroy the value ptr
+  static RAJA_INLINE
+  void destroy(VariantWorkStruct* value_ptr)
+  {
+    destroy_index(value_ptr->index, &value_ptr->obj, holder_list{});
+  }
+
+  // call the call operator of the value ptr with args
+  RAJA_SUPPRESS_HD_WARN
+  static RAJA_HOST_DEVICE RAJA_INLINE
+  void call(const VariantWorkStruct* value_ptr, CallArgs... args)
+  {
+    call_index(value_ptr->index, &value_ptr->obj, holder_list{},
+               std::forward<CallArgs>(args)...);
+  }
+
+  size_t index;
+  typename std::aligned_union<0, holders...>::type obj;
+
+private:
+  static RAJA_INLINE
+  void move_destroy_index(size_t, void*, void*, camp::list<>)
+  { }
+
+  template < typename holder, typename ... rest >
+  static RAJA_INLINE
+  void move_destroy_index(size_t index, void* dst, void* src,
+                          camp::list<holder, rest...>)
+  {
+    if (index == 0) {
+      holder* src_as_holder = static_cast<holder*>(src);
+      new(dst) holder(std::move(*src_as_holder));
+      (*src_as_holder).~holder();
+    } else {
+      move_destroy_index(index-1, dst, src, camp::list<rest...>{});
+    }
+  }
+
+  static RAJA_INLINE
+  void destroy_index(size_t, void*, camp::list<>)
+  { }
+
+  template < typename holder, typename ... rest >
+  static RAJA_INLINE
+  void destroy_index(size_t index, void* obj, camp::list<holder, rest...>)
+  {
+    if (index == 0) {
+      (*static_cast<holder*>(obj)).~holder();
+    } else {
+      destroy_index(index-1, obj, camp::list<rest...>{});
+    }
+  }
+
+  static RAJA_HOST_DEVICE RAJA_INLINE
+  void call_index(size_t, const void*, camp::list<>, CallArgs...)
+  { }
+
+  RAJA_SUPPRESS_HD_WARN
+  template < typename holder, typename ... rest >
+  static RAJA_HOST_DEVICE RAJA_INLINE
+  void call_index(size_t index, const void* obj, camp::list<holder, rest...>,
+                  CallArgs... args)
+  {
+    if (index == 0) {
+      (*static_cast<const holder*>(obj))(std::forward<CallArgs>(args)...);
+    } else {
+      call_index(index-1, obj, camp::list<rest...>{},
+                 std::forward<CallArgs>(args)...);
+    }
+  }
+};
+
 }  // namespace detail
 
 }  // namespace RAJA
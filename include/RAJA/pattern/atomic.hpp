@@ -22,7 +22,9 @@
 
 #include "RAJA/policy/atomic_auto.hpp"
 #include "RAJA/policy/atomic_builtin.hpp"
+#include "RAJA/policy/atomic_combining.hpp"
 
+#include "RAJA/util/ValLoc.hpp"
 #include "RAJA/util/macros.hpp"
 
 namespace RAJA
@@ -60,6 +62,11 @@ namespace RAJA
  *
  *   seq_atomic        -- Non-atomic, does an unprotected (raw) operation
  *
+ *   combining_atomic<AtomicPolicy>
+ *                     -- Host only, buffers updates per thread and per
+ *                        socket and applies them with AtomicPolicy when
+ *                        they are evicted or at atomicFlush
+ *
  *
  * Current supported data types include:
  *
@@ -71,10 +78,16 @@ namespace RAJA
  *
  *   32-bit and 64-bit floating point types:  float and double
  *
+ *   ValLoc<T, IndexType> pairs, host policies only, for atomicMinLoc and
+ *   atomicMaxLoc:
+ *      -Lock free via a 64-bit or 128-bit (cmpxchg16b) CAS for pairs that
+ *      pack in 8 or 16 bytes, a striped lock otherwise
+ *
  *
  * The implementation code lives in:
  * RAJA/policy/atomic_auto.hpp     -- for auto_atomic
  * RAJA/policy/atomic_builtin.hpp  -- for builtin_atomic
+ * RAJA/policy/atomic_combining.hpp -- for combining_atomic
  * RAJA/policy/XXX/atomic.hpp      -- for omp_atomic, cuda_atomic, etc.
  *
  */
@@ -274,6 +287,106 @@ RAJA_INLINE RAJA_HOST_DEVICE T atomicCAS(T volatile *acc, T compare, T value)
   return RAJA::atomicCAS(Policy{}, acc, compare, value);
 }
 
+
+/*!
+ * @brief Atomic minimum with location, host policies only
+ *
+ * Replaces *acc with value if value.val is smaller than acc->val, or if
+ * they are equal and value.loc is smaller than acc->loc.
+ * @param acc Pointer to location of result pair
+ * @param value Pair to compare to *acc
+ * @return Returns pair at acc immediately before this operation completed
+ */
+template <typename Policy, typename T, typename IndexType>
+RAJA_INLINE ValLoc<T, IndexType> atomicMinLoc(
+    ValLoc<T, IndexType> volatile *acc,
+    ValLoc<T, IndexType> value)
+{
+  return RAJA::atomicMinLoc(Policy{}, acc, value);
+}
+
+/*!
+ * @brief Atomic minimum with location, host policies only
+ * @param acc Pointer to location of result pair
+ * @param value Value to compare to acc->val
+ * @param loc Location of value
+ * @return Returns pair at acc immediately before this operation completed
+ */
+template <typename Policy,
+          typename T,
+          typename IndexType,
+          typename ValueType,
+          typename LocType>
+RAJA_INLINE ValLoc<T, IndexType> atomicMinLoc(
+    ValLoc<T, IndexType> volatile *acc,
+    ValueType value,
+    LocType loc)
+{
+  return RAJA::atomicMinLoc(Policy{},
+                            acc,
+                            ValLoc<T, IndexType>(value, loc));
+}
+
+
+/*!
+ * @brief Atomic maximum with location, host policies only
+ *
+ * Replaces *acc with value if value.val is larger than acc->val, or if
+ * they are equal and value.loc is smaller than acc->loc.
+ * @param acc Pointer to location of result pair
+ * @param value Pair to compare to *acc
+ * @return Returns pair at acc immediately before this operation completed
+ */
+template <typename Policy, typename T, typename IndexType>
+RAJA_INLINE ValLoc<T, IndexType> atomicMaxLoc(
+    ValLoc<T, IndexType> volatile *acc,
+    ValLoc<T, IndexType> value)
+{
+  return RAJA::atomicMaxLoc(Policy{}, acc, value);
+}
+
+/*!
+ * @brief Atomic maximum with location, host policies only
+ * @param acc Pointer to location of result pair
+ * @param value Value to compare to acc->val
+ * @param loc Location of value
+ * @return Returns pair at acc immediately before this operation completed
+ */
+template <typename Policy,
+          typename T,
+          typename IndexType,
+          typename ValueType,
+          typename LocType>
+RAJA_INLINE ValLoc<T, IndexType> atomicMaxLoc(
+    ValLoc<T, IndexType> volatile *acc,
+    ValueType value,
+    LocType loc)
+{
+  return RAJA::atomicMaxLoc(Policy{},
+                            acc,
+                            ValLoc<T, IndexType>(value, loc));
+}
+
+/*!
+ * @brief Policies that do not buffer updates have nothing to flush
+ */
+template <typename Policy>
+RAJA_INLINE void atomicFlush(Policy)
+{
+}
+
+/*!
+ * @brief Atomic flush
+ *
+ * Applies the updates buffered by Policy to their targets, see
+ * combining_atomic. Does nothing for other policies.
+ */
+template <typename Policy>
+RAJA_INLINE void atomicFlush()
+{
+  atomicFlush(Policy{});
+}
+
 /*!
  * \brief Atomic wrapper object
  *
@@ -502,6 +615,88 @@ private:
 };
 
 
+/*!
+ * \brief Atomic wrapper object for a value and location pair
+ *
+ * min and max use atomicMinLoc and atomicMaxLoc, so it is host only. As in
+ * the general AtomicRef, load and store are not atomic.
+ */
+template <typename T, typename IndexType, typename Policy>
+class AtomicRef<ValLoc<T, IndexType>, Policy>
+{
+public:
+  using value_type = ValLoc<T, IndexType>;
+
+  RAJA_INLINE
+  constexpr explicit AtomicRef(value_type *value_ptr)
+      : m_value_ptr(value_ptr){};
+
+  RAJA_INLINE
+  constexpr AtomicRef(AtomicRef const&c)
+      : m_value_ptr(c.m_value_ptr){};
+
+  AtomicRef& operator=(AtomicRef const&) = delete;
+
+  RAJA_INLINE
+  value_type volatile * getPointer() const { return m_value_ptr; }
+
+  RAJA_INLINE
+  void store(value_type rhs) const
+  {
+    m_value_ptr->val = rhs.val;
+    m_value_ptr->loc = rhs.loc;
+  }
+
+  RAJA_INLINE
+  value_type operator=(value_type rhs) const
+  {
+    store(rhs);
+    return rhs;
+  }
+
+  RAJA_INLINE
+  value_type load() const
+  {
+    return value_type(m_value_ptr->val, m_value_ptr->loc);
+  }
+
+  RAJA_INLINE
+  operator value_type() const
+  {
+    return load();
+  }
+
+  RAJA_INLINE
+  value_type fetch_min(value_type rhs) const
+  {
+    return RAJA::atomicMinLoc<Policy>(m_value_ptr, rhs);
+  }
+
+  RAJA_INLINE
+  value_type min(value_type rhs) const
+  {
+    value_type old = RAJA::atomicMinLoc<Policy>(m_value_ptr, rhs);
+    return detail::minloc_better(rhs, old) ? rhs : old;
+  }
+
+  RAJA_INLINE
+  value_type fetch_max(value_type rhs) const
+  {
+    return RAJA::atomicMaxLoc<Policy>(m_value_ptr, rhs);
+  }
+
+  RAJA_INLINE
+  value_type max(value_type rhs) const
+  {
+    value_type old = RAJA::atomicMaxLoc<Policy>(m_value_ptr, rhs);
+    return detail::maxloc_better(rhs, old) ? rhs : old;
+  }
+
+private:
+  value_type volatile *m_value_ptr;
+};
+
+
 }  // namespace RAJA
 
 #endif
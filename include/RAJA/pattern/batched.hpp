@@ -0,0 +1,347 @@
+/*!
+ ******************************************************************************
+ *
+ * \file
+ *
+ * \brief   Header file providing RAJA batched small matrix operations:
+ *          matrix multiply, LU factorization and solve, and inverse of
+ *          many matrices of the same compile-time size.
+ *
+ *             \code
+ *             auto layout = RAJA::batched::make_layout<3, 3>(num_zones);
+ *             RAJA::batched::MatrixView<double> A(a, layout);
+ *             RAJA::batched::gemm<exec_policy, 3, 3, 3>(num_zones, A, B, C);
+ *             \endcode
+ *
+ ******************************************************************************
+ */
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-20, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/COPYRIGHT file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#ifndef RAJA_pattern_batched_HPP
+#define RAJA_pattern_batched_HPP
+
+#include "RAJA/config.hpp"
+
+#include <array>
+#include <cmath>
+#include <type_traits>
+#include <utility>
+
+#include "camp/camp.hpp"
+
+#include "RAJA/index/RangeSegment.hpp"
+
+#include "RAJA/pattern/forall.hpp"
+
+#include "RAJA/util/Layout.hpp"
+#include "RAJA/util/PermutedLayout.hpp"
+#include "RAJA/util/View.hpp"
+#include "RAJA/util/macros.hpp"
+#include "RAJA/util/types.hpp"
+
+namespace RAJA
+{
+
+namespace batched
+{
+
+//! Layout of a batch of matrices, indexed (entry, row, column).
+using MatrixLayout = Layout<3, Index_type, 0>;
+
+//! Layout of a batch of pivot vectors, indexed (entry, row).
+using PivotLayout = Layout<2, Index_type, 0>;
+
+//! View of a batch of matrices, indexed (entry, row, column).
+template <typename T>
+using MatrixView = View<T, MatrixLayout>;
+
+//! View of a batch of pivot vectors, indexed (entry, row).
+using PivotView = View<Index_type, PivotLayout>;
+
+/*!
+ * \brief Interleaved layout of batch M x N matrices.
+ *
+ * Entry (e, r, c) of all matrices in the batch are stored next to each
+ * other, so the batch index has stride one and consecutive SIMD lanes
+ * work on consecutive matrices.
+ */
+template <camp::idx_t M, camp::idx_t N>
+MatrixLayout make_layout(Index_type batch)
+{
+  return make_permuted_layout(std::array<Index_type, 3>{{batch, M, N}},
+                              std::array<camp::idx_t, 3>{{1, 2, 0}});
+}
+
+//! Interleaved layout of batch pivot vectors of length N.
+template <camp::idx_t N>
+PivotLayout make_pivot_layout(Index_type batch)
+{
+  return make_permuted_layout(std::array<Index_type, 2>{{batch, N}},
+                              std::array<camp::idx_t, 2>{{1, 0}});
+}
+
+namespace detail
+{
+
+//! number of batch entries handled by one iteration of the exec policy
+constexpr Index_type chunk_size = 64;
+
+/*!
+ * \brief Run body(e) for every batch entry e. Chunks of chunk_size
+ *        entries are distributed with ExecPolicy, and the entries of a
+ *        chunk are run in a SIMD loop.
+ */
+template <typename ExecPolicy, typename Body>
+RAJA_INLINE void forall_entries(Index_type batch, Body const& body)
+{
+  const Index_type num_chunks = (batch + chunk_size - 1) / chunk_size;
+
+  RAJA::forall<ExecPolicy>(TypedRangeSegment<Index_type>(0, num_chunks),
+                           [=](Index_type chunk) {
+    const Index_type begin = chunk * chunk_size;
+    const Index_type end =
+        (begin + chunk_size < batch) ? begin + chunk_size : batch;
+
+    RAJA_SIMD
+    for (Index_type e = begin; e < end; ++e) {
+      body(e);
+    }
+  });
+}
+
+template <typename View3>
+using value_t = camp::decay<decltype(std::declval<View3>()(0, 0, 0))>;
+
+//! LU factorization with partial pivoting of matrix e of A, in place
+template <camp::idx_t N, typename ViewA, typename ViewP>
+RAJA_INLINE void lu_factor_entry(ViewA const& A, ViewP const& piv, Index_type e)
+{
+  using std::abs;
+
+  for (camp::idx_t k = 0; k < N; ++k) {
+    camp::idx_t p = k;
+    auto pmax = abs(A(e, k, k));
+    for (camp::idx_t r = k + 1; r < N; ++r) {
+      const auto v = abs(A(e, r, k));
+      if (v > pmax) {
+        pmax = v;
+        p = r;
+      }
+    }
+    piv(e, k) = p;
+
+    if (p != k) {
+      for (camp::idx_t c = 0; c < N; ++c) {
+        const auto t = A(e, k, c);
+        A(e, k, c) = A(e, p, c);
+        A(e, p, c) = t;
+      }
+    }
+
+    const auto inv = value_t<ViewA>(1) / A(e, k, k);
+    for (camp::idx_t r = k + 1; r < N; ++r) {
+      const auto l = A(e, r, k) * inv;
+      A(e, r, k) = l;
+      for (camp::idx_t c = k + 1; c < N; ++c) {
+        A(e, r, c) -= l * A(e, k, c);
+      }
+    }
+  }
+}
+
+//! solve with the LU factors of matrix e, in place on the NRHS columns of B
+template <camp::idx_t N,
+          camp::idx_t NRHS,
+          typename ViewLU,
+          typename ViewP,
+          typename ViewB>
+RAJA_INLINE void lu_solve_entry(ViewLU const& LU,
+                                ViewP const& piv,
+                                ViewB const& B,
+                                Index_type e)
+{
+  for (camp::idx_t k = 0; k < N; ++k) {
+    const camp::idx_t p = piv(e, k);
+    if (p != k) {
+      for (camp::idx_t c = 0; c < NRHS; ++c) {
+        const auto t = B(e, k, c);
+        B(e, k, c) = B(e, p, c);
+        B(e, p, c) = t;
+      }
+    }
+  }
+
+  for (camp::idx_t i = 0; i < N; ++i) {
+    for (camp::idx_t r = i + 1; r < N; ++r) {
+      const auto l = LU(e, r, i);
+      for (camp::idx_t c = 0; c < NRHS; ++c) {
+        B(e, r, c) -= l * B(e, i, c);
+      }
+    }
+  }
+
+  for (camp::idx_t i = N - 1; i >= 0; --i) {
+    const auto inv = value_t<ViewLU>(1) / LU(e, i, i);
+    for (camp::idx_t c = 0; c < NRHS; ++c) {
+      auto s = B(e, i, c);
+      for (camp::idx_t j = i + 1; j < N; ++j) {
+        s -= LU(e, i, j) * B(e, j, c);
+      }
+      B(e, i, c) = s * inv;
+    }
+  }
+}
+
+//! pivot vector of a single matrix, indexed like a PivotView
+template <camp::idx_t N>
+struct LocalPivot {
+  Index_type& operator()(Index_type, camp::idx_t k) const { return p[k]; }
+
+  mutable Index_type p[N];
+};
+
+}  // namespace detail
+
+/*!
+ ******************************************************************************
+ *
+ * \brief  C = alpha * A * B + beta * C for batch matrices, where A is
+ *         M x K, B is K x N and C is M x N.
+ *
+ * The matrices are accessed through views indexed (entry, row, column),
+ * typically MatrixViews with the layouts from make_layout. C must not
+ * overlap A or B, and is not read if beta is zero. Chunks of the batch
+ * are distributed with ExecPolicy, which must be a host policy, and the
+ * matrices of a chunk are computed in a SIMD loop.
+ *
+ ******************************************************************************
+ */
+template <typename ExecPolicy,
+          camp::idx_t M,
+          camp::idx_t N,
+          camp::idx_t K,
+          typename ViewA,
+          typename ViewB,
+          typename ViewC,
+          typename T>
+void gemm(Index_type batch,
+          ViewA const& A,
+          ViewB const& B,
+          ViewC const& C,
+          T alpha,
+          T beta)
+{
+  detail::forall_entries<ExecPolicy>(batch, [=](Index_type e) {
+    for (camp::idx_t i = 0; i < M; ++i) {
+      for (camp::idx_t j = 0; j < N; ++j) {
+        auto sum = A(e, i, 0) * B(e, 0, j);
+        for (camp::idx_t k = 1; k < K; ++k) {
+          sum += A(e, i, k) * B(e, k, j);
+        }
+        C(e, i, j) = (beta == T(0)) ? alpha * sum
+                                    : alpha * sum + beta * C(e, i, j);
+      }
+    }
+  });
+}
+
+/*!
+ * \brief  C = A * B for batch matrices, where A is M x K, B is K x N and
+ *         C is M x N. C is not read.
+ */
+template <typename ExecPolicy,
+          camp::idx_t M,
+          camp::idx_t N,
+          camp::idx_t K,
+          typename ViewA,
+          typename ViewB,
+          typename ViewC>
+void gemm(Index_type batch, ViewA const& A, ViewB const& B, ViewC const& C)
+{
+  detail::forall_entries<ExecPolicy>(batch, [=](Index_type e) {
+    for (camp::idx_t i = 0; i < M; ++i) {
+      for (camp::idx_t j = 0; j < N; ++j) {
+        auto sum = A(e, i, 0) * B(e, 0, j);
+        for (camp::idx_t k = 1; k < K; ++k) {
+          sum += A(e, i, k) * B(e, k, j);
+        }
+        C(e, i, j) = sum;
+      }
+    }
+  });
+}
+
+/*!
+ ******************************************************************************
+ *
+ * \brief  LU factorization with partial pivoting of batch N x N matrices,
+ *         in place.
+ *
+ * Matrix e of A is overwritten with its factors L and U, the unit diagonal
+ * of L not stored. Row k was swapped with row piv(e, k) at step k.
+ * Singular matrices are not detected and give infinite or NaN factors.
+ *
+ ******************************************************************************
+ */
+template <typename ExecPolicy, camp::idx_t N, typename ViewA, typename ViewP>
+void lu_factor(Index_type batch, ViewA const& A, ViewP const& piv)
+{
+  detail::forall_entries<ExecPolicy>(batch, [=](Index_type e) {
+    detail::lu_factor_entry<N>(A, piv, e);
+  });
+}
+
+/*!
+ * \brief  Solve A X = B for batch N x N matrices A given their factors
+ *         from lu_factor, overwriting the N x NRHS right hand sides B with
+ *         the solutions X.
+ */
+template <typename ExecPolicy,
+          camp::idx_t N,
+          camp::idx_t NRHS,
+          typename ViewLU,
+          typename ViewP,
+          typename ViewB>
+void lu_solve(Index_type batch,
+              ViewLU const& LU,
+              ViewP const& piv,
+              ViewB const& B)
+{
+  detail::forall_entries<ExecPolicy>(batch, [=](Index_type e) {
+    detail::lu_solve_entry<N, NRHS>(LU, piv, B, e);
+  });
+}
+
+/*!
+ * \brief  Inverses of batch N x N matrices. A is overwritten with its LU
+ *         factors and Ainv, which must not overlap A, with the inverses.
+ */
+template <typename ExecPolicy, camp::idx_t N, typename ViewA, typename ViewInv>
+void inverse(Index_type batch, ViewA const& A, ViewInv const& Ainv)
+{
+  using T = detail::value_t<ViewInv>;
+
+  detail::forall_entries<ExecPolicy>(batch, [=](Index_type e) {
+    detail::LocalPivot<N> piv;
+    detail::lu_factor_entry<N>(A, piv, e);
+
+    for (camp::idx_t i = 0; i < N; ++i) {
+      for (camp::idx_t j = 0; j < N; ++j) {
+        Ainv(e, i, j) = (i == j) ? T(1) : T(0);
+      }
+    }
+    detail::lu_solve_entry<N, N>(A, piv, Ainv, e);
+  });
+}
+
+}  // namespace batched
+
+}  // namespace RAJA
+
+#endif  // closing endif for header file include guard
@@ -0,0 +1,342 @@
+/*!
+ ******************************************************************************
+ *
+ * \file
+ *
+ * \brief  Accumulator and base reducer type for sum reductions whose result
+ *         does not depend on the order values are added in.
+ *
+ ******************************************************************************
+ */
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-20, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/COPYRIGHT file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#ifndef RAJA_PATTERN_DETAIL_REDUCE_REPRODUCIBLE_HPP
+#define RAJA_PATTERN_DETAIL_REDUCE_REPRODUCIBLE_HPP
+
+#include "RAJA/config.hpp"
+
+#include <cmath>
+#include <cstdint>
+#include <cstring>
+#include <type_traits>
+
+#include "RAJA/pattern/detail/reduce.hpp"
+
+#include "RAJA/util/macros.hpp"
+
+#define RAJA_DECLARE_REPRODUCIBLE_SUM_REDUCER(POL, COMBINER)             \
+  template <typename T>                                                  \
+  class ReduceSum<POL, T>                                                \
+      : public reduce::detail::BaseReduceSumReproducible<T, COMBINER>    \
+  {                                                                      \
+  public:                                                                \
+    using Base = reduce::detail::BaseReduceSumReproducible<T, COMBINER>; \
+    using Base::Base;                                                    \
+  };
+
+namespace RAJA
+{
+
+namespace reduce
+{
+
+namespace detail
+{
+
+/*!
+ ******************************************************************************
+ *
+ * \brief  Fixed size accumulator holding the exact sum of floating point
+ *         values.
+ *
+ * Every finite double is an integer multiple of 2^-1074 below 2^1024, so
+ * the accumulator keeps the sum as a fixed point number of 32 bit digits
+ * covering that whole range. Each digit is stored in a 64 bit word, which
+ * lets an added value be split over at most three digits without
+ * propagating carries; carries are only resolved after many additions.
+ *
+ * Integer addition is associative, so the held sum, and the value that
+ * value() rounds it to, are the same no matter how the additions were
+ * ordered or grouped, and combining two accumulators only adds their
+ * digits. Infinities and NaNs are summed separately and take precedence.
+ *
+ ******************************************************************************
+ */
+template <typename T>
+class ReproducibleAccumulator
+{
+  static_assert(std::is_floating_point<T>::value &&
+                    sizeof(T) <= sizeof(double),
+                "Reproducible sums are only supported for float and double");
+
+  static constexpr int digit_bits = 32;
+  static constexpr std::int64_t digit_mask = (std::int64_t(1) << 32) - 1;
+
+  //! digits needed for 2^-1074 to 2^1024, plus room for carries
+  static constexpr int num_digits = 68;
+
+  //! additions allowed before a digit could overflow its 64 bit word
+  static constexpr std::int64_t max_pending = std::int64_t(1) << 30;
+
+public:
+  ReproducibleAccumulator() : m_pending(0), m_special(0.0)
+  {
+    for (int i = 0; i < num_digits; ++i) {
+      m_digits[i] = 0;
+    }
+  }
+
+  explicit ReproducibleAccumulator(T val) : ReproducibleAccumulator()
+  {
+    add(val);
+  }
+
+  //! add val to the held sum
+  RAJA_INLINE void add(T val)
+  {
+    const double x = static_cast<double>(val);
+    std::uint64_t bits;
+    std::memcpy(&bits, &x, sizeof(bits));
+
+    int exponent = static_cast<int>((bits >> 52) & 0x7ff);
+    std::uint64_t mantissa = bits & ((std::uint64_t(1) << 52) - 1);
+
+    if (exponent == 0x7ff) {
+      m_special += x;
+      return;
+    }
+    if (exponent == 0) {
+      if (mantissa == 0) {
+        return;
+      }
+      exponent = 1;
+    } else {
+      mantissa |= std::uint64_t(1) << 52;
+    }
+
+    // x == +-mantissa * 2^(pos - 1074)
+    const int pos = exponent - 1;
+    const int digit = pos / digit_bits;
+    const int shift = pos % digit_bits;
+
+    const std::int64_t lo =
+        static_cast<std::int64_t>((mantissa << shift) & digit_mask);
+    const std::int64_t mid = static_cast<std::int64_t>(
+        (mantissa >> (digit_bits - shift)) & digit_mask);
+    const std::int64_t hi =
+        shift ? static_cast<std::int64_t>(mantissa >> (64 - shift)) : 0;
+
+    if (bits >> 63) {
+      m_digits[digit] -= lo;
+      m_digits[digit + 1] -= mid;
+      m_digits[digit + 2] -= hi;
+    } else {
+      m_digits[digit] += lo;
+      m_digits[digit + 1] += mid;
+      m_digits[digit + 2] += hi;
+    }
+
+    if (++m_pending == max_pending) {
+      normalize();
+    }
+  }
+
+  //! add the sum held by other to the held sum
+  void combine(ReproducibleAccumulator const& other)
+  {
+    for (int i = 0; i < num_digits; ++i) {
+      m_digits[i] += other.m_digits[i];
+    }
+    m_special += other.m_special;
+
+    m_pending += other.m_pending + 1;
+    if (m_pending >= max_pending) {
+      normalize();
+    }
+  }
+
+  //! the held sum rounded to T
+  T value() const
+  {
+    if (m_special != 0.0 || m_special != m_special) {
+      return static_cast<T>(m_special);
+    }
+
+    ReproducibleAccumulator acc(*this);
+    acc.normalize();
+
+    const bool negative = acc.m_digits[num_digits - 1] < 0;
+    if (negative) {
+      for (int i = 0; i < num_digits; ++i) {
+        acc.m_digits[i] = -acc.m_digits[i];
+      }
+      acc.normalize();
+    }
+
+    int top = num_digits - 1;
+    while (top > 0 && acc.m_digits[top] == 0) {
+      --top;
+    }
+
+    double result;
+    if (top == 0) {
+      // below 2^-1042, exactly representable
+      result = std::ldexp(static_cast<double>(acc.m_digits[0]), -1074);
+    } else {
+      // take the leading 64 bits with a sticky bit for the rest, so the
+      // conversion to double is the only rounding
+      std::uint64_t lead =
+          (static_cast<std::uint64_t>(acc.m_digits[top]) << digit_bits) |
+          static_cast<std::uint64_t>(acc.m_digits[top - 1]);
+      int lz = 0;
+      while (!(lead & (std::uint64_t(1) << 63))) {
+        lead <<= 1;
+        ++lz;
+      }
+
+      bool sticky = false;
+      if (top >= 2) {
+        const std::uint64_t next =
+            static_cast<std::uint64_t>(acc.m_digits[top - 2]);
+        if (lz > 0) {
+          lead |= next >> (digit_bits - lz);
+        }
+        sticky = (next & ((std::uint64_t(1) << (digit_bits - lz)) - 1)) != 0;
+        for (int i = 0; i < top - 2 && !sticky; ++i) {
+          sticky = acc.m_digits[i] != 0;
+        }
+      }
+      if (sticky) {
+        lead |= 1;
+      }
+
+      result = std::ldexp(static_cast<double>(lead),
+                          digit_bits * (top - 1) - lz - 1074);
+    }
+
+    return static_cast<T>(negative ? -result : result);
+  }
+
+  bool operator==(ReproducibleAccumulator const& other) const
+  {
+    for (int i = 0; i < num_digits; ++i) {
+      if (m_digits[i] != other.m_digits[i]) {
+        return false;
+      }
+    }
+    return std::memcmp(&m_special, &other.m_special, sizeof(double)) == 0;
+  }
+
+  bool operator!=(ReproducibleAccumulator const& other) const
+  {
+    return !(*this == other);
+  }
+
+private:
+  //! propagate carries so every digit but the last is in [0, 2^32)
+  void normalize()
+  {
+    for (int i = 0; i < num_digits - 1; ++i) {
+      const std::int64_t carry = m_digits[i] >> digit_bits;
+      m_digits[i] &= digit_mask;
+      m_digits[i + 1] += carry;
+    }
+    m_pending = 0;
+  }
+
+  std::int64_t m_digits[num_digits];
+
+  //! number of additions since the last normalize
+  std::int64_t m_pending;
+
+  //! sum of infinite and NaN values
+  double m_special;
+};
+
+/*!
+ * \brief  Sum operator over ReproducibleAccumulator objects, used in place
+ *         of RAJA::reduce::sum by reproducible reducers.
+ */
+template <typename Accumulator>
+struct sum_reproducible {
+  struct operator_type {
+    Accumulator operator()(Accumulator lhs, Accumulator const& rhs) const
+    {
+      lhs.combine(rhs);
+      return lhs;
+    }
+  };
+
+  static Accumulator identity() { return Accumulator(); }
+
+  RAJA_INLINE void operator()(Accumulator& val, Accumulator const& v) const
+  {
+    val.combine(v);
+  }
+};
+
+/*!
+ **************************************************************************
+ *
+ * \brief  Sum reducer class template whose result is the same for any
+ *         number of threads and any order of the summed values.
+ *
+ * Each thread's copy of the reducer adds its values into its own
+ * ReproducibleAccumulator, and the copies are combined with the backend's
+ * Combiner as for the other reducers.
+ *
+ **************************************************************************
+ */
+template <typename T, template <typename, typename> class Combiner>
+class BaseReduceSumReproducible
+    : public BaseReduce<
+          ReproducibleAccumulator<T>,
+          sum_reproducible,
+          Combiner>
+{
+public:
+  using accumulator_type = ReproducibleAccumulator<T>;
+  using Base = BaseReduce<accumulator_type, sum_reproducible, Combiner>;
+  using value_type = T;
+
+  BaseReduceSumReproducible() : Base(accumulator_type(), accumulator_type())
+  {
+  }
+
+  BaseReduceSumReproducible(T init_val, T identity_ = T())
+      : Base(accumulator_type(init_val), accumulator_type(identity_))
+  {
+  }
+
+  void reset(T init_val, T identity_ = T())
+  {
+    Base::reset(accumulator_type(init_val), accumulator_type(identity_));
+  }
+
+  //! reducer function; updates the current instance's state
+  const BaseReduceSumReproducible &operator+=(T rhs) const
+  {
+    this->local().add(rhs);
+    return *this;
+  }
+
+  //! Get the calculated reduced value
+  T get() const { return Base::get().value(); }
+
+  //! Get the calculated reduced value
+  operator T() const { return get(); }
+};
+
+}  // namespace detail
+
+}  // namespace reduce
+
+}  // namespace RAJA
+
+#endif /* RAJA_PATTERN_DETAIL_REDUCE_REPRODUCIBLE_HPP */
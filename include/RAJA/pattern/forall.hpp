@@ -132,6 +132,71 @@ struct CallForallIcount {
 
   const int start;
 };
+
+//! runs the iterations [offset, offset + length) of a segment
+struct CallForallSlice {
+  constexpr CallForallSlice(Index_type o, Index_type l);
+
+  template <typename T, typename ExecPol, typename Body, typename Res>
+  RAJA_INLINE camp::resources::EventProxy<Res> operator()(T const&, ExecPol, Body, Res&) const;
+
+  const Index_type offset;
+  const Index_type length;
+};
+
+//! runs the iterations [offset, offset + length) of a segment with icount
+struct CallForallIcountSlice {
+  constexpr CallForallIcountSlice(Index_type o, Index_type l, Index_type s);
+
+  template <typename T, typename ExecPol, typename Body, typename Res>
+  RAJA_INLINE camp::resources::EventProxy<Res> operator()(T const&, ExecPol, Body, Res&) const;
+
+  const Index_type offset;
+  const Index_type length;
+  const Index_type start;
+};
+
+/*!
+ * Calls func(segid, offset, length, icount) for every non-empty piece of
+ * the flattened iteration space [first, last) of iset, where the piece is
+ * iterations [offset, offset + length) of segment segid and icount is the
+ * position of its first iteration in the index set.
+ */
+template <typename IdxSet, typename Func>
+RAJA_INLINE void flattened_segment_slices(
+    const IdxSet& iset,
+    Index_type first,
+    Index_type last,
+    Func&& func)
+{
+  const int num_seg = static_cast<int>(iset.getNumSegments());
+  const Index_type total = static_cast<Index_type>(iset.getLength());
+
+  // last segment that starts at or before first, which skips empty
+  // segments sharing its starting icount
+  int lo = 0;
+  int hi = num_seg;
+  while (hi - lo > 1) {
+    int mid = lo + (hi - lo) / 2;
+    if (iset.getStartingIcount(mid) <= first) {
+      lo = mid;
+    } else {
+      hi = mid;
+    }
+  }
+
+  for (int seg = lo; seg < num_seg && first < last; ++seg) {
+    const Index_type seg_begin = iset.getStartingIcount(seg);
+    const Index_type seg_end =
+        (seg + 1 < num_seg) ? iset.getStartingIcount(seg + 1) : total;
+    const Index_type end = seg_end < last ? seg_end : last;
+    if (end > first) {
+      func(seg, first - seg_begin, end - first, first);
+      first = end;
+    }
+  }
+}
+
 }  // namespace detail
 
 /*!
@@ -209,13 +274,14 @@ RAJA_INLINE resources::EventProxy<Res> forall_Icount(Res &r,
 template <typename Res,
           typename SegmentIterPolicy,
           typename SegmentExecPolicy,
-          typename... SegmentTypes,
+          typename IdxSet,
           typename LoopBody>
-RAJA_INLINE resources::EventProxy<Res> forall_Icount(Res&r,
-                                                ExecPolicy<SegmentIterPolicy,
-                                                SegmentExecPolicy>,
-                                                const TypedIndexSet<SegmentTypes...>& iset,
-                                                LoopBody loop_body)
+RAJA_INLINE concepts::enable_if_t<resources::EventProxy<Res>,
+                                  type_traits::is_index_set<IdxSet>>
+forall_Icount(Res &r,
+              ExecPolicy<SegmentIterPolicy, SegmentExecPolicy>,
+              const IdxSet& iset,
+              LoopBody loop_body)
 {
   // no need for icount variant here
   auto segIterRes = resources::get_resource<SegmentIterPolicy>::type::get_default();
@@ -233,12 +299,13 @@ template <typename Res,
           typename SegmentIterPolicy,
           typename SegmentExecPolicy,
           typename LoopBody,
-          typename... SegmentTypes>
-RAJA_INLINE resources::EventProxy<Res> forall(Res &r,
-                                         ExecPolicy<SegmentIterPolicy,
-                                         SegmentExecPolicy>,
-                                         const TypedIndexSet<SegmentTypes...>& iset,
-                                         LoopBody loop_body)
+          typename IdxSet>
+RAJA_INLINE concepts::enable_if_t<resources::EventProxy<Res>,
+                                  type_traits::is_index_set<IdxSet>>
+forall(Res &r,
+       ExecPolicy<SegmentIterPolicy, SegmentExecPolicy>,
+       const IdxSet& iset,
+       LoopBody loop_body)
 {
   auto segIterRes = resources::get_resource<SegmentIterPolicy>::type::get_default();
   wrap::forall(segIterRes, SegmentIterPolicy(), iset, [=, &r](int segID) {
@@ -247,6 +314,88 @@ RAJA_INLINE resources::EventProxy<Res> forall(Res &r,
   return RAJA::resources::EventProxy<Res>(&r);
 }
 
+/*!
+******************************************************************************
+*
+* \brief Execute an index set as one flattened loop of equal sized chunks.
+*
+*        Chunks are distributed with the chunk iteration policy of
+*        flatten_segit, so a parallel policy forks once for the whole index
+*        set. Each chunk executes its slice of every segment it overlaps
+*        with the segment execution policy.
+*
+******************************************************************************
+*/
+template <typename Res,
+          typename ChunkIterPolicy,
+          size_t ChunkSize,
+          typename SegmentExecPolicy,
+          typename IdxSet,
+          typename LoopBody>
+RAJA_INLINE concepts::enable_if_t<resources::EventProxy<Res>,
+                                  type_traits::is_index_set<IdxSet>>
+forall_Icount(Res &r,
+              ExecPolicy<flatten_segit<ChunkIterPolicy, ChunkSize>, SegmentExecPolicy>,
+              const IdxSet& iset,
+              LoopBody loop_body)
+{
+  const Index_type len = static_cast<Index_type>(iset.getLength());
+  const Index_type chunk = static_cast<Index_type>(ChunkSize);
+  auto chunkRes = resources::get_resource<ChunkIterPolicy>::type::get_default();
+  wrap::forall(chunkRes,
+               ChunkIterPolicy(),
+               TypedRangeSegment<Index_type>(0, (len + chunk - 1) / chunk),
+               [=, &r, &iset](Index_type c) {
+    const Index_type first = c * chunk;
+    const Index_type last = first + chunk < len ? first + chunk : len;
+    detail::flattened_segment_slices(
+        iset, first, last,
+        [&](int segID, Index_type offset, Index_type length, Index_type icount) {
+          iset.segmentCall(segID,
+                           detail::CallForallIcountSlice(offset, length, icount),
+                           SegmentExecPolicy(),
+                           loop_body,
+                           r);
+        });
+  });
+  return RAJA::resources::EventProxy<Res>(&r);
+}
+
+template <typename Res,
+          typename ChunkIterPolicy,
+          size_t ChunkSize,
+          typename SegmentExecPolicy,
+          typename LoopBody,
+          typename IdxSet>
+RAJA_INLINE concepts::enable_if_t<resources::EventProxy<Res>,
+                                  type_traits::is_index_set<IdxSet>>
+forall(Res &r,
+       ExecPolicy<flatten_segit<ChunkIterPolicy, ChunkSize>, SegmentExecPolicy>,
+       const IdxSet& iset,
+       LoopBody loop_body)
+{
+  const Index_type len = static_cast<Index_type>(iset.getLength());
+  const Index_type chunk = static_cast<Index_type>(ChunkSize);
+  auto chunkRes = resources::get_resource<ChunkIterPolicy>::type::get_default();
+  wrap::forall(chunkRes,
+               ChunkIterPolicy(),
+               TypedRangeSegment<Index_type>(0, (len + chunk - 1) / chunk),
+               [=, &r, &iset](Index_type c) {
+    const Index_type first = c * chunk;
+    const Index_type last = first + chunk < len ? first + chunk : len;
+    detail::flattened_segment_slices(
+        iset, first, last,
+        [&](int segID, Index_type offset, Index_type length, Index_type) {
+          iset.segmentCall(segID,
+                           detail::CallForallSlice(offset, length),
+                           SegmentExecPolicy(),
+                           loop_body,
+                           r);
+        });
+  });
+  return RAJA::resources::EventProxy<Res>(&r);
+}
+
 }  // end namespace wrap
 
 
@@ -574,6 +723,49 @@ RAJA_INLINE camp::resources::EventProxy<Res> CallForallIcount::operator()(T cons
   return wrap::forall_Icount(r, ExecutionPolicy(), segment, start, body);
 }
 
+constexpr CallForallSlice::CallForallSlice(Index_type o, Index_type l)
+    : offset(o), length(l)
+{
+}
+
+template <typename T, typename ExecutionPolicy, typename LoopBody, typename Res>
+RAJA_INLINE camp::resources::EventProxy<Res> CallForallSlice::operator()(T const& segment,
+                                                                    ExecutionPolicy,
+                                                                    LoopBody body,
+                                                                    Res &r) const
+{
+  using std::begin;
+  // this is only called inside a region, use impl
+  using policy::sequential::forall_impl;
+  RAJA_FORCEINLINE_RECURSIVE
+  return forall_impl(r,
+                     ExecutionPolicy(),
+                     make_span(begin(segment) + offset, length),
+                     body);
+}
+
+constexpr CallForallIcountSlice::CallForallIcountSlice(Index_type o,
+                                                       Index_type l,
+                                                       Index_type s)
+    : offset(o), length(l), start(s)
+{
+}
+
+template <typename T, typename ExecutionPolicy, typename LoopBody, typename Res>
+RAJA_INLINE camp::resources::EventProxy<Res> CallForallIcountSlice::operator()(T const& segment,
+                                                                          ExecutionPolicy,
+                                                                          LoopBody body,
+                                                                          Res &r) const
+{
+  using std::begin;
+  // go through wrap to unwrap icount
+  return wrap::forall_Icount(r,
+                             ExecutionPolicy(),
+                             make_span(begin(segment) + offset, length),
+                             start,
+                             body);
+}
+
 }  // namespace detail
 
 }  // namespace RAJA
@@ -0,0 +1,275 @@
+/*!
+ ******************************************************************************
+ *
+ * \file
+ *
+ * \brief   Header file containing the RAJA LaunchGraph API, which records a
+ *          sequence of forall and kernel launches once and replays it.
+ *
+ *             \code
+ *             RAJA::LaunchGraph<graph_policy> graph;
+ *             graph.forall(segment, body);
+ *             graph.kernel<kernel_policy>(segments, bodies...);
+ *             graph.replay();
+ *             \endcode
+ *
+ ******************************************************************************
+ */
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-20, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/COPYRIGHT file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#ifndef RAJA_pattern_graph_HPP
+#define RAJA_pattern_graph_HPP
+
+#include "RAJA/config.hpp"
+
+#include <iterator>
+#include <memory>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "camp/camp.hpp"
+
+#include "RAJA/pattern/kernel.hpp"
+
+#include "RAJA/util/concepts.hpp"
+#include "RAJA/util/plugins.hpp"
+#include "RAJA/util/types.hpp"
+
+namespace RAJA
+{
+
+/*!
+ * \brief Dependence of a LaunchGraph launch on the launches before it.
+ *
+ * all:       depends on any earlier launch, a barrier precedes it.
+ * pointwise: iteration i depends only on iteration i of the previous
+ *            launch, which is a forall of the same length. No barrier is
+ *            needed if the backend assigns both loops' iterations to
+ *            threads the same way, otherwise it is treated as all.
+ * none:      independent of every launch since the last barrier.
+ */
+enum class GraphDep { all, pointwise, none };
+
+namespace detail
+{
+
+//! recorded launch, run() executes it inside the graph's region
+struct GraphNode {
+  virtual ~GraphNode() {}
+
+  virtual void run() = 0;
+
+  //! number of iterations of a forall launch, -1 for kernel launches
+  virtual Index_type length() const = 0;
+};
+
+template <typename GraphPolicy, typename Segment, typename Body>
+struct GraphForallNode : GraphNode {
+  GraphForallNode(Segment const& seg, Body const& body)
+      : m_segment(seg), m_body(body)
+  {
+  }
+
+  void run() override
+  {
+    // a fresh copy per replay lets reducers in the body combine each time
+    Body body(m_body);
+    graph_forall_impl(GraphPolicy(), m_segment, body);
+  }
+
+  Index_type length() const override
+  {
+    using std::begin;
+    using std::distance;
+    using std::end;
+    return static_cast<Index_type>(
+        distance(begin(m_segment), end(m_segment)));
+  }
+
+  Segment m_segment;
+  Body m_body;
+};
+
+template <typename KernelPolicy, typename LoopData>
+struct GraphKernelNode : GraphNode {
+  explicit GraphKernelNode(LoopData&& data) : m_data(std::move(data)) {}
+
+  void run() override
+  {
+    using loop_types_t = internal::makeInitialLoopTypes<LoopData>;
+
+    // loop data is modified as the statements execute, run on a copy
+    LoopData data(m_data);
+    RAJA_FORCEINLINE_RECURSIVE
+    internal::execute_statement_list<KernelPolicy, loop_types_t>(data);
+  }
+
+  Index_type length() const override { return -1; }
+
+  LoopData m_data;
+};
+
+}  // namespace detail
+
+/*!
+ ******************************************************************************
+ *
+ * \brief  Records a sequence of forall and kernel launches and replays it.
+ *
+ * Launches are captured once with their segments and bodies, both copied
+ * into the graph. replay() runs them in capture order without building
+ * plugin contexts or dispatching on policies. Plugins are not invoked for
+ * graph launches.
+ *
+ * GRAPH_POLICY_T selects the backend. seq_graph runs the launches one
+ * after another. omp_graph runs the whole graph in a single OpenMP
+ * parallel region: forall launches are distributed with a static
+ * schedule and no implied barrier, and a barrier is only placed before a
+ * launch whose GraphDep requires one. Kernel launches are run by every
+ * thread of the region, so their policies must use the orphaned OpenMP
+ * loop policies (e.g. omp_for_nowait_exec) rather than ones that open a
+ * parallel region.
+ *
+ ******************************************************************************
+ */
+template <typename GRAPH_POLICY_T>
+class LaunchGraph
+{
+public:
+  using policy = GRAPH_POLICY_T;
+
+  LaunchGraph() = default;
+
+  LaunchGraph(LaunchGraph const&) = delete;
+  LaunchGraph& operator=(LaunchGraph const&) = delete;
+
+  LaunchGraph(LaunchGraph&&) = default;
+  LaunchGraph& operator=(LaunchGraph&&) = default;
+
+  //! Record a forall launch that depends on all earlier launches.
+  template <typename Segment, typename Body>
+  void forall(Segment&& segment, Body&& body)
+  {
+    forall(GraphDep::all,
+           std::forward<Segment>(segment),
+           std::forward<Body>(body));
+  }
+
+  //! Record a forall launch with the given dependence.
+  template <typename Segment, typename Body>
+  void forall(GraphDep dep, Segment&& segment, Body&& body)
+  {
+    static_assert(type_traits::is_random_access_range<Segment>::value,
+                  "Segment does not model RandomAccessIterator");
+
+    using RAJA::util::trigger_updates_before;
+    auto captured = trigger_updates_before(body);
+
+    using node_t = detail::GraphForallNode<GRAPH_POLICY_T,
+                                           camp::decay<Segment>,
+                                           camp::decay<decltype(captured)>>;
+    push(dep,
+         std::unique_ptr<detail::GraphNode>(
+             new node_t(std::forward<Segment>(segment), std::move(captured))));
+  }
+
+  //! Record a kernel launch that depends on all earlier launches.
+  template <typename KernelPolicy, typename SegmentTuple, typename... Bodies>
+  concepts::enable_if<
+      concepts::negate<std::is_same<camp::decay<SegmentTuple>, GraphDep>>>
+  kernel(SegmentTuple&& segments, Bodies&&... bodies)
+  {
+    kernel<KernelPolicy>(GraphDep::all,
+                         std::forward<SegmentTuple>(segments),
+                         std::forward<Bodies>(bodies)...);
+  }
+
+  //! Record a kernel launch with the given dependence.
+  template <typename KernelPolicy, typename SegmentTuple, typename... Bodies>
+  void kernel(GraphDep dep, SegmentTuple&& segments, Bodies&&... bodies)
+  {
+    using segment_tuple_t =
+        typename IterableWrapperTuple<camp::decay<SegmentTuple>>::type;
+
+    using loop_data_t = internal::LoopData<segment_tuple_t,
+                                           camp::tuple<>,
+                                           camp::decay<Bodies>...>;
+
+    using node_t = detail::GraphKernelNode<KernelPolicy, loop_data_t>;
+    push(dep,
+         std::unique_ptr<detail::GraphNode>(new node_t(
+             loop_data_t(make_wrapped_tuple(std::forward<SegmentTuple>(segments)),
+                         RAJA::make_tuple(),
+                         std::forward<Bodies>(bodies)...))));
+  }
+
+  //! Run the recorded launches.
+  void replay()
+  {
+    if (!m_nodes.empty()) {
+      graph_replay_impl(GRAPH_POLICY_T(), m_nodes, m_barriers);
+    }
+  }
+
+  //! Remove all recorded launches.
+  void clear()
+  {
+    m_nodes.clear();
+    m_barriers.clear();
+  }
+
+  //! Number of recorded launches.
+  size_t size() const { return m_nodes.size(); }
+
+  //! Number of barriers placed between launches when replaying.
+  size_t num_barriers() const
+  {
+    size_t num = 0;
+    for (char b : m_barriers) {
+      num += b ? 1 : 0;
+    }
+    return num;
+  }
+
+private:
+  void push(GraphDep dep, std::unique_ptr<detail::GraphNode>&& node)
+  {
+    bool barrier = false;
+    if (!m_nodes.empty()) {
+      switch (dep) {
+        case GraphDep::none:
+          barrier = false;
+          break;
+        case GraphDep::pointwise: {
+          const Index_type prev = m_nodes.back()->length();
+          barrier = !(graph_pointwise_ok(GRAPH_POLICY_T()) && prev >= 0 &&
+                      prev == node->length());
+          break;
+        }
+        default:
+          barrier = true;
+          break;
+      }
+    }
+    m_nodes.push_back(std::move(node));
+    m_barriers.push_back(barrier);
+  }
+
+  std::vector<std::unique_ptr<detail::GraphNode>> m_nodes;
+
+  //! m_barriers[n] is set if a barrier is needed before launch n
+  std::vector<char> m_barriers;
+};
+
+}  // namespace RAJA
+
+#include "RAJA/policy/sequential/graph.hpp"
+
+#endif  // closing endif for header file include guard
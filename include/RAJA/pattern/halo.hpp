@@ -0,0 +1,506 @@
+/*!
+ ******************************************************************************
+ *
+ * \file
+ *
+ * \brief   Header file providing RAJA halo pack and unpack over boxes of
+ *          structured data, run with WorkGroup.
+ *
+ ******************************************************************************
+ */
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-20, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/COPYRIGHT file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#ifndef RAJA_pattern_halo_HPP
+#define RAJA_pattern_halo_HPP
+
+#include "RAJA/config.hpp"
+
+#include <array>
+#include <cstring>
+#include <memory>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "RAJA/index/RangeSegment.hpp"
+#include "RAJA/pattern/WorkGroup.hpp"
+#include "RAJA/policy/WorkGroup.hpp"
+#include "RAJA/util/macros.hpp"
+#include "RAJA/util/types.hpp"
+
+namespace RAJA
+{
+
+/*!
+ ******************************************************************************
+ *
+ * \brief  Box of indices of an N dimensional array.
+ *
+ * In dimension d the box holds the indices begin[d], begin[d] + stride[d],
+ * ... that are less than end[d].
+ *
+ ******************************************************************************
+ */
+template <size_t N>
+struct HaloBox {
+  std::array<Index_type, N> begin;
+  std::array<Index_type, N> end;
+  std::array<Index_type, N> stride;
+
+  HaloBox() : begin{}, end{}, stride{}
+  {
+    stride.fill(1);
+  }
+
+  HaloBox(std::array<Index_type, N> const& begin_in,
+          std::array<Index_type, N> const& end_in)
+      : begin(begin_in), end(end_in), stride{}
+  {
+    stride.fill(1);
+  }
+
+  HaloBox(std::array<Index_type, N> const& begin_in,
+          std::array<Index_type, N> const& end_in,
+          std::array<Index_type, N> const& stride_in)
+      : begin(begin_in), end(end_in), stride(stride_in)
+  {
+  }
+
+  //! number of indices of the box in dimension d
+  Index_type extent(size_t d) const
+  {
+    return (end[d] > begin[d]) ? (end[d] - begin[d] + stride[d] - 1) / stride[d]
+                               : Index_type(0);
+  }
+
+  //! number of indices in the box
+  Index_type size() const
+  {
+    Index_type num = 1;
+    for (size_t d = 0; d < N; ++d) {
+      num *= extent(d);
+    }
+    return num;
+  }
+};
+
+/*!
+ * \brief Face, edge or corner of a box shaped domain with ghost cells.
+ *
+ * direction holds -1, 0 or 1 in each dimension. pack_box holds the interior
+ * cells sent to the neighbor in that direction and unpack_box the ghost
+ * cells received from it.
+ */
+template <size_t N>
+struct HaloNeighbor {
+  std::array<int, N> direction;
+  HaloBox<N> pack_box;
+  HaloBox<N> unpack_box;
+};
+
+/*!
+ ******************************************************************************
+ *
+ * \brief  Make the 3^N - 1 faces, edges and corners of a domain.
+ *
+ * \param extents  sizes of the domain including ghost cells
+ * \param width    number of ghost cells on each side of each dimension
+ *
+ * Neighbors are returned in lexicographic order of their directions, so the
+ * neighbor opposite to neighbor k is neighbor 3^N - 2 - k.
+ *
+ ******************************************************************************
+ */
+template <size_t N>
+std::vector<HaloNeighbor<N>> make_halo_neighbors(
+    std::array<Index_type, N> const& extents,
+    Index_type width)
+{
+  size_t num = 1;
+  for (size_t d = 0; d < N; ++d) {
+    num *= 3;
+  }
+
+  std::vector<HaloNeighbor<N>> neighbors;
+  neighbors.reserve(num - 1);
+
+  for (size_t n = 0; n < num; ++n) {
+    HaloNeighbor<N> neighbor;
+    bool center = true;
+    size_t rem = n;
+    for (size_t d = N; d > 0; --d) {
+      const size_t dim = d - 1;
+      const Index_type e = extents[dim];
+      const int dir = static_cast<int>(rem % 3) - 1;
+      rem /= 3;
+
+      neighbor.direction[dim] = dir;
+      center = center && (dir == 0);
+      if (dir < 0) {
+        neighbor.pack_box.begin[dim] = width;
+        neighbor.pack_box.end[dim] = 2 * width;
+        neighbor.unpack_box.begin[dim] = 0;
+        neighbor.unpack_box.end[dim] = width;
+      } else if (dir == 0) {
+        neighbor.pack_box.begin[dim] = width;
+        neighbor.pack_box.end[dim] = e - width;
+        neighbor.unpack_box.begin[dim] = width;
+        neighbor.unpack_box.end[dim] = e - width;
+      } else {
+        neighbor.pack_box.begin[dim] = e - 2 * width;
+        neighbor.pack_box.end[dim] = e - width;
+        neighbor.unpack_box.begin[dim] = e - width;
+        neighbor.unpack_box.end[dim] = e;
+      }
+    }
+    if (!center) {
+      neighbors.push_back(neighbor);
+    }
+  }
+
+  return neighbors;
+}
+
+
+namespace detail
+{
+
+/*!
+ * \brief A HaloBox over a Layout as runs of elements of equal length.
+ *
+ * The elements of the box are ordered as they are in memory. Each run holds
+ * run_length elements run_stride apart; when the innermost dimensions of
+ * the box are contiguous they are merged into one run.
+ */
+template <size_t N>
+struct HaloRuns {
+  Index_type base;
+  Index_type run_length;
+  Index_type run_stride;
+  Index_type num_runs;
+  int num_outer;
+  // outer dimensions, fastest first
+  Index_type outer_extent[N];
+  Index_type outer_stride[N];
+
+  RAJA_HOST_DEVICE RAJA_INLINE Index_type offset(Index_type run) const
+  {
+    Index_type off = base;
+    for (int k = 0; k < num_outer; ++k) {
+      off += (run % outer_extent[k]) * outer_stride[k];
+      run /= outer_extent[k];
+    }
+    return off;
+  }
+};
+
+template <size_t N>
+HaloRuns<N> makeHaloRuns(HaloBox<N> const& box,
+                         std::array<Index_type, N> const& layout_strides)
+{
+  // order dimensions by stride in memory, keep the order of ties so boxes
+  // of the same shape are always traversed the same way
+  std::array<size_t, N> dims;
+  for (size_t d = 0; d < N; ++d) {
+    dims[d] = N - 1 - d;
+  }
+  for (size_t i = 1; i < N; ++i) {
+    for (size_t j = i; j > 0 && layout_strides[dims[j]] <
+                                    layout_strides[dims[j - 1]]; --j) {
+      std::swap(dims[j], dims[j - 1]);
+    }
+  }
+
+  HaloRuns<N> runs{};
+  runs.base = 0;
+  runs.run_length = 1;
+  runs.run_stride = 1;
+  runs.num_runs = 1;
+  runs.num_outer = 0;
+
+  bool merging = true;
+  bool first = true;
+  for (size_t i = 0; i < N; ++i) {
+    const size_t d = dims[i];
+    const Index_type ext = box.extent(d);
+    const Index_type stride = layout_strides[d] * box.stride[d];
+
+    runs.base += box.begin[d] * layout_strides[d];
+
+    if (ext == 0) {
+      runs.num_runs = 0;
+    }
+    if (ext <= 1) {
+      continue;
+    }
+
+    if (first) {
+      runs.run_length = ext;
+      runs.run_stride = stride;
+      first = false;
+    } else if (merging && runs.run_length * runs.run_stride == stride) {
+      runs.run_length *= ext;
+    } else {
+      merging = false;
+      runs.outer_extent[runs.num_outer] = ext;
+      runs.outer_stride[runs.num_outer] = stride;
+      ++runs.num_outer;
+      runs.num_runs *= ext;
+    }
+  }
+
+  return runs;
+}
+
+//! copy len elements from src with stride src_stride to dst with stride dst_stride
+template <typename T>
+RAJA_HOST_DEVICE RAJA_INLINE void copyHaloRun(T* dst,
+                                              Index_type dst_stride,
+                                              T const* src,
+                                              Index_type src_stride,
+                                              Index_type len)
+{
+#if defined(RAJA_DEVICE_CODE)
+  for (Index_type k = 0; k < len; ++k) {
+    dst[k * dst_stride] = src[k * src_stride];
+  }
+#else
+  if (dst_stride == 1 && src_stride == 1) {
+    std::memcpy(dst, src, len * sizeof(T));
+  } else {
+    RAJA_SIMD
+    for (Index_type k = 0; k < len; ++k) {
+      dst[k * dst_stride] = src[k * src_stride];
+    }
+  }
+#endif
+}
+
+template <typename WorkPool_type, typename T, size_t N>
+void enqueueHaloPack(WorkPool_type& pool,
+                     size_t neighbor,
+                     HaloRuns<N> const& runs,
+                     T* var,
+                     Index_type buffer_offset)
+{
+  pool.enqueue(TypedRangeSegment<Index_type>(0, runs.num_runs),
+               [=] RAJA_HOST_DEVICE(Index_type r, T* const* buffers) {
+                 copyHaloRun(buffers[neighbor] + buffer_offset +
+                                 r * runs.run_length,
+                             Index_type(1),
+                             var + runs.offset(r),
+                             runs.run_stride,
+                             runs.run_length);
+               });
+}
+
+template <typename WorkPool_type, typename T, size_t N>
+void enqueueHaloUnpack(WorkPool_type& pool,
+                       size_t neighbor,
+                       HaloRuns<N> const& runs,
+                       T* var,
+                       Index_type buffer_offset)
+{
+  pool.enqueue(TypedRangeSegment<Index_type>(0, runs.num_runs),
+               [=] RAJA_HOST_DEVICE(Index_type r, T* const* buffers) {
+                 copyHaloRun(var + runs.offset(r),
+                             runs.run_stride,
+                             buffers[neighbor] + buffer_offset +
+                                 r * runs.run_length,
+                             Index_type(1),
+                             runs.run_length);
+               });
+}
+
+}  // namespace detail
+
+
+/*!
+ ******************************************************************************
+ *
+ * \brief  Halo pack and unpack of variables sharing an N dimensional Layout.
+ *
+ * Each neighbor is described by a box of elements to pack into its send
+ * buffer and a box of the same shape to unpack from its receive buffer,
+ * instead of by lists of indices. The boxes are split into runs of
+ * contiguous or equally strided elements that are copied with memcpy or
+ * simple strided loops.
+ *
+ * pack and unpack each run one WorkGroup holding a loop for every neighbor
+ * and variable. The WorkGroups are built on first use and rebuilt only
+ * after variables or neighbors are added, so the send and receive buffers
+ * can change between calls.
+ *
+ * The buffer of a neighbor holds buffer_size(neighbor) elements: the
+ * elements of its box for each variable in the order the variables were
+ * added, each in memory order.
+ *
+ * Usage example:
+ *
+ * \verbatim
+
+   using policy = RAJA::WorkGroupPolicy<RAJA::loop_work,
+                                        RAJA::ordered,
+                                        RAJA::ragged_array_of_objects>;
+
+   RAJA::HaloExchange<policy, double, 3, std::allocator<char>>
+       halo(layout, std::allocator<char>{});
+
+   halo.add_variable(density);
+   halo.add_variable(energy);
+   for (auto& n : RAJA::make_halo_neighbors<3>({nx, ny, nz}, 1)) {
+     halo.add_neighbor(n.pack_box, n.unpack_box);
+   }
+
+   auto pack_site = halo.pack(send_buffers);
+   // send and receive buffers
+   auto unpack_site = halo.unpack(recv_buffers);
+
+ * \endverbatim
+ *
+ ******************************************************************************
+ */
+template <typename WORKGROUP_POLICY_T,
+          typename T,
+          size_t N,
+          typename ALLOCATOR_T>
+class HaloExchange
+{
+  static_assert(std::is_trivially_copyable<T>::value,
+                "HaloExchange: T must be trivially copyable");
+
+public:
+  using policy = WORKGROUP_POLICY_T;
+  using value_type = T;
+  using Allocator = ALLOCATOR_T;
+
+  using workpool_type =
+      WorkPool<policy, Index_type, xargs<T* const*>, Allocator>;
+  using workgroup_type =
+      WorkGroup<policy, Index_type, xargs<T* const*>, Allocator>;
+  using worksite_type =
+      WorkSite<policy, Index_type, xargs<T* const*>, Allocator>;
+
+  template <typename Layout_T>
+  HaloExchange(Layout_T const& layout, Allocator const& aloc)
+      : m_aloc(aloc)
+  {
+    static_assert(Layout_T::n_dims == N,
+                  "HaloExchange: Layout must have N dimensions");
+    for (size_t d = 0; d < N; ++d) {
+      m_strides[d] = static_cast<Index_type>(layout.strides[d]);
+    }
+  }
+
+  HaloExchange(HaloExchange const&) = delete;
+  HaloExchange& operator=(HaloExchange const&) = delete;
+
+  //! add a variable, returns its index
+  size_t add_variable(T* var)
+  {
+    m_vars.push_back(var);
+    clearGroups();
+    return m_vars.size() - 1;
+  }
+
+  //! add a neighbor, returns its index in the buffer arrays
+  size_t add_neighbor(HaloBox<N> const& pack_box, HaloBox<N> const& unpack_box)
+  {
+    for (size_t d = 0; d < N; ++d) {
+      if (pack_box.extent(d) != unpack_box.extent(d)) {
+        RAJA_ABORT_OR_THROW(
+            "HaloExchange: pack and unpack boxes must have the same shape");
+      }
+    }
+    m_pack_runs.push_back(detail::makeHaloRuns(pack_box, m_strides));
+    m_unpack_runs.push_back(detail::makeHaloRuns(unpack_box, m_strides));
+    m_box_sizes.push_back(pack_box.size());
+    clearGroups();
+    return m_box_sizes.size() - 1;
+  }
+
+  size_t num_variables() const { return m_vars.size(); }
+
+  size_t num_neighbors() const { return m_box_sizes.size(); }
+
+  //! number of elements of the send and receive buffers of a neighbor
+  Index_type buffer_size(size_t neighbor) const
+  {
+    return m_box_sizes[neighbor] * static_cast<Index_type>(m_vars.size());
+  }
+
+  /*!
+   * \brief Pack all variables into send_buffers[neighbor] for all neighbors.
+   *
+   * The returned WorkSite must be kept until the packing has finished.
+   */
+  worksite_type pack(T* const* send_buffers)
+  {
+    if (!m_pack_group) {
+      m_pack_group = buildGroup(m_pack_runs, false);
+    }
+    return m_pack_group->run(send_buffers);
+  }
+
+  /*!
+   * \brief Unpack all variables from recv_buffers[neighbor] for all
+   *        neighbors.
+   *
+   * The returned WorkSite must be kept until the unpacking has finished.
+   */
+  worksite_type unpack(T* const* recv_buffers)
+  {
+    if (!m_unpack_group) {
+      m_unpack_group = buildGroup(m_unpack_runs, true);
+    }
+    return m_unpack_group->run(recv_buffers);
+  }
+
+private:
+  std::unique_ptr<workgroup_type> buildGroup(
+      std::vector<detail::HaloRuns<N>> const& runs,
+      bool unpack)
+  {
+    workpool_type pool(m_aloc);
+
+    for (size_t n = 0; n < runs.size(); ++n) {
+      Index_type buffer_offset = 0;
+      for (T* var : m_vars) {
+        if (unpack) {
+          detail::enqueueHaloUnpack(pool, n, runs[n], var, buffer_offset);
+        } else {
+          detail::enqueueHaloPack(pool, n, runs[n], var, buffer_offset);
+        }
+        buffer_offset += m_box_sizes[n];
+      }
+    }
+
+    return std::unique_ptr<workgroup_type>(
+        new workgroup_type(pool.instantiate()));
+  }
+
+  void clearGroups()
+  {
+    m_pack_group.reset();
+    m_unpack_group.reset();
+  }
+
+  Allocator m_aloc;
+  std::array<Index_type, N> m_strides;
+  std::vector<T*> m_vars;
+  std::vector<detail::HaloRuns<N>> m_pack_runs;
+  std::vector<detail::HaloRuns<N>> m_unpack_runs;
+  std::vector<Index_type> m_box_sizes;
+  std::unique_ptr<workgroup_type> m_pack_group;
+  std::unique_ptr<workgroup_type> m_unpack_group;
+};
+
+}  // namespace RAJA
+
+#endif  // closing endif for header file include guard
@@ -0,0 +1,157 @@
+/*!
+ ******************************************************************************
+ *
+ * \file
+ *
+ * \brief   Header file for loop fusion statement.
+ *
+ ******************************************************************************
+ */
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-20, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/COPYRIGHT file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#ifndef RAJA_pattern_kernel_Fuse_HPP
+#define RAJA_pattern_kernel_Fuse_HPP
+
+#include "RAJA/config.hpp"
+
+#include <type_traits>
+
+#include "camp/camp.hpp"
+
+#include "RAJA/pattern/kernel/For.hpp"
+#include "RAJA/pattern/kernel/internal.hpp"
+#include "RAJA/util/macros.hpp"
+#include "RAJA/util/types.hpp"
+
+namespace RAJA
+{
+
+namespace statement
+{
+
+
+/*!
+ * A RAJA::kernel statement that fuses sibling For statements into a
+ * single loop.
+ *
+ * Each of FusedStmts must be a statement::For. Their loops are replaced by
+ * one loop, run with ExecPolicy, over the longest of their segments. At
+ * iteration i, the For statements are visited in order, and each one whose
+ * segment is longer than i assigns i to its argument and executes its
+ * enclosed statements. The execution policies of the fused For statements
+ * are not used.
+ *
+ * Fusion is only correct if iteration i of each statement depends on no
+ * other iteration of the statements before it than i.
+ *
+ */
+template <typename ExecPolicy, typename... FusedStmts>
+struct Fuse : public internal::Statement<ExecPolicy, FusedStmts...> {
+  using execution_policy_t = ExecPolicy;
+};
+
+}  // end namespace statement
+
+
+namespace internal
+{
+
+template <typename Stmt>
+struct FusedFor {
+  static_assert(!std::is_same<Stmt, Stmt>::value,
+                "statement::Fuse only accepts statement::For statements");
+};
+
+template <camp::idx_t ArgumentId, typename ExecPolicy, typename... EnclosedStmts>
+struct FusedFor<statement::For<ArgumentId, ExecPolicy, EnclosedStmts...>> {
+
+  template <typename Types, typename Data, typename Len>
+  static RAJA_INLINE void exec(Data &data, Len i)
+  {
+    if (i < static_cast<Len>(segment_length<ArgumentId>(data))) {
+      using NewTypes = setSegmentTypeFromData<Types, ArgumentId, Data>;
+
+      data.template assign_offset<ArgumentId>(i);
+      execute_statement_list<camp::list<EnclosedStmts...>, NewTypes>(data);
+    }
+  }
+
+  template <typename Data>
+  static RAJA_INLINE auto length(Data const &data)
+      -> decltype(segment_length<ArgumentId>(data))
+  {
+    return segment_length<ArgumentId>(data);
+  }
+};
+
+
+/*!
+ * A RAJA::kernel forall_impl loop wrapper for statement::Fuse
+ * Runs iteration i of each fused For statement
+ *
+ */
+template <typename Data, typename Types, typename... FusedStmts>
+struct FuseWrapper : public GenericWrapperBase {
+
+  using data_t = camp::decay<Data>;
+  using privatizer = NestedPrivatizer<FuseWrapper>;
+
+  data_t &data;
+
+  RAJA_INLINE
+  constexpr explicit FuseWrapper(data_t &d) : data{d} {}
+
+  template <typename InIndexType>
+  RAJA_INLINE void operator()(InIndexType i)
+  {
+    // braced initializer list keeps the statements in order
+    int dummy[] = {0, (FusedFor<FusedStmts>::template exec<Types>(data, i),
+                       0)...};
+    (void)dummy;
+  }
+};
+
+
+/*!
+ * A RAJA::kernel forall_impl executor for statement::Fuse
+ *
+ *
+ */
+template <typename ExecPolicy, typename... FusedStmts, typename Types>
+struct StatementExecutor<statement::Fuse<ExecPolicy, FusedStmts...>, Types> {
+
+
+  template <typename Data>
+  static RAJA_INLINE void exec(Data &&data)
+  {
+    using len_t = typename std::common_type<camp::decay<
+        decltype(FusedFor<FusedStmts>::length(data))>...>::type;
+
+    const len_t lengths[] = {
+        static_cast<len_t>(FusedFor<FusedStmts>::length(data))...};
+
+    len_t len = 0;
+    for (len_t l : lengths) {
+      len = (l > len) ? l : len;
+    }
+
+    FuseWrapper<Data, Types, FusedStmts...> fuse_wrapper(data);
+
+    auto r = resources::get_resource<ExecPolicy>::type::get_default();
+
+    forall_impl(r, ExecPolicy{}, TypedRangeSegment<len_t>(0, len), fuse_wrapper);
+  }
+};
+
+
+}  // namespace internal
+}  // end namespace RAJA
+
+
+#endif /* RAJA_pattern_kernel_Fuse_HPP */
@@ -20,15 +20,26 @@
 
 #include "RAJA/config.hpp"
 
+#include <cstddef>
 #include <iostream>
 #include <type_traits>
 
+#include "RAJA/internal/ScratchArena_CPU.hpp"
+
 namespace RAJA
 {
 
 //Policies for RAJA local arrays
+
+//Host local arrays, allocated from a persistent per-thread scratch arena
+//aligned to DATA_ALIGN and cache lines
 struct cpu_tile_mem;
 
+//cpu_tile_mem that fails to compile if the local arrays of the statement
+//need more than CapacityBytes, such as the L1 or L2 cache size
+template<size_t CapacityBytes>
+struct cpu_tile_mem_checked;
+
 
 namespace statement
 {
@@ -58,17 +69,40 @@ struct InitLocalMem<RAJA::cpu_tile_mem, camp::idx_seq<Indices...>, EnclosedStmts
 namespace internal
 {
 
-//Statement executor to initalize RAJA local array
-template<camp::idx_t... Indices, typename... EnclosedStmts, typename Types>
-struct StatementExecutor<statement::InitLocalMem<RAJA::cpu_tile_mem,camp::idx_seq<Indices...>, EnclosedStmts...>, Types>{
-  
+//Padded bytes of the local arrays at positions Indices of Data's params
+template<typename Data, camp::idx_t... Indices>
+struct LocalMemBytes;
+
+template<typename Data>
+struct LocalMemBytes<Data> {
+  static constexpr size_t value = 0;
+};
+
+template<typename Data, camp::idx_t Pos, camp::idx_t... others>
+struct LocalMemBytes<Data, Pos, others...> {
+  using array_t = camp::decay<camp::tuple_element_t<Pos, typename camp::decay<Data>::param_tuple_t>>;
+
+  static constexpr size_t value =
+      RAJA::detail::ScratchArenaCPU::padded_bytes(
+          sizeof(typename array_t::value_type) * array_t::layout_type::s_size) +
+      LocalMemBytes<Data, others...>::value;
+};
+
+//Initalizes RAJA local arrays in the calling thread's scratch arena
+//If CapacityBytes is not zero, checks the arrays fit in it
+template<size_t CapacityBytes, typename Indices, typename StmtList, typename Types>
+struct CpuTileMemExecutor;
+
+template<size_t CapacityBytes, camp::idx_t... Indices, typename... EnclosedStmts, typename Types>
+struct CpuTileMemExecutor<CapacityBytes, camp::idx_seq<Indices...>, camp::list<EnclosedStmts...>, Types>{
+
   //Execute statement list
   template<class Data>
   static void RAJA_INLINE exec_expanded(Data && data)
   {
     execute_statement_list<camp::list<EnclosedStmts...>, Types>(data);
   }
-  
+
   //Intialize local array
   //Identifies type + number of elements needed
   template<camp::idx_t Pos, camp::idx_t... others, class Data>
@@ -76,35 +110,41 @@ struct StatementExecutor<statement::InitLocalMem<RAJA::cpu_tile_mem,camp::idx_se
   {
     using varType = typename camp::tuple_element_t<Pos, typename camp::decay<Data>::param_tuple_t>::value_type;
 
-    // Initialize memory
-#ifdef RAJA_COMPILER_MSVC
-    // MSVC doesn't like taking a pointer to stack allocated data?!?!
-    varType *ptr = new varType[camp::get<Pos>(data.param_tuple).size()];
-    camp::get<Pos>(data.param_tuple).set_data(ptr);
-#else
-    varType Array[camp::get<Pos>(data.param_tuple).size()];
-    camp::get<Pos>(data.param_tuple).set_data(&Array[0]);
-#endif
+    // Initialize memory, released in reverse order when Array goes out of
+    // scope, also if an enclosed statement throws
+    RAJA::detail::ScratchArrayCPU<varType> Array(camp::get<Pos>(data.param_tuple).size());
+    camp::get<Pos>(data.param_tuple).set_data(Array.data());
 
     // Initialize others and execute
     exec_expanded<others...>(data);
 
     // Cleanup and return
     camp::get<Pos>(data.param_tuple).set_data(nullptr);
-#ifdef RAJA_COMPILER_MSVC
-    delete[] ptr;
-#endif
   }
-  
 
-  
   template<typename Data>
   static RAJA_INLINE void exec(Data &&data)
   {
+    static_assert(CapacityBytes == 0 ||
+                  LocalMemBytes<Data, Indices...>::value <= CapacityBytes,
+                  "RAJA local arrays exceed the capacity of cpu_tile_mem_checked");
+
     //Initalize local arrays + execute statements + cleanup
     exec_expanded<Indices...>(data);
   }
-  
+
+};
+
+//Statement executor to initalize RAJA local array
+template<camp::idx_t... Indices, typename... EnclosedStmts, typename Types>
+struct StatementExecutor<statement::InitLocalMem<RAJA::cpu_tile_mem,camp::idx_seq<Indices...>, EnclosedStmts...>, Types>
+  : CpuTileMemExecutor<0, camp::idx_seq<Indices...>, camp::list<EnclosedStmts...>, Types> {
+};
+
+//Statement executor to initalize RAJA local array with capacity check
+template<size_t CapacityBytes, camp::idx_t... Indices, typename... EnclosedStmts, typename Types>
+struct StatementExecutor<statement::InitLocalMem<RAJA::cpu_tile_mem_checked<CapacityBytes>,camp::idx_seq<Indices...>, EnclosedStmts...>, Types>
+  : CpuTileMemExecutor<CapacityBytes, camp::idx_seq<Indices...>, camp::list<EnclosedStmts...>, Types> {
 };
 
 
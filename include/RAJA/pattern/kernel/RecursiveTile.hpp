@@ -0,0 +1,195 @@
+/*!
+ ******************************************************************************
+ *
+ * \file
+ *
+ * \brief   Header file for cache-oblivious recursive tiling statement.
+ *
+ ******************************************************************************
+ */
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-20, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/COPYRIGHT file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#ifndef RAJA_pattern_kernel_RecursiveTile_HPP
+#define RAJA_pattern_kernel_RecursiveTile_HPP
+
+#include "RAJA/config.hpp"
+
+#include <type_traits>
+
+#include "camp/camp.hpp"
+#include "camp/concepts.hpp"
+#include "camp/tuple.hpp"
+
+#include "RAJA/pattern/kernel/Tile.hpp"
+#include "RAJA/pattern/kernel/internal.hpp"
+#include "RAJA/policy/loop/policy.hpp"
+#include "RAJA/policy/sequential/policy.hpp"
+#include "RAJA/util/macros.hpp"
+#include "RAJA/util/types.hpp"
+
+namespace RAJA
+{
+
+namespace statement
+{
+
+
+/*!
+ * A RAJA::kernel statement that implements cache-oblivious tiling.
+ *
+ * The segments named in ArgList are bisected recursively, always splitting
+ * the longest one, until no segment is longer than the leaf size given by
+ * LeafPolicy (a tile_fixed<N>). The enclosed statements are executed once
+ * per leaf with the segments restricted to that leaf, exactly as they are
+ * for a Tile statement.
+ *
+ * ExecPolicy selects how the two halves of a split are run. seq_exec and
+ * loop_exec recurse depth first; omp_parallel_for_exec, tbb_for_static
+ * and tbb_for_dynamic run one half as a task.
+ *
+ */
+template <typename ArgList,
+          typename LeafPolicy,
+          typename ExecPolicy,
+          typename... EnclosedStmts>
+struct RecursiveTile : public internal::Statement<ExecPolicy, EnclosedStmts...> {
+  using leaf_policy_t = LeafPolicy;
+  using exec_policy_t = ExecPolicy;
+};
+
+}  // end namespace statement
+
+
+namespace internal
+{
+
+/*!
+ * Runs both halves of a recursive tile split on the calling thread.
+ */
+struct RecursiveTileSeqSpawner {
+
+  template <typename Data, typename Front, typename Back>
+  RAJA_INLINE void operator()(Data &data, Front &&front, Back &&back) const
+  {
+    front(data);
+    back(data);
+  }
+};
+
+
+/*!
+ * Recursively bisects the segments in ArgList of a LoopData object and
+ * executes EnclosedStmts on each leaf. Spawner decides how the two halves
+ * of each split are executed; it is handed the data object for the current
+ * region and is responsible for privatizing it if the halves run
+ * concurrently.
+ */
+template <typename ArgList,
+          camp::idx_t LeafSize,
+          typename Types,
+          typename... EnclosedStmts>
+struct RecursiveTiler;
+
+template <camp::idx_t... ArgumentIds,
+          camp::idx_t LeafSize,
+          typename Types,
+          typename... EnclosedStmts>
+struct RecursiveTiler<ArgList<ArgumentIds...>, LeafSize, Types, EnclosedStmts...> {
+
+  static_assert(LeafSize > 0, "RecursiveTile leaf size must be positive");
+
+  template <typename Data, typename Spawner>
+  static void recurse(Data &data, Spawner const &spawner)
+  {
+    const camp::idx_t ids[] = {ArgumentIds...};
+    const camp::idx_t lengths[] = {
+        static_cast<camp::idx_t>(segment_length<ArgumentIds>(data))...};
+
+    // find the longest segment, ties go to the first (outermost) argument
+    camp::idx_t longest = 0;
+    for (camp::idx_t i = 1; i < camp::idx_t(sizeof...(ArgumentIds)); ++i) {
+      if (lengths[i] > lengths[longest]) {
+        longest = i;
+      }
+    }
+
+    if (lengths[longest] <= LeafSize) {
+      execute_statement_list<camp::list<EnclosedStmts...>, Types>(data);
+      return;
+    }
+
+    const camp::idx_t split_id = ids[longest];
+    camp::sink((split_id == ArgumentIds
+                    ? (split<ArgumentIds>(data, spawner), 0)
+                    : 0)...);
+  }
+
+  template <camp::idx_t ArgumentId, typename Data, typename Spawner>
+  static void split(Data &data, Spawner const &spawner)
+  {
+    // Spans are cheap to copy, keep the full segment to restore later
+    auto const segment = camp::get<ArgumentId>(data.segment_tuple);
+    auto const len = segment.end() - segment.begin();
+    auto const half = len / 2;
+
+    spawner(data,
+            [&](camp::decay<Data> &d) {
+              camp::get<ArgumentId>(d.segment_tuple) =
+                  segment.slice(0, half);
+              recurse(d, spawner);
+            },
+            [&](camp::decay<Data> &d) {
+              camp::get<ArgumentId>(d.segment_tuple) =
+                  segment.slice(half, len - half);
+              recurse(d, spawner);
+            });
+
+    // Set range back to original values
+    camp::get<ArgumentId>(data.segment_tuple) = segment;
+  }
+};
+
+
+/*!
+ * A generic RAJA::kernel executor for statement::RecursiveTile
+ *
+ * Recurses sequentially for seq_exec and loop_exec, back-end specific
+ * executors spawn tasks.
+ *
+ */
+template <camp::idx_t... ArgumentIds,
+          camp::idx_t LeafSize,
+          typename EPol,
+          typename... EnclosedStmts,
+          typename Types>
+struct StatementExecutor<statement::RecursiveTile<ArgList<ArgumentIds...>,
+                                                  tile_fixed<LeafSize>,
+                                                  EPol,
+                                                  EnclosedStmts...>,
+                         Types> {
+
+  static_assert(std::is_same<EPol, seq_exec>::value ||
+                    std::is_same<EPol, loop_exec>::value,
+                "RecursiveTile supports seq_exec, loop_exec, "
+                "omp_parallel_for_exec, tbb_for_static and tbb_for_dynamic");
+
+  template <typename Data>
+  static RAJA_INLINE void exec(Data &data)
+  {
+    RecursiveTiler<ArgList<ArgumentIds...>,
+                   LeafSize,
+                   Types,
+                   EnclosedStmts...>::recurse(data, RecursiveTileSeqSpawner{});
+  }
+};
+
+}  // end namespace internal
+}  // end namespace RAJA
+
+#endif /* RAJA_pattern_kernel_RecursiveTile_HPP */
@@ -34,8 +34,18 @@ namespace statement
 
 /*!
  * A RAJA::kernel statement that implements a reduction of a Param.
- * This reduces a value down to a "root" thread, and then only executes
- * the enclosed statements on the thread which contains the reduced value.
+ *
+ * On GPU policies this reduces a value down to a "root" thread, and then
+ * only executes the enclosed statements on the thread which contains the
+ * reduced value.
+ *
+ * On host policies (omp_reduce, tbb_reduce) the enclosed statements are
+ * executed by the calling thread, and every private copy of the loop data
+ * made by a parallel For, Collapse or Region inside them holds a per-thread
+ * partial that starts at the identity of ReduceOperator. The partials are
+ * combined into the Param after each enclosed statement, so later enclosed
+ * statements, and the statements following the Reduce, see the reduced
+ * value.
  *
  */
 template <typename ReducePolicy,
@@ -54,6 +64,153 @@ struct Reduce : public internal::Statement<camp::nil, EnclosedStmts...> {
 
 }  // end namespace statement
 
+namespace internal
+{
+
+template <typename Data, typename ParamId, typename Partials>
+struct ReduceLoopData;
+
+/*!
+ * Tags a copy of a ReduceLoopData that is the root of a nested host
+ * statement::Reduce, so none of its layers is a partial.
+ */
+template <typename Data>
+struct ReduceRootCopy {
+  Data const &data;
+};
+
+template <typename Data>
+RAJA_INLINE Data const &reduce_root_copy(Data const &data)
+{
+  return data;
+}
+
+template <typename Data, typename ParamId, typename Partials>
+RAJA_INLINE ReduceRootCopy<ReduceLoopData<Data, ParamId, Partials>>
+reduce_root_copy(ReduceLoopData<Data, ParamId, Partials> const &data)
+{
+  return {data};
+}
+
+/*!
+ * Loop data used by host statement::Reduce executors.
+ *
+ * Copies made by the enclosed statements (e.g. thread privatization) start
+ * the Param at the identity and hand their partial to Partials when they
+ * are destroyed, the same way host reducer objects combine into their
+ * parent. When Data is itself a ReduceLoopData (nested Reduce statements)
+ * the root keeps the enclosing Params and partials of data as they are.
+ */
+template <typename Data, typename ParamId, typename Partials>
+struct ReduceLoopData : public Data {
+
+  Partials *partials;
+  bool is_partial;
+
+  RAJA_INLINE
+  ReduceLoopData(Data const &data, Partials *p)
+      : Data(reduce_root_copy(data)), partials(p), is_partial(false)
+  {
+  }
+
+  RAJA_INLINE
+  ReduceLoopData(ReduceRootCopy<ReduceLoopData> root)
+      : Data(reduce_root_copy(static_cast<Data const &>(root.data))),
+        partials(root.data.partials),
+        is_partial(false)
+  {
+  }
+
+  RAJA_INLINE
+  ReduceLoopData(ReduceLoopData const &other)
+      : Data(other), partials(other.partials), is_partial(true)
+  {
+    this->template assign_param<ParamId>(Partials::identity());
+  }
+
+  RAJA_INLINE
+  ReduceLoopData(ReduceLoopData &&other)
+      : Data(other), partials(other.partials), is_partial(true)
+  {
+    other.template assign_param<ParamId>(Partials::identity());
+  }
+
+  RAJA_INLINE
+  ~ReduceLoopData()
+  {
+    if (is_partial) {
+      partials->combine(this->template get_param<ParamId>());
+    }
+  }
+
+  //! combine the partials of destroyed copies into the Param
+  RAJA_INLINE
+  void fold()
+  {
+    this->template assign_param<ParamId>(
+        Partials::op(this->template get_param<ParamId>(), partials->take()));
+  }
+};
+
+
+template <typename Data>
+RAJA_INLINE void copy_reduced_params(Data &, Data &)
+{
+}
+
+//! copies the Params of the Reduce statements enclosing a nested Reduce
+template <typename Data, typename ParamId, typename Partials>
+RAJA_INLINE void copy_reduced_params(
+    ReduceLoopData<Data, ParamId, Partials> &to,
+    ReduceLoopData<Data, ParamId, Partials> &from)
+{
+  to.template assign_param<ParamId>(from.template get_param<ParamId>());
+  copy_reduced_params(static_cast<Data &>(to), static_cast<Data &>(from));
+}
+
+
+template <typename Types, typename Data>
+RAJA_INLINE void execute_reduce_statements(Data &, camp::list<>)
+{
+}
+
+template <typename Types, typename Data, typename Stmt, typename... Stmts>
+RAJA_INLINE void execute_reduce_statements(Data &data,
+                                           camp::list<Stmt, Stmts...>)
+{
+  execute_statement_list<camp::list<Stmt>, Types>(data);
+  data.fold();
+  execute_reduce_statements<Types>(data, camp::list<Stmts...>{});
+}
+
+/*!
+ * Runs the enclosed statements of a host statement::Reduce on a
+ * ReduceLoopData, then copies the reduced Param back to data, along with
+ * the Params of any enclosing host Reduce so their updates made by the
+ * calling thread are kept.
+ */
+template <typename Partials,
+          typename ParamId,
+          typename Types,
+          typename... EnclosedStmts,
+          typename Data>
+RAJA_INLINE void execute_host_reduce(Data &data,
+                                     camp::list<EnclosedStmts...> stmts)
+{
+  using data_t = camp::decay<Data>;
+
+  Partials partials;
+  ReduceLoopData<data_t, ParamId, Partials> reduce_data(data, &partials);
+
+  execute_reduce_statements<Types>(reduce_data, stmts);
+
+  data.template assign_param<ParamId>(
+      reduce_data.template get_param<ParamId>());
+  copy_reduced_params(data, static_cast<data_t &>(reduce_data));
+}
+
+}  // namespace internal
+
 
 }  // end namespace RAJA
 
@@ -0,0 +1,358 @@
+/*!
+******************************************************************************
+*
+* \file
+*
+* \brief   Header file providing RAJA sort permutation (argsort), gather and
+*          apply permutation patterns, which reorder data by sorting only
+*          keys and indices and then moving each record once.
+*
+******************************************************************************
+*/
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-20, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/COPYRIGHT file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#ifndef RAJA_permutation_HPP
+#define RAJA_permutation_HPP
+
+#include "RAJA/config.hpp"
+
+#include <iterator>
+#include <memory>
+#include <new>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+
+#include "camp/camp.hpp"
+#include "camp/tuple.hpp"
+
+#include "RAJA/index/RangeSegment.hpp"
+#include "RAJA/internal/MemUtils_CPU.hpp"
+#include "RAJA/pattern/detail/algorithm.hpp"
+#include "RAJA/pattern/forall.hpp"
+#include "RAJA/pattern/sort.hpp"
+#include "RAJA/policy/PolicyBase.hpp"
+#include "RAJA/util/Operators.hpp"
+#include "RAJA/util/concepts.hpp"
+#include "RAJA/util/macros.hpp"
+
+namespace RAJA
+{
+
+namespace detail
+{
+
+//! number of elements apply_permutation moves per block
+constexpr Index_type permutation_block_size = 1024;
+
+//! uninitialized host storage for n objects of type T
+template <typename T>
+using PermutationBuffer = std::unique_ptr<T, FreeAligned>;
+
+template <typename T>
+PermutationBuffer<T> makePermutationBuffer(Index_type n)
+{
+  PermutationBuffer<T> buf(
+      RAJA::allocate_aligned_type<T>(RAJA::DATA_ALIGN, n * sizeof(T)));
+  if (n > 0 && buf.get() == nullptr) {
+    RAJA_ABORT_OR_THROW("permutation temporary memory allocation failed");
+  }
+  return buf;
+}
+
+template <typename PermIter, typename Iter, typename T>
+RAJA_INLINE void gatherBlock(PermIter perm,
+                             Iter src,
+                             T *buf,
+                             Index_type lo,
+                             Index_type hi)
+{
+  for (Index_type i = lo; i < hi; ++i) {
+    new (&buf[i]) T(std::move(src[perm[i]]));
+  }
+}
+
+template <typename Iter, typename T>
+RAJA_INLINE void moveBack(Iter dst, T *buf, Index_type i)
+{
+  dst[i] = std::move(buf[i]);
+  buf[i].~T();
+}
+
+template <typename ExecPolicy,
+          typename PermIter,
+          typename... Iters,
+          camp::idx_t... Is>
+void applyPermutation(PermIter perm,
+                      Index_type n,
+                      camp::idx_seq<Is...>,
+                      Iters... arrays)
+{
+  // objects in the buffers are destroyed as they are moved back
+  std::tuple<PermutationBuffer<RAJA::detail::IterVal<Iters>>...> owners(
+      makePermutationBuffer<RAJA::detail::IterVal<Iters>>(n)...);
+
+  auto bufs = camp::make_tuple(std::get<Is>(owners).get()...);
+  auto iters = camp::make_tuple(arrays...);
+
+  const Index_type num_blocks =
+      (n + permutation_block_size - 1) / permutation_block_size;
+
+  // one pass over the permutation, each block of it gathering every array
+  RAJA::forall<ExecPolicy>(TypedRangeSegment<Index_type>(0, num_blocks),
+                           [=](Index_type b) {
+    const Index_type lo = b * permutation_block_size;
+    const Index_type hi =
+        (lo + permutation_block_size < n) ? lo + permutation_block_size : n;
+
+    int dummy[] = {0, (gatherBlock(perm, camp::get<Is>(iters),
+                                   camp::get<Is>(bufs), lo, hi),
+                       0)...};
+    RAJA_UNUSED_VAR(dummy);
+  });
+
+  RAJA::forall<ExecPolicy>(TypedRangeSegment<Index_type>(0, n),
+                           [=](Index_type i) {
+    int dummy[] = {0, (moveBack(camp::get<Is>(iters), camp::get<Is>(bufs), i),
+                       0)...};
+    RAJA_UNUSED_VAR(dummy);
+  });
+}
+
+}  // namespace detail
+
+/*!
+******************************************************************************
+*
+* \brief  sort permutation (argsort) execution pattern
+*
+* Writes to perm the indices of the keys in sorted order, so key
+* keys_begin[perm[i]] is the i-th smallest. The keys are not modified. Only
+* a copy of the keys and the indices are moved by the sort, which is stable,
+* so records can be reordered afterwards with a single gather or
+* apply_permutation.
+*
+* \param[in] p Execution policy, a host policy
+* \param[in] keys_begin Pointer or Random-Access Iterator to start of keys range
+* \param[in] keys_end Pointer or Random-Access Iterator to end of keys range
+* \param[out] perm_begin Pointer or Random-Access Iterator to start of
+*                        integral permutation range
+* \param[in] comp comparison function to apply to keys
+*
+******************************************************************************
+*/
+template <typename ExecPolicy,
+          typename KeyIter,
+          typename PermIter,
+          typename Compare = operators::less<RAJA::detail::IterVal<KeyIter>>>
+concepts::enable_if<type_traits::is_execution_policy<ExecPolicy>,
+                    type_traits::is_iterator<KeyIter>,
+                    type_traits::is_iterator<PermIter>>
+sort_permutation(const ExecPolicy &p,
+                 KeyIter keys_begin,
+                 KeyIter keys_end,
+                 PermIter perm_begin,
+                 Compare comp = Compare{})
+{
+  using K = RAJA::detail::IterVal<KeyIter>;
+  using P = RAJA::detail::IterVal<PermIter>;
+  static_assert(type_traits::is_binary_function<Compare, bool, K, K>::value,
+                "Compare must model BinaryFunction");
+  static_assert(type_traits::is_random_access_iterator<KeyIter>::value,
+                "Keys Iterator must model RandomAccessIterator");
+  static_assert(type_traits::is_random_access_iterator<PermIter>::value,
+                "Perm Iterator must model RandomAccessIterator");
+  static_assert(std::is_integral<P>::value,
+                "Permutation values must be integral");
+
+  const Index_type n = keys_end - keys_begin;
+
+  detail::PermutationBuffer<K> keys = detail::makePermutationBuffer<K>(n);
+  K *keys_copy = keys.get();
+
+  RAJA::forall<ExecPolicy>(TypedRangeSegment<Index_type>(0, n),
+                           [=](Index_type i) {
+    new (&keys_copy[i]) K(keys_begin[i]);
+    perm_begin[i] = static_cast<P>(i);
+  });
+
+  RAJA::stable_sort_pairs(p, keys_copy, keys_copy + n, perm_begin, comp);
+
+  if (!std::is_trivially_destructible<K>::value) {
+    RAJA::forall<ExecPolicy>(TypedRangeSegment<Index_type>(0, n),
+                             [=](Index_type i) { keys_copy[i].~K(); });
+  }
+}
+
+/*!
+******************************************************************************
+*
+* \brief  sort permutation (argsort) execution pattern
+*
+* \param[in] p Execution policy, a host policy
+* \param[in] keys RandomAccess Container or range of keys
+* \param[out] perm RandomAccess Container or range of integral permutation
+*                  values, at least as long as keys
+* \param[in] comp comparison function to apply to keys
+*
+******************************************************************************
+*/
+template <typename ExecPolicy,
+          typename KeyContainer,
+          typename PermContainer,
+          typename Compare = operators::less<RAJA::detail::ContainerVal<KeyContainer>>>
+concepts::enable_if<type_traits::is_execution_policy<ExecPolicy>,
+                    type_traits::is_range<KeyContainer>,
+                    type_traits::is_range<PermContainer>>
+sort_permutation(const ExecPolicy &p,
+                 KeyContainer &keys,
+                 PermContainer &perm,
+                 Compare comp = Compare{})
+{
+  static_assert(type_traits::is_random_access_range<KeyContainer>::value,
+                "KeyContainer must model RandomAccessRange");
+  static_assert(type_traits::is_random_access_range<PermContainer>::value,
+                "PermContainer must model RandomAccessRange");
+  sort_permutation(p, std::begin(keys), std::end(keys), std::begin(perm), comp);
+}
+
+/*!
+******************************************************************************
+*
+* \brief  argsort execution pattern, same as sort_permutation
+*
+******************************************************************************
+*/
+template <typename ExecPolicy, typename... Args>
+concepts::enable_if<type_traits::is_execution_policy<ExecPolicy>>
+argsort(const ExecPolicy &p, Args &&... args)
+{
+  sort_permutation(p, std::forward<Args>(args)...);
+}
+
+/*!
+******************************************************************************
+*
+* \brief  gather execution pattern
+*
+* Sets dst_begin[i] = src_begin[perm_begin[i]] for every i in the
+* permutation range. dst must not overlap src.
+*
+* \param[in] p Execution policy
+* \param[in] perm_begin Pointer or Random-Access Iterator to start of
+*                       permutation range
+* \param[in] perm_end Pointer or Random-Access Iterator to end of
+*                     permutation range
+* \param[in] src_begin Pointer or Random-Access Iterator to start of source
+* \param[out] dst_begin Pointer or Random-Access Iterator to start of
+*                       destination
+*
+******************************************************************************
+*/
+template <typename ExecPolicy,
+          typename PermIter,
+          typename SrcIter,
+          typename DstIter>
+concepts::enable_if<type_traits::is_execution_policy<ExecPolicy>,
+                    type_traits::is_iterator<PermIter>,
+                    type_traits::is_iterator<SrcIter>,
+                    type_traits::is_iterator<DstIter>>
+gather(const ExecPolicy &,
+       PermIter perm_begin,
+       PermIter perm_end,
+       SrcIter src_begin,
+       DstIter dst_begin)
+{
+  static_assert(type_traits::is_random_access_iterator<PermIter>::value,
+                "Perm Iterator must model RandomAccessIterator");
+  static_assert(type_traits::is_random_access_iterator<SrcIter>::value,
+                "Src Iterator must model RandomAccessIterator");
+  static_assert(type_traits::is_random_access_iterator<DstIter>::value,
+                "Dst Iterator must model RandomAccessIterator");
+
+  RAJA::forall<ExecPolicy>(
+      TypedRangeSegment<Index_type>(0, perm_end - perm_begin),
+      [=](Index_type i) { dst_begin[i] = src_begin[perm_begin[i]]; });
+}
+
+/*!
+******************************************************************************
+*
+* \brief  apply permutation execution pattern
+*
+* Reorders each array in place so that its element i becomes its former
+* element perm_begin[i]. All arrays are gathered in one pass over the
+* permutation in blocks, each block moving the elements of every array,
+* into temporary host storage the size of the arrays, and are then moved
+* back in a second parallel pass.
+*
+* \param[in] p Execution policy, a host policy
+* \param[in] perm_begin Pointer or Random-Access Iterator to start of
+*                       permutation range
+* \param[in] perm_end Pointer or Random-Access Iterator to end of
+*                     permutation range
+* \param[in,out] arrays Pointers or Random-Access Iterators to start of the
+*                       arrays to reorder
+*
+******************************************************************************
+*/
+template <typename ExecPolicy, typename PermIter, typename... Iters>
+concepts::enable_if<type_traits::is_execution_policy<ExecPolicy>,
+                    type_traits::is_iterator<PermIter>>
+apply_permutation(const ExecPolicy &,
+                  PermIter perm_begin,
+                  PermIter perm_end,
+                  Iters... arrays)
+{
+  static_assert(type_traits::is_random_access_iterator<PermIter>::value,
+                "Perm Iterator must model RandomAccessIterator");
+  static_assert(
+      concepts::all_of<type_traits::is_random_access_iterator<Iters>...>::value,
+      "Array Iterators must model RandomAccessIterator");
+
+  detail::applyPermutation<ExecPolicy>(perm_begin,
+                                       perm_end - perm_begin,
+                                       camp::make_idx_seq_t<sizeof...(Iters)>{},
+                                       arrays...);
+}
+
+
+// =============================================================================
+
+template <typename ExecPolicy, typename... Args>
+concepts::enable_if<type_traits::is_execution_policy<ExecPolicy>>
+sort_permutation(Args &&... args)
+{
+  sort_permutation(ExecPolicy{}, std::forward<Args>(args)...);
+}
+
+template <typename ExecPolicy, typename... Args>
+concepts::enable_if<type_traits::is_execution_policy<ExecPolicy>>
+argsort(Args &&... args)
+{
+  sort_permutation(ExecPolicy{}, std::forward<Args>(args)...);
+}
+
+template <typename ExecPolicy, typename... Args>
+concepts::enable_if<type_traits::is_execution_policy<ExecPolicy>>
+gather(Args &&... args)
+{
+  gather(ExecPolicy{}, std::forward<Args>(args)...);
+}
+
+template <typename ExecPolicy, typename... Args>
+concepts::enable_if<type_traits::is_execution_policy<ExecPolicy>>
+apply_permutation(Args &&... args)
+{
+  apply_permutation(ExecPolicy{}, std::forward<Args>(args)...);
+}
+
+}  // namespace RAJA
+
+#endif  // closing endif for header file include guard
@@ -0,0 +1,409 @@
+/*!
+******************************************************************************
+*
+* \file
+*
+* \brief   Header file providing RAJA sparse matrix patterns.
+*
+******************************************************************************
+*/
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-20, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/COPYRIGHT file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#ifndef RAJA_sparse_HPP
+#define RAJA_sparse_HPP
+
+#include "RAJA/config.hpp"
+
+#include <algorithm>
+#include <type_traits>
+#include <vector>
+
+#include "camp/camp.hpp"
+
+#include "RAJA/index/RangeSegment.hpp"
+
+#include "RAJA/pattern/forall.hpp"
+
+#include "RAJA/policy/PolicyBase.hpp"
+#include "RAJA/policy/loop/policy.hpp"
+#include "RAJA/policy/simd/policy.hpp"
+
+#include "RAJA/util/SparseView.hpp"
+#include "RAJA/util/concepts.hpp"
+#include "RAJA/util/macros.hpp"
+
+namespace RAJA
+{
+namespace impl
+{
+namespace sparse
+{
+
+/*!
+        \brief number of work partitions for single threaded host policies
+
+        Parallel back-ends provide their own overloads returning the number
+        of threads that will execute a forall over partitions.
+*/
+template <typename ExecPolicy>
+concepts::enable_if_t<int,
+                      concepts::any_of<type_traits::is_sequential_policy<ExecPolicy>,
+                                       type_traits::is_loop_policy<ExecPolicy>,
+                                       type_traits::is_simd_policy<ExecPolicy>>>
+num_partitions(const ExecPolicy&)
+{
+  return 1;
+}
+
+/*!
+        \brief policy used for the loop over partitions or chunks
+
+        The simd policy is applied to the lanes of a chunk instead, so the
+        outer loop must not be a simd loop as well. Other policies are
+        passed through by value so they keep their state (e.g. a TBB arena).
+*/
+template <typename ExecPolicy>
+RAJA_INLINE const ExecPolicy& outer_policy(const ExecPolicy& p)
+{
+  return p;
+}
+
+RAJA_INLINE ::RAJA::loop_exec outer_policy(const ::RAJA::simd_exec&)
+{
+  return ::RAJA::loop_exec{};
+}
+
+/*!
+        \brief find the merge path coordinate on a diagonal
+
+        The merge path merges the row end offsets with the nonzero indices,
+        so a diagonal splits the work (rows plus nonzeros) evenly without
+        regard to the length of individual rows. On return row is the
+        first row not yet finished and nz the first nonzero not yet
+        consumed at that diagonal.
+*/
+template <typename IndexType>
+RAJA_INLINE void merge_path_search(IndexType diagonal,
+                                   IndexType const* row_ptr,
+                                   IndexType num_rows,
+                                   IndexType nnz,
+                                   IndexType& row,
+                                   IndexType& nz)
+{
+  const IndexType base = row_ptr[0];
+  IndexType lo = diagonal > nnz ? diagonal - nnz : IndexType(0);
+  IndexType hi = diagonal < num_rows ? diagonal : num_rows;
+  while (lo < hi) {
+    const IndexType mid = lo + (hi - lo) / 2;
+    if (row_ptr[mid + 1] - base <= diagonal - 1 - mid) {
+      lo = mid + 1;
+    } else {
+      hi = mid;
+    }
+  }
+  row = lo;
+  nz = diagonal - lo;
+}
+
+/*!
+        \brief CSR y = alpha * A * x + beta * y with merge path partitioning
+
+        Each partition walks an equal share of the merge path. Rows finished
+        inside a partition are written directly, the partial sum of a row
+        that continues into the next partition is carried out and added in a
+        sequential fix up pass.
+*/
+template <typename ExecPolicy,
+          typename ValueType,
+          typename IndexType,
+          typename XType,
+          typename YType,
+          typename ScalarType>
+void csr_spmv(const ExecPolicy& p,
+              CSRView<ValueType, IndexType> const& A,
+              XType const* x,
+              YType* y,
+              ScalarType alpha,
+              ScalarType beta)
+{
+  using accum_type = camp::decay<YType>;
+
+  const IndexType num_rows = A.num_rows;
+  const IndexType nnz = A.nnz();
+  const IndexType path_length = num_rows + nnz;
+  if (path_length == 0) {
+    return;
+  }
+
+  const IndexType parts = std::min<IndexType>(
+      std::max(num_partitions(p), 1), path_length);
+  const IndexType items = (path_length + parts - 1) / parts;
+
+  std::vector<IndexType> carry_row(parts);
+  std::vector<accum_type> carry_val(parts);
+  IndexType* carry_row_ptr = carry_row.data();
+  accum_type* carry_val_ptr = carry_val.data();
+
+  IndexType const* row_ptr = A.row_ptr;
+  IndexType const* col_idx = A.col_idx + row_ptr[0];
+  ValueType const* values = A.values + row_ptr[0];
+
+  RAJA::forall(
+      outer_policy(p),
+      TypedRangeSegment<IndexType>(0, parts), [=](IndexType part) {
+        const IndexType d_begin = std::min(part * items, path_length);
+        const IndexType d_end = std::min(d_begin + items, path_length);
+
+        IndexType row, nz, row_end, nz_end;
+        merge_path_search(d_begin, row_ptr, num_rows, nnz, row, nz);
+        merge_path_search(d_end, row_ptr, num_rows, nnz, row_end, nz_end);
+
+        accum_type sum = 0;
+        for (; row < row_end; ++row) {
+          const IndexType row_stop = row_ptr[row + 1] - row_ptr[0];
+          for (; nz < row_stop; ++nz) {
+            sum += values[nz] * x[col_idx[nz]];
+          }
+          y[row] = (beta == ScalarType(0)) ? accum_type(alpha * sum)
+                                           : accum_type(alpha * sum + beta * y[row]);
+          sum = 0;
+        }
+        for (; nz < nz_end; ++nz) {
+          sum += values[nz] * x[col_idx[nz]];
+        }
+
+        carry_row_ptr[part] = row_end;
+        carry_val_ptr[part] = sum;
+      });
+
+  for (IndexType part = 0; part < parts; ++part) {
+    if (carry_row[part] < num_rows) {
+      y[carry_row[part]] += alpha * carry_val[part];
+    }
+  }
+}
+
+/*!
+        \brief SELL-C-sigma y = alpha * A * x + beta * y
+
+        Chunks are distributed by the execution policy, the ChunkSize lanes
+        of a chunk are processed as a simd loop.
+*/
+template <typename ExecPolicy,
+          typename ValueType,
+          camp::idx_t ChunkSize,
+          typename IndexType,
+          typename XType,
+          typename YType,
+          typename ScalarType>
+void sell_spmv(const ExecPolicy& p,
+               SellView<ValueType, ChunkSize, IndexType> const& A,
+               XType const* x,
+               YType* y,
+               ScalarType alpha,
+               ScalarType beta)
+{
+  using accum_type = camp::decay<YType>;
+
+  const IndexType num_rows = A.num_rows;
+  IndexType const* chunk_ptr = A.chunk_ptr;
+  IndexType const* row_perm = A.row_perm;
+  IndexType const* col_idx = A.col_idx;
+  ValueType const* values = A.values;
+
+  RAJA::forall(
+      outer_policy(p),
+      TypedRangeSegment<IndexType>(0, A.num_chunks()), [=](IndexType c) {
+        accum_type sum[ChunkSize];
+        RAJA_SIMD
+        for (camp::idx_t l = 0; l < ChunkSize; ++l) {
+          sum[l] = 0;
+        }
+
+        const IndexType begin = chunk_ptr[c];
+        const IndexType end = chunk_ptr[c + 1];
+        for (IndexType k = begin; k < end; k += ChunkSize) {
+          RAJA_SIMD
+          for (camp::idx_t l = 0; l < ChunkSize; ++l) {
+            sum[l] += values[k + l] * x[col_idx[k + l]];
+          }
+        }
+
+        const IndexType lanes =
+            std::min<IndexType>(ChunkSize, num_rows - c * ChunkSize);
+        for (IndexType l = 0; l < lanes; ++l) {
+          const IndexType row = row_perm[c * ChunkSize + l];
+          y[row] = (beta == ScalarType(0)) ? accum_type(alpha * sum[l])
+                                           : accum_type(alpha * sum[l] + beta * y[row]);
+        }
+      });
+}
+
+/*!
+        \brief call body(row) for every row, partitioned by merge path
+
+        A row belongs to the partition in which its last nonzero is
+        consumed, so partitions hold similar numbers of rows plus nonzeros.
+*/
+template <typename ExecPolicy,
+          typename ValueType,
+          typename IndexType,
+          typename Body>
+void csr_forall_rows(const ExecPolicy& p,
+                     CSRView<ValueType, IndexType> const& A,
+                     Body body)
+{
+
+  const IndexType num_rows = A.num_rows;
+  const IndexType nnz = A.nnz();
+  const IndexType path_length = num_rows + nnz;
+  if (num_rows == 0) {
+    return;
+  }
+
+  const IndexType parts = std::min<IndexType>(
+      std::max(num_partitions(p), 1), num_rows);
+  const IndexType items = (path_length + parts - 1) / parts;
+  IndexType const* row_ptr = A.row_ptr;
+
+  RAJA::forall(
+      outer_policy(p),
+      TypedRangeSegment<IndexType>(0, parts), [=](IndexType part) {
+        const IndexType d_begin = std::min(part * items, path_length);
+        const IndexType d_end = std::min(d_begin + items, path_length);
+
+        IndexType row, nz, row_end, nz_end;
+        merge_path_search(d_begin, row_ptr, num_rows, nnz, row, nz);
+        merge_path_search(d_end, row_ptr, num_rows, nnz, row_end, nz_end);
+
+        for (; row < row_end; ++row) {
+          body(row);
+        }
+      });
+}
+
+}  // namespace sparse
+}  // namespace impl
+
+
+/*!
+******************************************************************************
+*
+* \brief  sparse matrix-vector product y = alpha * A * x + beta * y
+*
+* \param[in] p Execution policy
+* \param[in] A CSR matrix
+* \param[in] x input vector of A.num_cols entries
+* \param[in,out] y output vector of A.num_rows entries, not read if beta is 0
+* \param[in] alpha scale of the product
+* \param[in] beta scale of y
+*
+* Host parallel policies partition the nonzeros rather than the rows
+* (merge path), so skewed row lengths do not cause load imbalance.
+*
+******************************************************************************
+*/
+template <typename ExecPolicy,
+          typename ValueType,
+          typename IndexType,
+          typename XType,
+          typename YType,
+          typename ScalarType = camp::decay<YType>>
+concepts::enable_if<type_traits::is_execution_policy<ExecPolicy>>
+spmv(const ExecPolicy &p,
+     CSRView<ValueType, IndexType> const &A,
+     XType const *x,
+     YType *y,
+     ScalarType alpha = ScalarType(1),
+     ScalarType beta = ScalarType(0))
+{
+  impl::sparse::csr_spmv(p, A, x, y, alpha, beta);
+}
+
+/*!
+******************************************************************************
+*
+* \brief  sparse matrix-vector product y = alpha * A * x + beta * y
+*
+* \param[in] p Execution policy
+* \param[in] A SELL-C-sigma matrix
+* \param[in] x input vector of A.num_cols entries
+* \param[in,out] y output vector of A.num_rows entries, not read if beta is 0
+* \param[in] alpha scale of the product
+* \param[in] beta scale of y
+*
+* Chunks are distributed with the execution policy and the rows of a chunk
+* are computed as a simd loop; with simd_exec chunks run in order.
+*
+******************************************************************************
+*/
+template <typename ExecPolicy,
+          typename ValueType,
+          camp::idx_t ChunkSize,
+          typename IndexType,
+          typename XType,
+          typename YType,
+          typename ScalarType = camp::decay<YType>>
+concepts::enable_if<type_traits::is_execution_policy<ExecPolicy>>
+spmv(const ExecPolicy &p,
+     SellView<ValueType, ChunkSize, IndexType> const &A,
+     XType const *x,
+     YType *y,
+     ScalarType alpha = ScalarType(1),
+     ScalarType beta = ScalarType(0))
+{
+  impl::sparse::sell_spmv(p, A, x, y, alpha, beta);
+}
+
+/*!
+******************************************************************************
+*
+* \brief  row-wise execution over a CSR matrix
+*
+* \param[in] p Execution policy
+* \param[in] A CSR matrix
+* \param[in] body loop body called as body(row) once for every row
+*
+* Rows are partitioned so each thread gets a similar number of rows plus
+* nonzeros, instead of a similar number of rows.
+*
+******************************************************************************
+*/
+template <typename ExecPolicy,
+          typename ValueType,
+          typename IndexType,
+          typename Body>
+concepts::enable_if<type_traits::is_execution_policy<ExecPolicy>>
+sparse_forall_rows(const ExecPolicy &p,
+                   CSRView<ValueType, IndexType> const &A,
+                   Body &&body)
+{
+  impl::sparse::csr_forall_rows(p, A, std::forward<Body>(body));
+}
+
+
+// =============================================================================
+
+template <typename ExecPolicy, typename... Args>
+concepts::enable_if<type_traits::is_execution_policy<ExecPolicy>>
+spmv(Args &&... args)
+{
+  spmv(ExecPolicy{}, std::forward<Args>(args)...);
+}
+
+template <typename ExecPolicy, typename... Args>
+concepts::enable_if<type_traits::is_execution_policy<ExecPolicy>>
+sparse_forall_rows(Args &&... args)
+{
+  sparse_forall_rows(ExecPolicy{}, std::forward<Args>(args)...);
+}
+
+}  // namespace RAJA
+
+#endif  // closing endif for header file include guard
@@ -0,0 +1,255 @@
+/*!
+ ******************************************************************************
+ *
+ * \file
+ *
+ * \brief   Header file providing RAJA streaming forall, which runs a loop
+ *          over an array loaded chunk by chunk, reading the next chunk
+ *          while the current one is processed.
+ *
+ *             \code
+ *             RAJA::PreadFileReader<double> reader("data.bin");
+ *             RAJA::ReduceSum<reduce_policy, double> sum(0.0);
+ *             RAJA::stream_forall<exec_policy>(reader, chunk_length,
+ *                 [=](RAJA::Index_type i, double v) { sum += v; });
+ *             \endcode
+ *
+ ******************************************************************************
+ */
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-20, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/COPYRIGHT file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#ifndef RAJA_pattern_stream_HPP
+#define RAJA_pattern_stream_HPP
+
+#include "RAJA/config.hpp"
+
+#include <condition_variable>
+#include <exception>
+#include <mutex>
+#include <thread>
+#include <type_traits>
+#include <vector>
+
+#include "camp/camp.hpp"
+
+#include "RAJA/index/RangeSegment.hpp"
+
+#include "RAJA/pattern/forall.hpp"
+
+#include "RAJA/util/types.hpp"
+
+namespace RAJA
+{
+
+namespace detail
+{
+
+/*!
+ * One thread that loads the chunks requested by stream_chunks, one at a
+ * time. Errors from load are rethrown by wait.
+ */
+template <typename Reader>
+class StreamChunkLoader
+{
+  using T = typename Reader::value_type;
+
+public:
+  StreamChunkLoader(Reader const& reader,
+                    Index_type chunk_length,
+                    Index_type len)
+      : m_reader(reader),
+        m_chunk_length(chunk_length),
+        m_len(len),
+        m_thread(&StreamChunkLoader::run, this)
+  {
+  }
+
+  StreamChunkLoader(StreamChunkLoader const&) = delete;
+  StreamChunkLoader& operator=(StreamChunkLoader const&) = delete;
+
+  //! finishes a pending load before returning
+  ~StreamChunkLoader()
+  {
+    {
+      std::lock_guard<std::mutex> lock(m_mutex);
+      m_stop = true;
+    }
+    m_cv.notify_all();
+    m_thread.join();
+  }
+
+  //! start loading the chunk at begin into buffer
+  void request(Index_type begin, T* buffer)
+  {
+    {
+      std::lock_guard<std::mutex> lock(m_mutex);
+      m_begin = begin;
+      m_buffer = buffer;
+      m_requested = true;
+      m_loaded = false;
+    }
+    m_cv.notify_all();
+  }
+
+  //! wait for the requested chunk and return a pointer to its values
+  const T* wait()
+  {
+    std::unique_lock<std::mutex> lock(m_mutex);
+    m_cv.wait(lock, [this]() { return m_loaded; });
+    if (m_error) {
+      std::exception_ptr error = m_error;
+      m_error = nullptr;
+      std::rethrow_exception(error);
+    }
+    return m_data;
+  }
+
+private:
+  void run()
+  {
+    std::unique_lock<std::mutex> lock(m_mutex);
+    for (;;) {
+      m_cv.wait(lock, [this]() { return m_requested || m_stop; });
+      if (m_requested) {
+        const Index_type begin = m_begin;
+        T* buffer = m_buffer;
+        m_requested = false;
+        lock.unlock();
+
+        const T* data = nullptr;
+        std::exception_ptr error;
+        try {
+          const Index_type n = (begin + m_chunk_length < m_len)
+                                   ? m_chunk_length
+                                   : m_len - begin;
+          data = m_reader.load(begin, n, buffer);
+        } catch (...) {
+          error = std::current_exception();
+        }
+
+        lock.lock();
+        m_data = data;
+        m_error = error;
+        m_loaded = true;
+        m_cv.notify_all();
+      } else {
+        return;
+      }
+    }
+  }
+
+  Reader const& m_reader;
+  const Index_type m_chunk_length;
+  const Index_type m_len;
+
+  std::mutex m_mutex;
+  std::condition_variable m_cv;
+  bool m_stop = false;
+  bool m_requested = false;
+  bool m_loaded = false;
+  Index_type m_begin = 0;
+  T* m_buffer = nullptr;
+  const T* m_data = nullptr;
+  std::exception_ptr m_error;
+
+  // started last, once the state above is initialized
+  std::thread m_thread;
+};
+
+}  // namespace detail
+
+/*!
+ ******************************************************************************
+ *
+ * \brief  Call body(begin, data, len) for consecutive chunks of the array
+ *         read by reader, where data points to the len values starting at
+ *         index begin.
+ *
+ * The reader provides value_type, size(), needs_buffer and
+ * load(begin, len, buffer), which returns a pointer to values
+ * [begin, begin + len) and may use buffer, of chunk_length values, to
+ * hold them. See RAJA::PreadFileReader and RAJA::MappedFileReader.
+ *
+ * The next chunk is loaded on a single helper thread, started once per
+ * call, while body runs on the current one, using two buffers in turn, so
+ * at most two chunks are resident. The data passed to body is only valid
+ * until it returns. Errors from load are rethrown by stream_chunks.
+ *
+ ******************************************************************************
+ */
+template <typename Reader, typename ChunkBody>
+void stream_chunks(Reader const& reader,
+                   Index_type chunk_length,
+                   ChunkBody&& body)
+{
+  using T = typename Reader::value_type;
+
+  const Index_type len = reader.size();
+  if (len <= 0) {
+    return;
+  }
+  if (chunk_length < 1) {
+    chunk_length = 1;
+  }
+  if (chunk_length > len) {
+    chunk_length = len;
+  }
+
+  // buffers are declared before the loader so a pending load finishes
+  // before they are released
+  const size_t buffer_length = Reader::needs_buffer ? chunk_length : 0;
+  std::vector<T> buffers[2] = {std::vector<T>(buffer_length),
+                               std::vector<T>(buffer_length)};
+
+  detail::StreamChunkLoader<Reader> loader(reader, chunk_length, len);
+  loader.request(0, buffers[0].data());
+
+  int b = 0;
+  for (Index_type begin = 0; begin < len; begin += chunk_length) {
+    const T* data = loader.wait();
+    const Index_type n =
+        (begin + chunk_length < len) ? chunk_length : len - begin;
+
+    if (begin + chunk_length < len) {
+      loader.request(begin + chunk_length, buffers[1 - b].data());
+    }
+
+    body(begin, data, n);
+    b = 1 - b;
+  }
+}
+
+/*!
+ ******************************************************************************
+ *
+ * \brief  Call body(i, value) for every value of the array read by reader,
+ *         running RAJA::forall with ExecPolicy over each chunk of
+ *         chunk_length values while the next chunk is read.
+ *
+ * Reductions and other objects captured by body accumulate across chunks
+ * as in a single forall. ExecPolicy must be a host policy.
+ *
+ ******************************************************************************
+ */
+template <typename ExecPolicy, typename Reader, typename Body>
+void stream_forall(Reader const& reader, Index_type chunk_length, Body body)
+{
+  using T = typename Reader::value_type;
+
+  stream_chunks(reader,
+                chunk_length,
+                [&body](Index_type begin, T const* data, Index_type n) {
+    RAJA::forall<ExecPolicy>(TypedRangeSegment<Index_type>(0, n),
+                             [=](Index_type i) { body(begin + i, data[i]); });
+  });
+}
+
+}  // namespace RAJA
+
+#endif  // closing endif for header file include guard
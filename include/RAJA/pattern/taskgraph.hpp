@@ -0,0 +1,458 @@
+/*!
+ ******************************************************************************
+ *
+ * \file
+ *
+ * \brief   Header file containing the RAJA TaskGraph API, which runs forall,
+ *          kernel and scan launches as tasks ordered by the data they read
+ *          and write.
+ *
+ *             \code
+ *             RAJA::TaskGraph<taskgraph_policy> graph;
+ *             graph.forall<exec_policy>(RAJA::task_in(a), RAJA::task_out(b),
+ *                                       segment, body);
+ *             graph.execute();
+ *             \endcode
+ *
+ ******************************************************************************
+ */
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-20, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/COPYRIGHT file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#ifndef RAJA_pattern_taskgraph_HPP
+#define RAJA_pattern_taskgraph_HPP
+
+#include "RAJA/config.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <memory>
+#include <type_traits>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include "camp/camp.hpp"
+
+#include "RAJA/pattern/forall.hpp"
+#include "RAJA/pattern/kernel.hpp"
+#include "RAJA/pattern/scan.hpp"
+
+#include "RAJA/util/macros.hpp"
+#include "RAJA/util/types.hpp"
+
+namespace RAJA
+{
+
+namespace detail
+{
+
+//! address identifying the data behind a pointer
+template <typename T>
+void const* taskDataKey(T* ptr)
+{
+  return ptr;
+}
+
+//! address identifying the data behind a View
+template <typename V>
+auto taskDataKey(V const& view)
+    -> decltype(static_cast<void const*>(view.get_data()))
+{
+  return view.get_data();
+}
+
+//! address identifying the data behind a contiguous container
+template <typename C>
+auto taskDataKey(C const& container)
+    -> decltype(static_cast<void const*>(container.data()))
+{
+  return container.data();
+}
+
+//! data accessed by a task, identified by address
+struct TaskData {
+  std::vector<void const*> keys;
+};
+
+//! recorded task, run() executes its launch
+struct TaskNode {
+  virtual ~TaskNode() {}
+
+  virtual void run() = 0;
+
+  //! tasks that depend on this one
+  std::vector<size_t> successors;
+
+  //! number of tasks this one depends on
+  int num_predecessors = 0;
+
+  //! predecessors not yet finished while the graph executes
+  std::atomic<int> remaining{0};
+};
+
+//! task calling m_func with the stored arguments
+template <typename Func, typename... Args>
+struct TaskCallNode : TaskNode {
+  template <typename F, typename... As>
+  TaskCallNode(F&& func, As&&... args)
+      : m_func(std::forward<F>(func)), m_args(std::forward<As>(args)...)
+  {
+  }
+
+  void run() override { call(camp::make_idx_seq_t<sizeof...(Args)>{}); }
+
+  template <camp::idx_t... Is>
+  void call(camp::idx_seq<Is...>)
+  {
+    m_func(camp::get<Is>(m_args)...);
+  }
+
+  Func m_func;
+  camp::tuple<Args...> m_args;
+};
+
+template <typename ExecPolicy>
+struct TaskForall {
+  template <typename Segment, typename Body>
+  void operator()(Segment const& segment, Body const& body) const
+  {
+    RAJA::forall<ExecPolicy>(segment, body);
+  }
+};
+
+template <typename KernelPolicy>
+struct TaskKernel {
+  template <typename SegmentTuple, typename... Bodies>
+  void operator()(SegmentTuple const& segments, Bodies const&... bodies) const
+  {
+    RAJA::kernel<KernelPolicy>(segments, bodies...);
+  }
+};
+
+template <typename ExecPolicy>
+struct TaskInclusiveScan {
+  template <typename... Args>
+  void operator()(Args const&... args) const
+  {
+    RAJA::inclusive_scan<ExecPolicy>(args...);
+  }
+};
+
+template <typename ExecPolicy>
+struct TaskExclusiveScan {
+  template <typename... Args>
+  void operator()(Args const&... args) const
+  {
+    RAJA::exclusive_scan<ExecPolicy>(args...);
+  }
+};
+
+template <typename ExecPolicy>
+struct TaskInclusiveScanInplace {
+  template <typename... Args>
+  void operator()(Args const&... args) const
+  {
+    RAJA::inclusive_scan_inplace<ExecPolicy>(args...);
+  }
+};
+
+template <typename ExecPolicy>
+struct TaskExclusiveScanInplace {
+  template <typename... Args>
+  void operator()(Args const&... args) const
+  {
+    RAJA::exclusive_scan_inplace<ExecPolicy>(args...);
+  }
+};
+
+}  // namespace detail
+
+//! Data read by a task.
+struct TaskIn : detail::TaskData {
+};
+
+//! Data written by a task.
+struct TaskOut : detail::TaskData {
+};
+
+/*!
+ * \brief Declare the data a task reads. Each argument is a pointer, a
+ *        View or a contiguous container, identified by its data address.
+ */
+template <typename... Data>
+TaskIn task_in(Data const&... data)
+{
+  TaskIn in;
+  in.keys = {detail::taskDataKey(data)...};
+  return in;
+}
+
+/*!
+ * \brief Declare the data a task writes. Data that is read and written is
+ *        passed to both task_in and task_out.
+ */
+template <typename... Data>
+TaskOut task_out(Data const&... data)
+{
+  TaskOut out;
+  out.keys = {detail::taskDataKey(data)...};
+  return out;
+}
+
+/*!
+ ******************************************************************************
+ *
+ * \brief  Records forall, kernel and scan launches as tasks and runs them
+ *         concurrently where the data they access allows.
+ *
+ * Each task declares the data it reads with task_in and the data it
+ * writes with task_out. A task depends on the last earlier task writing
+ * data it reads or writes, and on the earlier tasks reading data it
+ * writes since that write. Data is identified by its address only: views
+ * of the same array through different base pointers, or overlapping
+ * parts of an array, are not detected as the same data and need an
+ * explicit add_dependence.
+ *
+ * Launches are copied into the graph with their segments, bodies and
+ * arguments, and are run with their own execution policies each time the
+ * graph is executed. Scan arguments are stored by value, so scans take
+ * iterators rather than containers.
+ *
+ * TASKGRAPH_POLICY_T selects the backend. seq_taskgraph runs the tasks in
+ * the order they were added. omp_taskgraph runs each task as an OpenMP
+ * task and tbb_taskgraph in a tbb::task_group, as soon as all the tasks it
+ * depends on have finished. With omp_taskgraph, an OpenMP execution
+ * policy of a task opens a nested parallel region, which runs on one
+ * thread unless nested parallelism is enabled.
+ *
+ ******************************************************************************
+ */
+template <typename TASKGRAPH_POLICY_T>
+class TaskGraph
+{
+public:
+  using policy = TASKGRAPH_POLICY_T;
+
+  TaskGraph() = default;
+
+  TaskGraph(TaskGraph const&) = delete;
+  TaskGraph& operator=(TaskGraph const&) = delete;
+
+  TaskGraph(TaskGraph&&) = default;
+  TaskGraph& operator=(TaskGraph&&) = default;
+
+  //! Add a task calling func(). Returns the id of the task.
+  template <typename Func>
+  size_t task(TaskIn const& in, TaskOut const& out, Func&& func)
+  {
+    using node_t = detail::TaskCallNode<camp::decay<Func>>;
+    return push(in,
+                out,
+                std::unique_ptr<detail::TaskNode>(
+                    new node_t(std::forward<Func>(func))));
+  }
+
+  //! Add a task running RAJA::forall<ExecPolicy>(segment, body).
+  template <typename ExecPolicy, typename Segment, typename Body>
+  size_t forall(TaskIn const& in,
+                TaskOut const& out,
+                Segment&& segment,
+                Body&& body)
+  {
+    static_assert(type_traits::is_random_access_range<Segment>::value,
+                  "Segment does not model RandomAccessIterator");
+
+    using node_t = detail::TaskCallNode<detail::TaskForall<ExecPolicy>,
+                                        camp::decay<Segment>,
+                                        camp::decay<Body>>;
+    return push(in,
+                out,
+                std::unique_ptr<detail::TaskNode>(
+                    new node_t(detail::TaskForall<ExecPolicy>{},
+                               std::forward<Segment>(segment),
+                               std::forward<Body>(body))));
+  }
+
+  //! Add a task running RAJA::kernel<KernelPolicy>(segments, bodies...).
+  template <typename KernelPolicy, typename SegmentTuple, typename... Bodies>
+  size_t kernel(TaskIn const& in,
+                TaskOut const& out,
+                SegmentTuple&& segments,
+                Bodies&&... bodies)
+  {
+    using node_t = detail::TaskCallNode<detail::TaskKernel<KernelPolicy>,
+                                        camp::decay<SegmentTuple>,
+                                        camp::decay<Bodies>...>;
+    return push(in,
+                out,
+                std::unique_ptr<detail::TaskNode>(
+                    new node_t(detail::TaskKernel<KernelPolicy>{},
+                               std::forward<SegmentTuple>(segments),
+                               std::forward<Bodies>(bodies)...)));
+  }
+
+  //! Add a task running RAJA::inclusive_scan<ExecPolicy>(args...).
+  template <typename ExecPolicy, typename... Args>
+  size_t inclusive_scan(TaskIn const& in, TaskOut const& out, Args&&... args)
+  {
+    return push_call(in, out, detail::TaskInclusiveScan<ExecPolicy>{},
+                     std::forward<Args>(args)...);
+  }
+
+  //! Add a task running RAJA::exclusive_scan<ExecPolicy>(args...).
+  template <typename ExecPolicy, typename... Args>
+  size_t exclusive_scan(TaskIn const& in, TaskOut const& out, Args&&... args)
+  {
+    return push_call(in, out, detail::TaskExclusiveScan<ExecPolicy>{},
+                     std::forward<Args>(args)...);
+  }
+
+  //! Add a task running RAJA::inclusive_scan_inplace<ExecPolicy>(args...).
+  template <typename ExecPolicy, typename... Args>
+  size_t inclusive_scan_inplace(TaskIn const& in,
+                                TaskOut const& out,
+                                Args&&... args)
+  {
+    return push_call(in, out, detail::TaskInclusiveScanInplace<ExecPolicy>{},
+                     std::forward<Args>(args)...);
+  }
+
+  //! Add a task running RAJA::exclusive_scan_inplace<ExecPolicy>(args...).
+  template <typename ExecPolicy, typename... Args>
+  size_t exclusive_scan_inplace(TaskIn const& in,
+                                TaskOut const& out,
+                                Args&&... args)
+  {
+    return push_call(in, out, detail::TaskExclusiveScanInplace<ExecPolicy>{},
+                     std::forward<Args>(args)...);
+  }
+
+  ///
+  /// Make task after depend on task before, in addition to the
+  /// dependences found from the data they access. before must have been
+  /// added earlier than after.
+  ///
+  void add_dependence(size_t before, size_t after)
+  {
+    if (before >= after || after >= m_nodes.size()) {
+      RAJA_ABORT_OR_THROW("TaskGraph dependence must be on an earlier task");
+    }
+    add_edge(before, after);
+  }
+
+  //! Run the recorded tasks, returns when all have finished.
+  void execute()
+  {
+    if (!m_nodes.empty()) {
+      taskgraph_execute_impl(TASKGRAPH_POLICY_T(), m_nodes);
+    }
+  }
+
+  //! Remove all recorded tasks.
+  void clear()
+  {
+    m_nodes.clear();
+    m_data.clear();
+    m_num_dependences = 0;
+  }
+
+  //! Number of recorded tasks.
+  size_t size() const { return m_nodes.size(); }
+
+  //! Number of dependences between recorded tasks.
+  size_t num_dependences() const { return m_num_dependences; }
+
+  //! Tasks that directly depend on task id.
+  std::vector<size_t> const& successors(size_t id) const
+  {
+    return m_nodes[id]->successors;
+  }
+
+private:
+  //! last task writing some data and the tasks reading it since
+  struct DataState {
+    size_t writer = 0;
+    bool written = false;
+    std::vector<size_t> readers;
+  };
+
+  template <typename Func, typename... Args>
+  size_t push_call(TaskIn const& in,
+                   TaskOut const& out,
+                   Func&& func,
+                   Args&&... args)
+  {
+    using node_t =
+        detail::TaskCallNode<camp::decay<Func>, camp::decay<Args>...>;
+    return push(in,
+                out,
+                std::unique_ptr<detail::TaskNode>(new node_t(
+                    std::forward<Func>(func), std::forward<Args>(args)...)));
+  }
+
+  size_t push(TaskIn const& in,
+              TaskOut const& out,
+              std::unique_ptr<detail::TaskNode>&& node)
+  {
+    const size_t id = m_nodes.size();
+    m_nodes.push_back(std::move(node));
+
+    std::vector<size_t> preds;
+    for (void const* key : in.keys) {
+      DataState& state = m_data[key];
+      if (state.written) {
+        preds.push_back(state.writer);
+      }
+    }
+    for (void const* key : out.keys) {
+      DataState& state = m_data[key];
+      if (state.written) {
+        preds.push_back(state.writer);
+      }
+      preds.insert(preds.end(), state.readers.begin(), state.readers.end());
+    }
+
+    std::sort(preds.begin(), preds.end());
+    preds.erase(std::unique(preds.begin(), preds.end()), preds.end());
+    for (size_t pred : preds) {
+      add_edge(pred, id);
+    }
+
+    for (void const* key : in.keys) {
+      m_data[key].readers.push_back(id);
+    }
+    for (void const* key : out.keys) {
+      DataState& state = m_data[key];
+      state.writer = id;
+      state.written = true;
+      state.readers.clear();
+    }
+
+    return id;
+  }
+
+  void add_edge(size_t before, size_t after)
+  {
+    m_nodes[before]->successors.push_back(after);
+    ++m_nodes[after]->num_predecessors;
+    ++m_num_dependences;
+  }
+
+  std::vector<std::unique_ptr<detail::TaskNode>> m_nodes;
+
+  std::unordered_map<void const*, DataState> m_data;
+
+  size_t m_num_dependences = 0;
+};
+
+}  // namespace RAJA
+
+#include "RAJA/policy/sequential/taskgraph.hpp"
+
+#endif  // closing endif for header file include guard
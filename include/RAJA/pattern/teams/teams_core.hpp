@@ -264,6 +264,96 @@ RAJA_HOST_DEVICE RAJA_INLINE void loop(CONTEXT const &ctx,
 #endif
 }
 
+template <typename POLICY, typename SEGMENT>
+struct LoopICountExecute;
+
+/*!
+ * Same as loop, but the body also receives the local iteration count of
+ * each index, so body(idx, i) for a 1D segment and body(idx0, idx1, i0, i1)
+ * for two segments.
+ */
+template <typename POLICY_LIST,
+          typename CONTEXT,
+          typename SEGMENT,
+          typename BODY>
+RAJA_HOST_DEVICE RAJA_INLINE void loop_icount(CONTEXT const &ctx,
+                                              SEGMENT const &segment,
+                                              BODY const &body)
+{
+#if defined(RAJA_DEVICE_CODE)
+  LoopICountExecute<typename POLICY_LIST::device_policy_t, SEGMENT>::exec(
+      ctx, segment, body);
+#else
+  LoopICountExecute<typename POLICY_LIST::host_policy_t, SEGMENT>::exec(
+      ctx, segment, body);
+#endif
+}
+
+template <typename POLICY_LIST,
+          typename CONTEXT,
+          typename SEGMENT,
+          typename BODY>
+RAJA_HOST_DEVICE RAJA_INLINE void loop_icount(CONTEXT const &ctx,
+                                              SEGMENT const &segment0,
+                                              SEGMENT const &segment1,
+                                              BODY const &body)
+{
+#if defined(RAJA_DEVICE_CODE)
+  LoopICountExecute<typename POLICY_LIST::device_policy_t, SEGMENT>::exec(
+      ctx, segment0, segment1, body);
+#else
+  LoopICountExecute<typename POLICY_LIST::host_policy_t, SEGMENT>::exec(
+      ctx, segment0, segment1, body);
+#endif
+}
+
+template <typename POLICY_LIST,
+          typename CONTEXT,
+          typename SEGMENT,
+          typename BODY>
+RAJA_HOST_DEVICE RAJA_INLINE void loop_icount(CONTEXT const &ctx,
+                                              SEGMENT const &segment0,
+                                              SEGMENT const &segment1,
+                                              SEGMENT const &segment2,
+                                              BODY const &body)
+{
+#if defined(RAJA_DEVICE_CODE)
+  LoopICountExecute<typename POLICY_LIST::device_policy_t, SEGMENT>::exec(
+      ctx, segment0, segment1, segment2, body);
+#else
+  LoopICountExecute<typename POLICY_LIST::host_policy_t, SEGMENT>::exec(
+      ctx, segment0, segment1, segment2, body);
+#endif
+}
+
+template <typename POLICY, typename SEGMENT>
+struct TileExecute;
+
+/*!
+ * Splits the segment into tiles of tile_size iterations, the last one
+ * possibly shorter, and calls body(tile) with each tile as a segment of the
+ * same type. Tiles are distributed by the policy; the loops over a tile
+ * inside the body are unit stride.
+ */
+template <typename POLICY_LIST,
+          typename CONTEXT,
+          typename TILE_T,
+          typename SEGMENT,
+          typename BODY>
+RAJA_HOST_DEVICE RAJA_INLINE void tile(CONTEXT const &ctx,
+                                       TILE_T tile_size,
+                                       SEGMENT const &segment,
+                                       BODY const &body)
+{
+#if defined(RAJA_DEVICE_CODE)
+  TileExecute<typename POLICY_LIST::device_policy_t, SEGMENT>::exec(
+      ctx, tile_size, segment, body);
+#else
+  TileExecute<typename POLICY_LIST::host_policy_t, SEGMENT>::exec(
+      ctx, tile_size, segment, body);
+#endif
+}
+
 }  // namespace expt
 
 }  // namespace RAJA
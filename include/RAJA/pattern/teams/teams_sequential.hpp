@@ -21,6 +21,8 @@
 
 #include "RAJA/pattern/teams/teams_core.hpp"
 #include "RAJA/policy/loop/policy.hpp"
+#include "RAJA/policy/sequential/policy.hpp"
+#include "RAJA/policy/simd/policy.hpp"
 
 
 namespace RAJA
@@ -116,6 +118,364 @@ struct LoopExecute<loop_exec, SEGMENT> {
   }
 };
 
+template <typename SEGMENT>
+struct LoopExecute<seq_exec, SEGMENT> {
+
+  template <typename BODY>
+  static RAJA_INLINE void exec(LaunchContext const RAJA_UNUSED_ARG(&ctx),
+                               SEGMENT const &segment,
+                               BODY const &body)
+  {
+
+    const int len = segment.end() - segment.begin();
+    RAJA_NO_SIMD
+    for (int i = 0; i < len; i++) {
+
+      body(*(segment.begin() + i));
+    }
+  }
+
+  template <typename BODY>
+  static RAJA_INLINE void exec(LaunchContext const RAJA_UNUSED_ARG(&ctx),
+                               SEGMENT const &segment0,
+                               SEGMENT const &segment1,
+                               BODY const &body)
+  {
+
+    const int len1 = segment1.end() - segment1.begin();
+    const int len0 = segment0.end() - segment0.begin();
+
+    for (int j = 0; j < len1; j++) {
+      RAJA_NO_SIMD
+      for (int i = 0; i < len0; i++) {
+
+        body(*(segment0.begin() + i), *(segment1.begin() + j));
+      }
+    }
+  }
+
+  template <typename BODY>
+  static RAJA_INLINE void exec(LaunchContext const RAJA_UNUSED_ARG(&ctx),
+                               SEGMENT const &segment0,
+                               SEGMENT const &segment1,
+                               SEGMENT const &segment2,
+                               BODY const &body)
+  {
+
+    const int len2 = segment2.end() - segment2.begin();
+    const int len1 = segment1.end() - segment1.begin();
+    const int len0 = segment0.end() - segment0.begin();
+
+    for (int k = 0; k < len2; k++) {
+      for (int j = 0; j < len1; j++) {
+        RAJA_NO_SIMD
+        for (int i = 0; i < len0; i++) {
+          body(*(segment0.begin() + i),
+               *(segment1.begin() + j),
+               *(segment2.begin() + k));
+        }
+      }
+    }
+  }
+};
+
+template <typename SEGMENT>
+struct LoopExecute<simd_exec, SEGMENT> {
+
+  template <typename BODY>
+  static RAJA_INLINE void exec(LaunchContext const RAJA_UNUSED_ARG(&ctx),
+                               SEGMENT const &segment,
+                               BODY const &body)
+  {
+
+    const int len = segment.end() - segment.begin();
+    RAJA_SIMD
+    for (int i = 0; i < len; i++) {
+
+      body(*(segment.begin() + i));
+    }
+  }
+
+  template <typename BODY>
+  static RAJA_INLINE void exec(LaunchContext const RAJA_UNUSED_ARG(&ctx),
+                               SEGMENT const &segment0,
+                               SEGMENT const &segment1,
+                               BODY const &body)
+  {
+
+    const int len1 = segment1.end() - segment1.begin();
+    const int len0 = segment0.end() - segment0.begin();
+
+    for (int j = 0; j < len1; j++) {
+      RAJA_SIMD
+      for (int i = 0; i < len0; i++) {
+
+        body(*(segment0.begin() + i), *(segment1.begin() + j));
+      }
+    }
+  }
+
+  template <typename BODY>
+  static RAJA_INLINE void exec(LaunchContext const RAJA_UNUSED_ARG(&ctx),
+                               SEGMENT const &segment0,
+                               SEGMENT const &segment1,
+                               SEGMENT const &segment2,
+                               BODY const &body)
+  {
+
+    const int len2 = segment2.end() - segment2.begin();
+    const int len1 = segment1.end() - segment1.begin();
+    const int len0 = segment0.end() - segment0.begin();
+
+    for (int k = 0; k < len2; k++) {
+      for (int j = 0; j < len1; j++) {
+        RAJA_SIMD
+        for (int i = 0; i < len0; i++) {
+          body(*(segment0.begin() + i),
+               *(segment1.begin() + j),
+               *(segment2.begin() + k));
+        }
+      }
+    }
+  }
+};
+
+template <typename SEGMENT>
+struct LoopICountExecute<loop_exec, SEGMENT> {
+
+  template <typename BODY>
+  static RAJA_INLINE RAJA_HOST_DEVICE void exec(
+      LaunchContext const RAJA_UNUSED_ARG(&ctx),
+      SEGMENT const &segment,
+      BODY const &body)
+  {
+
+    const int len = segment.end() - segment.begin();
+    for (int i = 0; i < len; i++) {
+
+      body(*(segment.begin() + i), i);
+    }
+  }
+
+  template <typename BODY>
+  static RAJA_INLINE RAJA_HOST_DEVICE void exec(
+      LaunchContext const RAJA_UNUSED_ARG(&ctx),
+      SEGMENT const &segment0,
+      SEGMENT const &segment1,
+      BODY const &body)
+  {
+
+    const int len1 = segment1.end() - segment1.begin();
+    const int len0 = segment0.end() - segment0.begin();
+
+    for (int j = 0; j < len1; j++) {
+      for (int i = 0; i < len0; i++) {
+
+        body(*(segment0.begin() + i), *(segment1.begin() + j), i, j);
+      }
+    }
+  }
+
+  template <typename BODY>
+  static RAJA_INLINE RAJA_HOST_DEVICE void exec(
+      LaunchContext const RAJA_UNUSED_ARG(&ctx),
+      SEGMENT const &segment0,
+      SEGMENT const &segment1,
+      SEGMENT const &segment2,
+      BODY const &body)
+  {
+
+    const int len2 = segment2.end() - segment2.begin();
+    const int len1 = segment1.end() - segment1.begin();
+    const int len0 = segment0.end() - segment0.begin();
+
+    for (int k = 0; k < len2; k++) {
+      for (int j = 0; j < len1; j++) {
+        for (int i = 0; i < len0; i++) {
+          body(*(segment0.begin() + i),
+               *(segment1.begin() + j),
+               *(segment2.begin() + k),
+               i,
+               j,
+               k);
+        }
+      }
+    }
+  }
+};
+
+template <typename SEGMENT>
+struct LoopICountExecute<seq_exec, SEGMENT> {
+
+  template <typename BODY>
+  static RAJA_INLINE void exec(LaunchContext const RAJA_UNUSED_ARG(&ctx),
+                               SEGMENT const &segment,
+                               BODY const &body)
+  {
+
+    const int len = segment.end() - segment.begin();
+    RAJA_NO_SIMD
+    for (int i = 0; i < len; i++) {
+
+      body(*(segment.begin() + i), i);
+    }
+  }
+
+  template <typename BODY>
+  static RAJA_INLINE void exec(LaunchContext const RAJA_UNUSED_ARG(&ctx),
+                               SEGMENT const &segment0,
+                               SEGMENT const &segment1,
+                               BODY const &body)
+  {
+
+    const int len1 = segment1.end() - segment1.begin();
+    const int len0 = segment0.end() - segment0.begin();
+
+    for (int j = 0; j < len1; j++) {
+      RAJA_NO_SIMD
+      for (int i = 0; i < len0; i++) {
+
+        body(*(segment0.begin() + i), *(segment1.begin() + j), i, j);
+      }
+    }
+  }
+
+  template <typename BODY>
+  static RAJA_INLINE void exec(LaunchContext const RAJA_UNUSED_ARG(&ctx),
+                               SEGMENT const &segment0,
+                               SEGMENT const &segment1,
+                               SEGMENT const &segment2,
+                               BODY const &body)
+  {
+
+    const int len2 = segment2.end() - segment2.begin();
+    const int len1 = segment1.end() - segment1.begin();
+    const int len0 = segment0.end() - segment0.begin();
+
+    for (int k = 0; k < len2; k++) {
+      for (int j = 0; j < len1; j++) {
+        RAJA_NO_SIMD
+        for (int i = 0; i < len0; i++) {
+          body(*(segment0.begin() + i),
+               *(segment1.begin() + j),
+               *(segment2.begin() + k),
+               i,
+               j,
+               k);
+        }
+      }
+    }
+  }
+};
+
+template <typename SEGMENT>
+struct LoopICountExecute<simd_exec, SEGMENT> {
+
+  template <typename BODY>
+  static RAJA_INLINE void exec(LaunchContext const RAJA_UNUSED_ARG(&ctx),
+                               SEGMENT const &segment,
+                               BODY const &body)
+  {
+
+    const int len = segment.end() - segment.begin();
+    RAJA_SIMD
+    for (int i = 0; i < len; i++) {
+
+      body(*(segment.begin() + i), i);
+    }
+  }
+
+  template <typename BODY>
+  static RAJA_INLINE void exec(LaunchContext const RAJA_UNUSED_ARG(&ctx),
+                               SEGMENT const &segment0,
+                               SEGMENT const &segment1,
+                               BODY const &body)
+  {
+
+    const int len1 = segment1.end() - segment1.begin();
+    const int len0 = segment0.end() - segment0.begin();
+
+    for (int j = 0; j < len1; j++) {
+      RAJA_SIMD
+      for (int i = 0; i < len0; i++) {
+
+        body(*(segment0.begin() + i), *(segment1.begin() + j), i, j);
+      }
+    }
+  }
+
+  template <typename BODY>
+  static RAJA_INLINE void exec(LaunchContext const RAJA_UNUSED_ARG(&ctx),
+                               SEGMENT const &segment0,
+                               SEGMENT const &segment1,
+                               SEGMENT const &segment2,
+                               BODY const &body)
+  {
+
+    const int len2 = segment2.end() - segment2.begin();
+    const int len1 = segment1.end() - segment1.begin();
+    const int len0 = segment0.end() - segment0.begin();
+
+    for (int k = 0; k < len2; k++) {
+      for (int j = 0; j < len1; j++) {
+        RAJA_SIMD
+        for (int i = 0; i < len0; i++) {
+          body(*(segment0.begin() + i),
+               *(segment1.begin() + j),
+               *(segment2.begin() + k),
+               i,
+               j,
+               k);
+        }
+      }
+    }
+  }
+};
+
+template <typename SEGMENT>
+struct TileExecute<loop_exec, SEGMENT> {
+
+  template <typename TILE_T, typename BODY>
+  static RAJA_INLINE RAJA_HOST_DEVICE void exec(
+      LaunchContext const RAJA_UNUSED_ARG(&ctx),
+      TILE_T tile_size,
+      SEGMENT const &segment,
+      BODY const &body)
+  {
+
+    const int len = segment.end() - segment.begin();
+    for (int tx = 0; tx < len; tx += tile_size) {
+
+      body(segment.slice(tx, tile_size));
+    }
+  }
+};
+
+template <typename SEGMENT>
+struct TileExecute<seq_exec, SEGMENT> {
+
+  template <typename TILE_T, typename BODY>
+  static RAJA_INLINE void exec(LaunchContext const RAJA_UNUSED_ARG(&ctx),
+                               TILE_T tile_size,
+                               SEGMENT const &segment,
+                               BODY const &body)
+  {
+
+    const int len = segment.end() - segment.begin();
+    RAJA_NO_SIMD
+    for (int tx = 0; tx < len; tx += tile_size) {
+
+      body(segment.slice(tx, tile_size));
+    }
+  }
+};
+
+// tiles run in order, simd applies to the loops within each tile
+template <typename SEGMENT>
+struct TileExecute<simd_exec, SEGMENT>
+    : TileExecute<loop_exec, SEGMENT> {
+};
+
 }  // namespace expt
 
 }  // namespace RAJA
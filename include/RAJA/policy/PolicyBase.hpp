@@ -48,7 +48,8 @@ enum class Pattern {
   workgroup,
   workgroup_exec,
   workgroup_order,
-  workgroup_storage
+  workgroup_storage,
+  launch_graph
 };
 
 enum class Launch { undefined, sync, async };
@@ -121,6 +122,9 @@ namespace reduce
 struct ordered {
 };
 
+struct reproducible {
+};
+
 }  // namespace reduce
 
 
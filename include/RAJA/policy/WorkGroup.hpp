@@ -57,6 +57,29 @@ struct constant_stride_array_of_objects
                                   Pattern::workgroup_storage> {
 };
 
+/*!
+ * Storage policy for work groups whose loops are all known at compile time.
+ *
+ * Each of Loops is a workgroup_loop naming the segment and loop body type of
+ * a loop that may be enqueued. Loops are stored by value in a tagged union
+ * and called by dispatching on the tag, so there are no indirect calls.
+ */
+template < typename ... Loops >
+struct variant_array_of_objects
+    : RAJA::make_policy_pattern_t<Policy::undefined,
+                                  Pattern::workgroup_storage> {
+};
+
+/*!
+ * A loop that may be enqueued in a work group with variant_array_of_objects
+ * storage, given by its segment and loop body types.
+ */
+template < typename SEGMENT_T, typename LOOP_BODY_T >
+struct workgroup_loop {
+  using segment_type = SEGMENT_T;
+  using loop_body_type = LOOP_BODY_T;
+};
+
 template < typename EXEC_POLICY_T,
            typename ORDER_POLICY_T,
            typename STORAGE_POLICY_T >
@@ -82,6 +105,8 @@ using policy::workgroup::reverse_ordered;
 using policy::workgroup::array_of_pointers;
 using policy::workgroup::ragged_array_of_objects;
 using policy::workgroup::constant_stride_array_of_objects;
+using policy::workgroup::variant_array_of_objects;
+using policy::workgroup::workgroup_loop;
 
 using policy::workgroup::WorkGroupPolicy;
 
@@ -50,6 +50,15 @@
   RAJA::seq_atomic {}
 #endif
 
+// min-loc and max-loc are host only, so skip the device policies
+#if defined(RAJA_ENABLE_OPENMP)
+#define RAJA_AUTO_HOST_ATOMIC \
+  RAJA::omp_atomic {}
+#else
+#define RAJA_AUTO_HOST_ATOMIC \
+  RAJA::seq_atomic {}
+#endif
+
 
 namespace RAJA
 {
@@ -145,10 +154,29 @@ atomicCAS(auto_atomic, T volatile *acc, T compare, T value)
   return atomicCAS(RAJA_AUTO_ATOMIC, acc, compare, value);
 }
 
+template <typename T, typename IndexType>
+RAJA_INLINE ValLoc<T, IndexType> atomicMinLoc(
+    auto_atomic,
+    ValLoc<T, IndexType> volatile *acc,
+    ValLoc<T, IndexType> value)
+{
+  return atomicMinLoc(RAJA_AUTO_HOST_ATOMIC, acc, value);
+}
+
+template <typename T, typename IndexType>
+RAJA_INLINE ValLoc<T, IndexType> atomicMaxLoc(
+    auto_atomic,
+    ValLoc<T, IndexType> volatile *acc,
+    ValLoc<T, IndexType> value)
+{
+  return atomicMaxLoc(RAJA_AUTO_HOST_ATOMIC, acc, value);
+}
+
 
 }  // namespace RAJA
 
-// make sure this define doesn't bleed out of this header
+// make sure these defines don't bleed out of this header
 #undef RAJA_AUTO_ATOMIC
+#undef RAJA_AUTO_HOST_ATOMIC
 
 #endif
@@ -20,7 +20,14 @@
 
 #include "RAJA/config.hpp"
 
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <type_traits>
+
 #include "RAJA/util/TypeConvert.hpp"
+#include "RAJA/util/ValLoc.hpp"
 #include "RAJA/util/macros.hpp"
 
 #if defined(RAJA_ENABLE_HIP)
@@ -29,6 +36,12 @@
 #define RAJA_DEVICE_HIP
 #endif
 
+// 128-bit CAS for the host ValLoc operations
+#if defined(__x86_64__) && (defined(__GNUC__) || defined(__clang__)) && \
+    !defined(__CUDA_ARCH__) && !defined(__HIP_DEVICE_COMPILE__)
+#define RAJA_BUILTIN_ATOMIC_CAS16
+#endif
+
 namespace RAJA
 {
 
@@ -233,6 +246,197 @@ RAJA_DEVICE_HIP RAJA_INLINE T builtin_atomic_CAS_oper_sc(T volatile *acc,
 }
 
 
+#if defined(RAJA_BUILTIN_ATOMIC_CAS16)
+
+/*!
+ * 128-bit compare and swap of a 16-byte aligned location with cmpxchg16b.
+ * Returns true if value was stored, otherwise compare is updated to the
+ * value found at acc.
+ */
+RAJA_INLINE bool builtin_atomic_CAS16(void volatile *acc,
+                                      unsigned long long *compare,
+                                      unsigned long long const *value)
+{
+  bool swapped;
+  __asm__ __volatile__("lock cmpxchg16b %1\n\tsete %0"
+                       : "=q"(swapped),
+                         "+m"(*static_cast<unsigned long long volatile(*)[2]>(
+                             acc)),
+                         "+a"(compare[0]),
+                         "+d"(compare[1])
+                       : "b"(value[0]), "c"(value[1])
+                       : "memory", "cc");
+  return swapped;
+}
+
+#endif  // RAJA_BUILTIN_ATOMIC_CAS16
+
+
+/*!
+ * Number of 64-bit words a ValLoc is swapped as: 1 with the 64-bit CAS,
+ * 2 with the 128-bit CAS, 0 if it needs a lock. The value must lie in the
+ * first word for the 128-bit snapshot below.
+ */
+template <typename T, typename IndexType>
+struct builtin_valloc_words
+    : std::integral_constant<
+          int,
+          sizeof(ValLoc<T, IndexType>) == 8 ? 1
+#if defined(RAJA_BUILTIN_ATOMIC_CAS16)
+          : (sizeof(ValLoc<T, IndexType>) == 16 && sizeof(T) <= 8) ? 2
+#endif
+                                            : 0> {
+};
+
+//! Conversion between a ValLoc and the words it is swapped as
+template <typename T, typename IndexType>
+struct BuiltinValLocImage {
+  using pair = ValLoc<T, IndexType>;
+
+  //! padding is cleared so equal pairs have equal images
+  static void pack(pair const &p, unsigned long long *img)
+  {
+    std::memset(img, 0, sizeof(pair));
+    std::memcpy(img, &p.val, sizeof(T));
+    std::memcpy(reinterpret_cast<char *>(img) + offsetof(pair, loc),
+                &p.loc,
+                sizeof(IndexType));
+  }
+
+  static pair unpack(unsigned long long const *img)
+  {
+    pair p;
+    std::memcpy(&p.val, img, sizeof(T));
+    std::memcpy(&p.loc,
+                reinterpret_cast<char const *>(img) + offsetof(pair, loc),
+                sizeof(IndexType));
+    return p;
+  }
+};
+
+//! Spin lock, one cache line each
+struct alignas(64) BuiltinValLocLock {
+  std::atomic<bool> locked;
+};
+
+//! Striped locks for the ValLoc types that have no lock free CAS
+RAJA_INLINE BuiltinValLocLock &builtin_valloc_lock(void const volatile *acc)
+{
+  static BuiltinValLocLock locks[64];
+  return locks[(reinterpret_cast<std::uintptr_t>(acc) >> 4) % 64];
+}
+
+/*!
+ * Replaces *acc with value if better(value, *acc) under a striped lock.
+ * Returns the pair at acc before this operation.
+ */
+template <typename T, typename IndexType, typename Better>
+RAJA_INLINE ValLoc<T, IndexType> builtin_atomic_valloc_locked(
+    ValLoc<T, IndexType> volatile *acc,
+    ValLoc<T, IndexType> const &value,
+    Better const &better)
+{
+  std::atomic<bool> &lock = builtin_valloc_lock(acc).locked;
+  while (lock.exchange(true, std::memory_order_acquire)) {
+    while (lock.load(std::memory_order_relaxed)) {
+    }
+  }
+  ValLoc<T, IndexType> old(acc->val, acc->loc);
+  if (better(value, old)) {
+    acc->val = value.val;
+    acc->loc = value.loc;
+  }
+  lock.store(false, std::memory_order_release);
+  return old;
+}
+
+template <typename T, typename IndexType, typename Better>
+RAJA_INLINE ValLoc<T, IndexType> builtin_atomic_valloc_oper(
+    std::integral_constant<int, 0>,
+    ValLoc<T, IndexType> volatile *acc,
+    ValLoc<T, IndexType> const &value,
+    Better const &better)
+{
+  return builtin_atomic_valloc_locked(acc, value, better);
+}
+
+/*!
+ * Replaces *acc with value if better(value, *acc) with the 64-bit CAS.
+ * Returns the pair at acc before this operation.
+ */
+template <typename T, typename IndexType, typename Better>
+RAJA_INLINE ValLoc<T, IndexType> builtin_atomic_valloc_oper(
+    std::integral_constant<int, 1>,
+    ValLoc<T, IndexType> volatile *acc,
+    ValLoc<T, IndexType> const &value,
+    Better const &better)
+{
+  using image = BuiltinValLocImage<T, IndexType>;
+
+  unsigned long long volatile *word =
+      reinterpret_cast<unsigned long long volatile *>(acc);
+
+  unsigned long long newval;
+  image::pack(value, &newval);
+
+  unsigned long long oldval = *word;
+  ValLoc<T, IndexType> old = image::unpack(&oldval);
+  while (better(value, old)) {
+    unsigned long long readback = builtin_atomic_CAS(word, oldval, newval);
+    if (readback == oldval) break;
+    oldval = readback;
+    old = image::unpack(&oldval);
+  }
+  return old;
+}
+
+#if defined(RAJA_BUILTIN_ATOMIC_CAS16)
+
+/*!
+ * Replaces *acc with value if better(value, *acc) with the 128-bit CAS,
+ * falling back on the lock if acc is not 16-byte aligned.
+ * Returns the pair at acc before this operation.
+ */
+template <typename T, typename IndexType, typename Better>
+RAJA_INLINE ValLoc<T, IndexType> builtin_atomic_valloc_oper(
+    std::integral_constant<int, 2>,
+    ValLoc<T, IndexType> volatile *acc,
+    ValLoc<T, IndexType> const &value,
+    Better const &better)
+{
+  using image = BuiltinValLocImage<T, IndexType>;
+
+  if (reinterpret_cast<std::uintptr_t>(acc) % 16 != 0) {
+    return builtin_atomic_valloc_locked(acc, value, better);
+  }
+
+  unsigned long long volatile *words =
+      reinterpret_cast<unsigned long long volatile *>(acc);
+
+  unsigned long long newval[2];
+  image::pack(value, newval);
+
+  // Take a snapshot without a locked instruction so updates that are not
+  // better never write the cache line. Min-loc and max-loc only change the
+  // value monotonically, so the location read between two equal reads of
+  // the value word belongs to that value.
+  unsigned long long oldval[2];
+  do {
+    oldval[0] = __atomic_load_n(&words[0], __ATOMIC_ACQUIRE);
+    oldval[1] = __atomic_load_n(&words[1], __ATOMIC_ACQUIRE);
+  } while (oldval[0] != __atomic_load_n(&words[0], __ATOMIC_RELAXED));
+
+  ValLoc<T, IndexType> old = image::unpack(oldval);
+  while (better(value, old)) {
+    if (builtin_atomic_CAS16(acc, oldval, newval)) break;
+    old = image::unpack(oldval);
+  }
+  return old;
+}
+
+#endif  // RAJA_BUILTIN_ATOMIC_CAS16
+
+
 }  // namespace detail
 
 
@@ -352,10 +556,45 @@ atomicCAS(builtin_atomic, T volatile *acc, T compare, T value)
   return detail::builtin_atomic_CAS(acc, compare, value);
 }
 
+/*!
+ * Host only, swaps the pair with a 64-bit or 128-bit CAS when it is 8 or 16
+ * bytes and uses a striped lock otherwise.
+ */
+template <typename T, typename IndexType>
+RAJA_INLINE ValLoc<T, IndexType> atomicMinLoc(
+    builtin_atomic,
+    ValLoc<T, IndexType> volatile *acc,
+    ValLoc<T, IndexType> value)
+{
+  return detail::builtin_atomic_valloc_oper(
+      detail::builtin_valloc_words<T, IndexType>{},
+      acc,
+      value,
+      [](ValLoc<T, IndexType> const &a, ValLoc<T, IndexType> const &b) {
+        return detail::minloc_better(a, b);
+      });
+}
+
+template <typename T, typename IndexType>
+RAJA_INLINE ValLoc<T, IndexType> atomicMaxLoc(
+    builtin_atomic,
+    ValLoc<T, IndexType> volatile *acc,
+    ValLoc<T, IndexType> value)
+{
+  return detail::builtin_atomic_valloc_oper(
+      detail::builtin_valloc_words<T, IndexType>{},
+      acc,
+      value,
+      [](ValLoc<T, IndexType> const &a, ValLoc<T, IndexType> const &b) {
+        return detail::maxloc_better(a, b);
+      });
+}
+
 
 }  // namespace RAJA
 
 // make sure this define doesn't bleed out of this header
 #undef RAJA_AUTO_ATOMIC
+#undef RAJA_BUILTIN_ATOMIC_CAS16
 
 #endif
@@ -0,0 +1,540 @@
+/*!
+ ******************************************************************************
+ *
+ * \file
+ *
+ * \brief   RAJA header file defining the combining atomic policy, which
+ *          buffers atomic updates per thread and per socket before applying
+ *          them to their targets.
+ *
+ ******************************************************************************
+ */
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-20, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/COPYRIGHT file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#ifndef RAJA_policy_atomic_combining_HPP
+#define RAJA_policy_atomic_combining_HPP
+
+#include "RAJA/config.hpp"
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <fstream>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+#if defined(__linux__)
+#include <sched.h>
+#endif
+
+#include "RAJA/policy/atomic_auto.hpp"
+#include "RAJA/util/macros.hpp"
+
+namespace RAJA
+{
+
+/*!
+ * Host atomic policy for a few addresses updated by many threads.
+ *
+ * Add, sub, inc, dec, min, max, and, or and xor are combined in a small
+ * table of slots owned by the calling thread. An address may use any of a
+ * few neighbouring slots; when they are all taken one of them is moved to
+ * a table shared by the threads of the same socket, and slots evicted
+ * from that table are applied to their targets with AtomicPolicy.
+ * atomicFlush applies everything that is buffered, so targets hold their
+ * final values only after atomicFlush, which must not run concurrently
+ * with combining operations, for example after the loop that did the
+ * updates.
+ *
+ * Combined operations do not return the previous value of the target,
+ * they return a value initialized T. Exchange, CAS, the wrapping inc and
+ * dec, min-loc and max-loc are applied directly with AtomicPolicy and are
+ * not ordered with buffered updates of the same address.
+ */
+template <typename AtomicPolicy = auto_atomic>
+struct combining_atomic {
+};
+
+namespace detail
+{
+
+//! slots per thread, and per socket
+constexpr size_t combining_atomic_thread_slots = 16;
+constexpr size_t combining_atomic_group_slots = 64;
+
+//! neighbouring thread slots an address may use
+constexpr size_t combining_atomic_thread_probes = 4;
+
+//! sockets beyond this share tables
+constexpr int combining_atomic_max_groups = 8;
+
+struct CombiningAtomicEntry {
+  void volatile *addr = nullptr;
+  void (*combine)(void *, void const *) = nullptr;
+  void (*apply)(void volatile *, void const *) = nullptr;
+  alignas(16) unsigned char value[16];
+};
+
+struct alignas(64) CombiningAtomicGroupSlot {
+  std::atomic<bool> locked{false};
+  CombiningAtomicEntry entry;
+};
+
+struct CombiningAtomicGroup {
+  CombiningAtomicGroupSlot slots[combining_atomic_group_slots];
+};
+
+//! per thread slots, padded so neighbouring buffers don't share lines
+struct CombiningAtomicBuffer {
+  unsigned char pad_front[64];
+  int group = 0;
+  unsigned victim = 0;
+  CombiningAtomicEntry entries[combining_atomic_thread_slots];
+  unsigned char pad_back[64];
+};
+
+inline size_t combining_atomic_hash(void volatile const *addr)
+{
+  uint64_t h = static_cast<uint64_t>(reinterpret_cast<uintptr_t>(addr));
+  h = (h >> 3) * 0x9E3779B97F4A7C15ull;
+  return static_cast<size_t>(h >> 32);
+}
+
+//! socket of the cpu the calling thread runs on, 0 if unknown
+inline int combining_atomic_current_group()
+{
+#if defined(__linux__) && defined(_GNU_SOURCE)
+  const int cpu = sched_getcpu();
+  if (cpu >= 0) {
+    std::ifstream in("/sys/devices/system/cpu/cpu" + std::to_string(cpu) +
+                     "/topology/physical_package_id");
+    int id = 0;
+    if (in >> id && id >= 0) {
+      return id % combining_atomic_max_groups;
+    }
+  }
+#endif
+  return 0;
+}
+
+inline CombiningAtomicGroup *combining_atomic_groups()
+{
+  static CombiningAtomicGroup groups[combining_atomic_max_groups];
+  return groups;
+}
+
+//! move a thread slot into its socket table and empty it
+inline void combining_atomic_push(CombiningAtomicEntry &e, int group)
+{
+  CombiningAtomicGroupSlot &slot =
+      combining_atomic_groups()[group].slots[combining_atomic_hash(e.addr) %
+                                             combining_atomic_group_slots];
+
+  while (slot.locked.exchange(true, std::memory_order_acquire)) {
+  }
+
+  CombiningAtomicEntry &g = slot.entry;
+  if (g.addr == e.addr && g.apply == e.apply) {
+    e.combine(g.value, e.value);
+  } else {
+    if (g.addr != nullptr) {
+      g.apply(g.addr, g.value);
+    }
+    g = e;
+  }
+
+  slot.locked.store(false, std::memory_order_release);
+
+  e.addr = nullptr;
+}
+
+/*!
+ * Owns the per thread buffers so atomicFlush can reach the buffers of every
+ * thread. Buffers of exited threads are pushed to their socket tables and
+ * reused.
+ */
+class CombiningAtomicRegistry
+{
+public:
+  static CombiningAtomicRegistry &get()
+  {
+    static CombiningAtomicRegistry registry;
+    return registry;
+  }
+
+  CombiningAtomicBuffer *acquire()
+  {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    CombiningAtomicBuffer *buf = nullptr;
+    if (m_free.empty()) {
+      m_buffers.emplace_back(new CombiningAtomicBuffer);
+      buf = m_buffers.back().get();
+    } else {
+      buf = m_free.back();
+      m_free.pop_back();
+    }
+    buf->group = combining_atomic_current_group();
+    return buf;
+  }
+
+  void release(CombiningAtomicBuffer *buf)
+  {
+    for (CombiningAtomicEntry &e : buf->entries) {
+      if (e.addr != nullptr) {
+        combining_atomic_push(e, buf->group);
+      }
+    }
+    std::lock_guard<std::mutex> lock(m_mutex);
+    m_free.push_back(buf);
+  }
+
+  //! thread slots to socket tables, then socket tables to targets
+  void flush()
+  {
+    std::lock_guard<std::mutex> lock(m_mutex);
+
+    for (auto &buf : m_buffers) {
+      for (CombiningAtomicEntry &e : buf->entries) {
+        if (e.addr != nullptr) {
+          combining_atomic_push(e, buf->group);
+        }
+      }
+    }
+
+    CombiningAtomicGroup *groups = combining_atomic_groups();
+    for (int g = 0; g < combining_atomic_max_groups; ++g) {
+      for (CombiningAtomicGroupSlot &slot : groups[g].slots) {
+        CombiningAtomicEntry &e = slot.entry;
+        if (e.addr != nullptr) {
+          e.apply(e.addr, e.value);
+          e.addr = nullptr;
+        }
+      }
+    }
+  }
+
+private:
+  std::mutex m_mutex;
+  std::vector<std::unique_ptr<CombiningAtomicBuffer>> m_buffers;
+  std::vector<CombiningAtomicBuffer *> m_free;
+};
+
+struct CombiningAtomicThreadBuffer {
+  CombiningAtomicBuffer *buf;
+
+  CombiningAtomicThreadBuffer()
+      : buf(CombiningAtomicRegistry::get().acquire())
+  {
+  }
+
+  ~CombiningAtomicThreadBuffer()
+  {
+    CombiningAtomicRegistry::get().release(buf);
+  }
+};
+
+//! buffer of the calling thread
+inline CombiningAtomicBuffer &combining_atomic_buffer()
+{
+  static thread_local CombiningAtomicThreadBuffer thread_buffer;
+  return *thread_buffer.buf;
+}
+
+struct combining_atomic_add {
+  template <typename T>
+  static void combine(T &a, T b)
+  {
+    a += b;
+  }
+
+  template <typename Policy, typename T>
+  static void apply(T volatile *acc, T value)
+  {
+    atomicAdd(Policy{}, acc, value);
+  }
+};
+
+struct combining_atomic_min {
+  template <typename T>
+  static void combine(T &a, T b)
+  {
+    a = b < a ? b : a;
+  }
+
+  template <typename Policy, typename T>
+  static void apply(T volatile *acc, T value)
+  {
+    atomicMin(Policy{}, acc, value);
+  }
+};
+
+struct combining_atomic_max {
+  template <typename T>
+  static void combine(T &a, T b)
+  {
+    a = b > a ? b : a;
+  }
+
+  template <typename Policy, typename T>
+  static void apply(T volatile *acc, T value)
+  {
+    atomicMax(Policy{}, acc, value);
+  }
+};
+
+struct combining_atomic_and {
+  template <typename T>
+  static void combine(T &a, T b)
+  {
+    a &= b;
+  }
+
+  template <typename Policy, typename T>
+  static void apply(T volatile *acc, T value)
+  {
+    atomicAnd(Policy{}, acc, value);
+  }
+};
+
+struct combining_atomic_or {
+  template <typename T>
+  static void combine(T &a, T b)
+  {
+    a |= b;
+  }
+
+  template <typename Policy, typename T>
+  static void apply(T volatile *acc, T value)
+  {
+    atomicOr(Policy{}, acc, value);
+  }
+};
+
+struct combining_atomic_xor {
+  template <typename T>
+  static void combine(T &a, T b)
+  {
+    a ^= b;
+  }
+
+  template <typename Policy, typename T>
+  static void apply(T volatile *acc, T value)
+  {
+    atomicXor(Policy{}, acc, value);
+  }
+};
+
+template <typename Op, typename T>
+void combining_atomic_combine(void *dst, void const *src)
+{
+  T a, b;
+  std::memcpy(&a, dst, sizeof(T));
+  std::memcpy(&b, src, sizeof(T));
+  Op::combine(a, b);
+  std::memcpy(dst, &a, sizeof(T));
+}
+
+template <typename Op, typename Policy, typename T>
+void combining_atomic_apply(void volatile *acc, void const *src)
+{
+  T value;
+  std::memcpy(&value, src, sizeof(T));
+  Op::template apply<Policy>(static_cast<T volatile *>(acc), value);
+}
+
+template <typename Op, typename Policy, typename T>
+RAJA_INLINE T combining_atomic_update(T volatile *acc, T value)
+{
+  static_assert(sizeof(T) <= sizeof(CombiningAtomicEntry::value) &&
+                    std::is_trivially_copyable<T>::value,
+                "combining_atomic needs a trivially copyable type of at "
+                "most 16 bytes");
+
+  CombiningAtomicBuffer &buf = combining_atomic_buffer();
+  const size_t home = combining_atomic_hash(acc);
+
+  void (*apply)(void volatile *, void const *) =
+      &combining_atomic_apply<Op, Policy, T>;
+
+  CombiningAtomicEntry *empty = nullptr;
+  for (size_t p = 0; p < combining_atomic_thread_probes; ++p) {
+    CombiningAtomicEntry &e =
+        buf.entries[(home + p) % combining_atomic_thread_slots];
+    if (e.addr == acc && e.apply == apply) {
+      combining_atomic_combine<Op, T>(e.value, &value);
+      return T();
+    }
+    if (e.addr == nullptr && empty == nullptr) {
+      empty = &e;
+    }
+  }
+
+  if (empty == nullptr) {
+    // evict the slots of a full window in turn
+    const size_t p = buf.victim++ % combining_atomic_thread_probes;
+    empty = &buf.entries[(home + p) % combining_atomic_thread_slots];
+    combining_atomic_push(*empty, buf.group);
+  }
+
+  empty->addr = acc;
+  empty->combine = &combining_atomic_combine<Op, T>;
+  empty->apply = apply;
+  std::memcpy(empty->value, &value, sizeof(T));
+
+  return T();
+}
+
+}  // namespace detail
+
+
+template <typename AtomicPolicy, typename T>
+RAJA_INLINE T atomicAdd(combining_atomic<AtomicPolicy>,
+                        T volatile *acc,
+                        T value)
+{
+  return detail::combining_atomic_update<detail::combining_atomic_add,
+                                         AtomicPolicy>(acc, value);
+}
+
+template <typename AtomicPolicy, typename T>
+RAJA_INLINE T atomicSub(combining_atomic<AtomicPolicy>,
+                        T volatile *acc,
+                        T value)
+{
+  return detail::combining_atomic_update<detail::combining_atomic_add,
+                                         AtomicPolicy>(
+      acc, static_cast<T>(T(0) - value));
+}
+
+template <typename AtomicPolicy, typename T>
+RAJA_INLINE T atomicMin(combining_atomic<AtomicPolicy>,
+                        T volatile *acc,
+                        T value)
+{
+  return detail::combining_atomic_update<detail::combining_atomic_min,
+                                         AtomicPolicy>(acc, value);
+}
+
+template <typename AtomicPolicy, typename T>
+RAJA_INLINE T atomicMax(combining_atomic<AtomicPolicy>,
+                        T volatile *acc,
+                        T value)
+{
+  return detail::combining_atomic_update<detail::combining_atomic_max,
+                                         AtomicPolicy>(acc, value);
+}
+
+template <typename AtomicPolicy, typename T>
+RAJA_INLINE T atomicInc(combining_atomic<AtomicPolicy>, T volatile *acc)
+{
+  return detail::combining_atomic_update<detail::combining_atomic_add,
+                                         AtomicPolicy>(acc, T(1));
+}
+
+template <typename AtomicPolicy, typename T>
+RAJA_INLINE T atomicInc(combining_atomic<AtomicPolicy>,
+                        T volatile *acc,
+                        T compare)
+{
+  return atomicInc(AtomicPolicy{}, acc, compare);
+}
+
+template <typename AtomicPolicy, typename T>
+RAJA_INLINE T atomicDec(combining_atomic<AtomicPolicy>, T volatile *acc)
+{
+  return detail::combining_atomic_update<detail::combining_atomic_add,
+                                         AtomicPolicy>(
+      acc, static_cast<T>(T(0) - T(1)));
+}
+
+template <typename AtomicPolicy, typename T>
+RAJA_INLINE T atomicDec(combining_atomic<AtomicPolicy>,
+                        T volatile *acc,
+                        T compare)
+{
+  return atomicDec(AtomicPolicy{}, acc, compare);
+}
+
+template <typename AtomicPolicy, typename T>
+RAJA_INLINE T atomicAnd(combining_atomic<AtomicPolicy>,
+                        T volatile *acc,
+                        T value)
+{
+  return detail::combining_atomic_update<detail::combining_atomic_and,
+                                         AtomicPolicy>(acc, value);
+}
+
+template <typename AtomicPolicy, typename T>
+RAJA_INLINE T atomicOr(combining_atomic<AtomicPolicy>,
+                       T volatile *acc,
+                       T value)
+{
+  return detail::combining_atomic_update<detail::combining_atomic_or,
+                                         AtomicPolicy>(acc, value);
+}
+
+template <typename AtomicPolicy, typename T>
+RAJA_INLINE T atomicXor(combining_atomic<AtomicPolicy>,
+                        T volatile *acc,
+                        T value)
+{
+  return detail::combining_atomic_update<detail::combining_atomic_xor,
+                                         AtomicPolicy>(acc, value);
+}
+
+template <typename AtomicPolicy, typename T>
+RAJA_INLINE T atomicExchange(combining_atomic<AtomicPolicy>,
+                             T volatile *acc,
+                             T value)
+{
+  return atomicExchange(AtomicPolicy{}, acc, value);
+}
+
+template <typename AtomicPolicy, typename T>
+RAJA_INLINE T atomicCAS(combining_atomic<AtomicPolicy>,
+                        T volatile *acc,
+                        T compare,
+                        T value)
+{
+  return atomicCAS(AtomicPolicy{}, acc, compare, value);
+}
+
+template <typename AtomicPolicy, typename T, typename IndexType>
+RAJA_INLINE ValLoc<T, IndexType> atomicMinLoc(
+    combining_atomic<AtomicPolicy>,
+    ValLoc<T, IndexType> volatile *acc,
+    ValLoc<T, IndexType> value)
+{
+  return atomicMinLoc(AtomicPolicy{}, acc, value);
+}
+
+template <typename AtomicPolicy, typename T, typename IndexType>
+RAJA_INLINE ValLoc<T, IndexType> atomicMaxLoc(
+    combining_atomic<AtomicPolicy>,
+    ValLoc<T, IndexType> volatile *acc,
+    ValLoc<T, IndexType> value)
+{
+  return atomicMaxLoc(AtomicPolicy{}, acc, value);
+}
+
+//! apply all buffered updates of every thread to their targets
+template <typename AtomicPolicy>
+RAJA_INLINE void atomicFlush(combining_atomic<AtomicPolicy>)
+{
+  detail::CombiningAtomicRegistry::get().flush();
+}
+
+
+}  // namespace RAJA
+
+#endif
@@ -31,13 +31,16 @@
 
 #include "RAJA/policy/openmp/atomic.hpp"
 #include "RAJA/policy/openmp/forall.hpp"
+#include "RAJA/policy/openmp/graph.hpp"
 #include "RAJA/policy/openmp/kernel.hpp"
 #include "RAJA/policy/openmp/policy.hpp"
 #include "RAJA/policy/openmp/reduce.hpp"
 #include "RAJA/policy/openmp/region.hpp"
 #include "RAJA/policy/openmp/scan.hpp"
 #include "RAJA/policy/openmp/sort.hpp"
+#include "RAJA/policy/openmp/sparse.hpp"
 #include "RAJA/policy/openmp/synchronize.hpp"
+#include "RAJA/policy/openmp/taskgraph.hpp"
 #include "RAJA/policy/openmp/WorkGroup.hpp"
 
 
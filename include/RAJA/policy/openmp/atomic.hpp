@@ -208,6 +208,26 @@ RAJA_INLINE T atomicCAS(omp_atomic, T volatile *acc, T compare, T value)
   return RAJA::atomicCAS(builtin_atomic{}, acc, compare, value);
 }
 
+template <typename T, typename IndexType>
+RAJA_INLINE ValLoc<T, IndexType> atomicMinLoc(
+    omp_atomic,
+    ValLoc<T, IndexType> volatile *acc,
+    ValLoc<T, IndexType> value)
+{
+  // OpenMP can't update a pair atomically so use builtin atomics
+  return RAJA::atomicMinLoc(builtin_atomic{}, acc, value);
+}
+
+template <typename T, typename IndexType>
+RAJA_INLINE ValLoc<T, IndexType> atomicMaxLoc(
+    omp_atomic,
+    ValLoc<T, IndexType> volatile *acc,
+    ValLoc<T, IndexType> value)
+{
+  // OpenMP can't update a pair atomically so use builtin atomics
+  return RAJA::atomicMaxLoc(builtin_atomic{}, acc, value);
+}
+
 #endif  // not defined RAJA_COMPILER_MSVC
 
 
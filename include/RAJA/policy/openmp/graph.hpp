@@ -0,0 +1,99 @@
+/*!
+ ******************************************************************************
+ *
+ * \file
+ *
+ * \brief   Header file containing the OpenMP LaunchGraph executor.
+ *
+ ******************************************************************************
+ */
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-20, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/COPYRIGHT file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#ifndef RAJA_graph_openmp_HPP
+#define RAJA_graph_openmp_HPP
+
+#include "RAJA/config.hpp"
+
+#if defined(RAJA_ENABLE_OPENMP)
+
+#include <omp.h>
+
+#include "RAJA/util/types.hpp"
+
+#include "RAJA/policy/openmp/policy.hpp"
+
+#include "RAJA/pattern/detail/forall.hpp"
+#include "RAJA/pattern/detail/privatizer.hpp"
+#include "RAJA/pattern/graph.hpp"
+
+namespace RAJA
+{
+namespace policy
+{
+namespace omp
+{
+
+/*!
+ * \brief Runs a recorded forall launch of an omp_graph.
+ *
+ * Called by every thread of the graph's parallel region. The static
+ * schedule assigns iteration i of equally long loops to the same thread,
+ * which is what lets pointwise dependent launches skip the barrier.
+ */
+template <typename Iterable, typename Func>
+RAJA_INLINE void graph_forall_impl(const omp_graph &,
+                                   Iterable const &iter,
+                                   Func &loop_body)
+{
+  RAJA_EXTRACT_BED_IT(iter);
+
+  using RAJA::internal::thread_privatize;
+  auto body = thread_privatize(loop_body);
+
+#pragma omp for schedule(static) nowait
+  for (decltype(distance_it) i = 0; i < distance_it; ++i) {
+    body.get_priv()(begin_it[i]);
+  }
+}
+
+/*!
+ * \brief Replays the launches of an omp_graph in one parallel region.
+ *
+ * A barrier is placed before launch n only if barriers[n] is set.
+ */
+template <typename Nodes, typename Barriers>
+RAJA_INLINE void graph_replay_impl(const omp_graph &,
+                                   Nodes &nodes,
+                                   Barriers const &barriers)
+{
+  const size_t num_nodes = nodes.size();
+
+#pragma omp parallel
+  {
+    for (size_t n = 0; n < num_nodes; ++n) {
+      if (barriers[n]) {
+#pragma omp barrier
+      }
+      nodes[n]->run();
+    }
+  }
+}
+
+//! equally long static loops give each thread the same iterations
+constexpr bool graph_pointwise_ok(const omp_graph &) { return true; }
+
+}  // namespace omp
+
+}  // namespace policy
+
+}  // namespace RAJA
+
+#endif  // closing endif for if defined(RAJA_ENABLE_OPENMP)
+
+#endif  // closing endif for header file include guard
@@ -21,5 +21,7 @@
 
 #include "RAJA/policy/openmp/kernel/Collapse.hpp"
 #include "RAJA/policy/openmp/kernel/OmpSyncThreads.hpp"
+#include "RAJA/policy/openmp/kernel/RecursiveTile.hpp"
+#include "RAJA/policy/openmp/kernel/Reduce.hpp"
 
 #endif  // closing endif for header file include guard
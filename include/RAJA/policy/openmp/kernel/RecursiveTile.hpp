@@ -0,0 +1,105 @@
+/*!
+ ******************************************************************************
+ *
+ * \file
+ *
+ * \brief   RAJA header file containing the OpenMP task executor for
+ *          statement::RecursiveTile
+ *
+ ******************************************************************************
+ */
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-20, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/COPYRIGHT file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#ifndef RAJA_policy_openmp_kernel_recursivetile_HPP
+#define RAJA_policy_openmp_kernel_recursivetile_HPP
+
+#include "RAJA/config.hpp"
+
+#if defined(RAJA_ENABLE_OPENMP)
+
+#include "RAJA/pattern/kernel/RecursiveTile.hpp"
+#include "RAJA/pattern/kernel/internal.hpp"
+
+#include "RAJA/util/macros.hpp"
+#include "RAJA/util/types.hpp"
+
+#include "RAJA/policy/openmp/policy.hpp"
+
+namespace RAJA
+{
+
+namespace internal
+{
+
+/*!
+ * Runs the back half of a recursive tile split as an OpenMP task on a
+ * private copy of the loop data and the front half on the calling thread.
+ * Must be called from inside a parallel region.
+ */
+struct RecursiveTileOmpTaskSpawner {
+
+  template <typename Data, typename Front, typename Back>
+  RAJA_INLINE void operator()(Data &data, Front &&front, Back &&back) const
+  {
+    camp::decay<Data> task_data(data);
+    auto *back_ptr = &back;
+
+#pragma omp task firstprivate(task_data, back_ptr)
+    {
+      (*back_ptr)(task_data);
+    }
+
+    front(data);
+
+#pragma omp taskwait
+  }
+};
+
+
+/*!
+ * OpenMP executor for statement::RecursiveTile
+ *
+ * Opens a parallel region and lets a single thread drive the recursion,
+ * spawning half of every split as a task for the rest of the team.
+ *
+ */
+template <camp::idx_t... ArgumentIds,
+          camp::idx_t LeafSize,
+          typename... EnclosedStmts,
+          typename Types>
+struct StatementExecutor<statement::RecursiveTile<ArgList<ArgumentIds...>,
+                                                  tile_fixed<LeafSize>,
+                                                  omp_parallel_for_exec,
+                                                  EnclosedStmts...>,
+                         Types> {
+
+  template <typename Data>
+  static RAJA_INLINE void exec(Data &data)
+  {
+    using tiler_t = RecursiveTiler<ArgList<ArgumentIds...>,
+                                   LeafSize,
+                                   Types,
+                                   EnclosedStmts...>;
+
+#pragma omp parallel
+    {
+#pragma omp single
+      {
+        tiler_t::recurse(data, RecursiveTileOmpTaskSpawner{});
+      }
+    }
+  }
+};
+
+}  // namespace internal
+}  // namespace RAJA
+
+#endif  // closing endif for RAJA_ENABLE_OPENMP guard
+
+#endif  // closing endif for header file include guard
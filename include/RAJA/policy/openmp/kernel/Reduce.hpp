@@ -0,0 +1,96 @@
+/*!
+ ******************************************************************************
+ *
+ * \file
+ *
+ * \brief   RAJA header file containing the OpenMP executor for
+ *          statement::Reduce
+ *
+ ******************************************************************************
+ */
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-20, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/COPYRIGHT file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#ifndef RAJA_policy_openmp_kernel_Reduce_HPP
+#define RAJA_policy_openmp_kernel_Reduce_HPP
+
+#include "RAJA/config.hpp"
+
+#if defined(RAJA_ENABLE_OPENMP)
+
+#include "RAJA/pattern/kernel/Reduce.hpp"
+#include "RAJA/pattern/kernel/internal.hpp"
+
+#include "RAJA/util/macros.hpp"
+#include "RAJA/util/types.hpp"
+
+#include "RAJA/policy/openmp/policy.hpp"
+
+namespace RAJA
+{
+
+namespace internal
+{
+
+/*!
+ * Partials of an OpenMP statement::Reduce. Each thread private copy of the
+ * loop data combines its partial once, when the copy is destroyed.
+ */
+template <typename T, template <typename...> class ReduceOperator>
+struct OmpReducePartials {
+
+  T value = identity();
+
+  static constexpr T identity() { return ReduceOperator<T>::identity(); }
+
+  static T op(T const &a, T const &b) { return ReduceOperator<T>{}(a, b); }
+
+  void combine(T const &partial)
+  {
+#pragma omp critical(ompKernelReduceCritical)
+    value = op(value, partial);
+  }
+
+  T take()
+  {
+    T result = value;
+    value = identity();
+    return result;
+  }
+};
+
+//
+// Executor that reduces a Param across the threads of the parallel
+// statements it encloses
+//
+template <template <typename...> class ReduceOperator,
+          typename ParamId,
+          typename... EnclosedStmts,
+          typename Types>
+struct StatementExecutor<
+    statement::Reduce<omp_reduce, ReduceOperator, ParamId, EnclosedStmts...>, Types> {
+
+  template <typename Data>
+  static RAJA_INLINE void exec(Data &&data)
+  {
+    using value_t = decltype(data.template get_param<ParamId>());
+    using partials_t = OmpReducePartials<value_t, ReduceOperator>;
+
+    execute_host_reduce<partials_t, ParamId, Types>(
+        data, camp::list<EnclosedStmts...>{});
+  }
+};
+
+
+}  // namespace internal
+
+}  // end namespace RAJA
+
+#endif  // closing endif for RAJA_ENABLE_OPENMP guard
+
+#endif /* RAJA_policy_openmp_kernel_Reduce_HPP */
@@ -166,6 +166,26 @@ struct omp_taskgraph_interval_segit
     : make_policy_pattern_t<Policy::openmp, Pattern::taskgraph, omp::Parallel> {
 };
 
+///
+/// LaunchGraph execution policies
+///
+struct omp_graph : make_policy_pattern_launch_platform_t<Policy::openmp,
+                                                         Pattern::launch_graph,
+                                                         Launch::sync,
+                                                         Platform::host,
+                                                         omp::Parallel> {
+};
+
+///
+/// TaskGraph execution policies
+///
+struct omp_taskgraph : make_policy_pattern_launch_platform_t<Policy::openmp,
+                                                             Pattern::taskgraph,
+                                                             Launch::sync,
+                                                             Platform::host,
+                                                             omp::Parallel> {
+};
+
 ///
 /// WorkGroup execution policies
 ///
@@ -190,6 +210,12 @@ struct omp_reduce_ordered
     : make_policy_pattern_t<Policy::openmp, Pattern::reduce, reduce::ordered> {
 };
 
+struct omp_reduce_reproducible
+    : make_policy_pattern_t<Policy::openmp,
+                            Pattern::reduce,
+                            reduce::reproducible> {
+};
+
 struct omp_synchronize : make_policy_pattern_launch_t<Policy::openmp,
                                                       Pattern::synchronize,
                                                       Launch::sync> {
@@ -203,6 +229,7 @@ using policy::omp::omp_for_nowait_exec;
 using policy::omp::omp_for_schedule_exec;
 using policy::omp::omp_for_nowait_schedule_exec;
 using policy::omp::omp_for_static;
+using policy::omp::omp_graph;
 using policy::omp::omp_parallel_exec;
 using policy::omp::omp_parallel_for_exec;
 using policy::omp::omp_parallel_for_segit;
@@ -210,7 +237,9 @@ using policy::omp::omp_parallel_region;
 using policy::omp::omp_parallel_segit;
 using policy::omp::omp_reduce;
 using policy::omp::omp_reduce_ordered;
+using policy::omp::omp_reduce_reproducible;
 using policy::omp::omp_synchronize;
+using policy::omp::omp_taskgraph;
 using policy::omp::omp_work;
 
 }  // namespace RAJA
@@ -33,6 +33,7 @@
 #include "RAJA/util/types.hpp"
 
 #include "RAJA/pattern/detail/reduce.hpp"
+#include "RAJA/pattern/detail/reduce_reproducible.hpp"
 #include "RAJA/pattern/reduce.hpp"
 
 #include "RAJA/policy/openmp/policy.hpp"
@@ -67,6 +68,12 @@ public:
 
 RAJA_DECLARE_ALL_REDUCERS(omp_reduce, detail::ReduceOMP)
 
+///
+/// Sum reducer whose result does not depend on the number of threads or
+/// on how iterations are scheduled.
+///
+RAJA_DECLARE_REPRODUCIBLE_SUM_REDUCER(omp_reduce_reproducible, detail::ReduceOMP)
+
 ///////////////////////////////////////////////////////////////////////////////
 //
 // Old ordered reductions are included below.
@@ -0,0 +1,88 @@
+/*!
+ ******************************************************************************
+ *
+ * \file
+ *
+ * \brief   Header file containing the OpenMP TaskGraph executor.
+ *
+ ******************************************************************************
+ */
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-20, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/COPYRIGHT file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#ifndef RAJA_taskgraph_openmp_HPP
+#define RAJA_taskgraph_openmp_HPP
+
+#include "RAJA/config.hpp"
+
+#if defined(RAJA_ENABLE_OPENMP)
+
+#include <omp.h>
+
+#include "RAJA/policy/openmp/policy.hpp"
+
+namespace RAJA
+{
+namespace policy
+{
+namespace omp
+{
+
+/*!
+ * \brief Creates an OpenMP task running task n of nodes, which then
+ *        creates the tasks of its successors that become ready.
+ */
+template <typename Nodes>
+void taskgraph_spawn(Nodes *nodes, size_t n)
+{
+#pragma omp task firstprivate(nodes, n)
+  {
+    auto &node = *(*nodes)[n];
+    node.run();
+    for (size_t s : node.successors) {
+      if ((*nodes)[s]->remaining.fetch_sub(1) == 1) {
+        taskgraph_spawn(nodes, s);
+      }
+    }
+  }
+}
+
+/*!
+ * \brief Runs the tasks of an omp_taskgraph as OpenMP tasks of one
+ *        parallel region, each created once its dependences finished.
+ */
+template <typename Nodes>
+RAJA_INLINE void taskgraph_execute_impl(const omp_taskgraph &, Nodes &nodes)
+{
+  for (auto &node : nodes) {
+    node->remaining.store(node->num_predecessors);
+  }
+
+  Nodes *nodes_ptr = &nodes;
+  const size_t num_nodes = nodes.size();
+
+#pragma omp parallel
+#pragma omp single
+  {
+    for (size_t n = 0; n < num_nodes; ++n) {
+      if ((*nodes_ptr)[n]->num_predecessors == 0) {
+        taskgraph_spawn(nodes_ptr, n);
+      }
+    }
+  }
+}
+
+}  // namespace omp
+
+}  // namespace policy
+
+}  // namespace RAJA
+
+#endif  // closing endif for if defined(RAJA_ENABLE_OPENMP)
+
+#endif  // closing endif for header file include guard
@@ -20,6 +20,7 @@
 
 #include "RAJA/config.hpp"
 
+#include "RAJA/util/ValLoc.hpp"
 #include "RAJA/util/macros.hpp"
 
 namespace RAJA
@@ -162,6 +163,38 @@ RAJA_INLINE T atomicCAS(seq_atomic, T volatile *acc, T compare, T value)
   return ret;
 }
 
+RAJA_SUPPRESS_HD_WARN
+template <typename T, typename IndexType>
+RAJA_HOST_DEVICE
+RAJA_INLINE ValLoc<T, IndexType> atomicMinLoc(
+    seq_atomic,
+    ValLoc<T, IndexType> volatile *acc,
+    ValLoc<T, IndexType> value)
+{
+  ValLoc<T, IndexType> ret(acc->val, acc->loc);
+  if (detail::minloc_better(value, ret)) {
+    acc->val = value.val;
+    acc->loc = value.loc;
+  }
+  return ret;
+}
+
+RAJA_SUPPRESS_HD_WARN
+template <typename T, typename IndexType>
+RAJA_HOST_DEVICE
+RAJA_INLINE ValLoc<T, IndexType> atomicMaxLoc(
+    seq_atomic,
+    ValLoc<T, IndexType> volatile *acc,
+    ValLoc<T, IndexType> value)
+{
+  ValLoc<T, IndexType> ret(acc->val, acc->loc);
+  if (detail::maxloc_better(value, ret)) {
+    acc->val = value.val;
+    acc->loc = value.loc;
+  }
+  return ret;
+}
+
 
 }  // namespace RAJA
 
@@ -0,0 +1,74 @@
+/*!
+ ******************************************************************************
+ *
+ * \file
+ *
+ * \brief   Header file containing the sequential LaunchGraph executor.
+ *
+ ******************************************************************************
+ */
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-20, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/COPYRIGHT file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#ifndef RAJA_graph_sequential_HPP
+#define RAJA_graph_sequential_HPP
+
+#include "RAJA/config.hpp"
+
+#include "RAJA/util/types.hpp"
+
+#include "RAJA/policy/sequential/policy.hpp"
+
+#include "RAJA/pattern/detail/forall.hpp"
+
+namespace RAJA
+{
+namespace policy
+{
+namespace sequential
+{
+
+/*!
+ * \brief Runs a recorded forall launch of a seq_graph.
+ */
+template <typename Iterable, typename Func>
+RAJA_INLINE void graph_forall_impl(const seq_graph &,
+                                   Iterable const &iter,
+                                   Func &body)
+{
+  RAJA_EXTRACT_BED_IT(iter);
+
+  RAJA_NO_SIMD
+  for (decltype(distance_it) i = 0; i < distance_it; ++i) {
+    body(*(begin_it + i));
+  }
+}
+
+/*!
+ * \brief Replays the launches of a seq_graph in order, barriers are implied.
+ */
+template <typename Nodes, typename Barriers>
+RAJA_INLINE void graph_replay_impl(const seq_graph &,
+                                   Nodes &nodes,
+                                   Barriers const &)
+{
+  for (auto &node : nodes) {
+    node->run();
+  }
+}
+
+//! launches run in order, so pointwise dependences never need a barrier
+constexpr bool graph_pointwise_ok(const seq_graph &) { return true; }
+
+}  // namespace sequential
+
+}  // namespace policy
+
+}  // namespace RAJA
+
+#endif  // closing endif for header file include guard
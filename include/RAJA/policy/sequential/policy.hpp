@@ -65,6 +65,24 @@ struct seq_work : make_policy_pattern_launch_platform_t<Policy::sequential,
                                                         Platform::host> {
 };
 
+///
+/// LaunchGraph execution policies
+///
+struct seq_graph : make_policy_pattern_launch_platform_t<Policy::sequential,
+                                                         Pattern::launch_graph,
+                                                         Launch::sync,
+                                                         Platform::host> {
+};
+
+///
+/// TaskGraph execution policies
+///
+struct seq_taskgraph : make_policy_pattern_launch_platform_t<Policy::sequential,
+                                                             Pattern::taskgraph,
+                                                             Launch::sync,
+                                                             Platform::host> {
+};
+
 ///
 ///////////////////////////////////////////////////////////////////////
 ///
@@ -77,13 +95,24 @@ struct seq_reduce : make_policy_pattern_launch_platform_t<Policy::sequential,
                                                           Launch::undefined,
                                                           Platform::host> {
 };
+
+struct seq_reduce_reproducible
+    : make_policy_pattern_launch_platform_t<Policy::sequential,
+                                            Pattern::reduce,
+                                            Launch::undefined,
+                                            Platform::host,
+                                            reduce::reproducible> {
+};
 }  // namespace sequential
 }  // namespace policy
 
 using policy::sequential::seq_exec;
+using policy::sequential::seq_graph;
 using policy::sequential::seq_reduce;
+using policy::sequential::seq_reduce_reproducible;
 using policy::sequential::seq_region;
 using policy::sequential::seq_segit;
+using policy::sequential::seq_taskgraph;
 using policy::sequential::seq_work;
 
 
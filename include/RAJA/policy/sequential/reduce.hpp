@@ -26,6 +26,7 @@
 #include "RAJA/internal/MemUtils_CPU.hpp"
 
 #include "RAJA/pattern/detail/reduce.hpp"
+#include "RAJA/pattern/detail/reduce_reproducible.hpp"
 #include "RAJA/pattern/reduce.hpp"
 
 #include "RAJA/policy/sequential/policy.hpp"
@@ -55,6 +56,8 @@ public:
 
 RAJA_DECLARE_ALL_REDUCERS(seq_reduce, detail::ReduceSeq)
 
+RAJA_DECLARE_REPRODUCIBLE_SUM_REDUCER(seq_reduce_reproducible, detail::ReduceSeq)
+
 }  // namespace RAJA
 
 #endif  // closing endif for header file include guard
@@ -0,0 +1,50 @@
+/*!
+ ******************************************************************************
+ *
+ * \file
+ *
+ * \brief   Header file containing the sequential TaskGraph executor.
+ *
+ ******************************************************************************
+ */
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-20, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/COPYRIGHT file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#ifndef RAJA_taskgraph_sequential_HPP
+#define RAJA_taskgraph_sequential_HPP
+
+#include "RAJA/config.hpp"
+
+#include "RAJA/policy/sequential/policy.hpp"
+
+namespace RAJA
+{
+namespace policy
+{
+namespace sequential
+{
+
+/*!
+ * \brief Runs the tasks of a seq_taskgraph in the order they were added,
+ *        which every task's dependences precede.
+ */
+template <typename Nodes>
+RAJA_INLINE void taskgraph_execute_impl(const seq_taskgraph &, Nodes &nodes)
+{
+  for (auto &node : nodes) {
+    node->run();
+  }
+}
+
+}  // namespace sequential
+
+}  // namespace policy
+
+}  // namespace RAJA
+
+#endif  // closing endif for header file include guard
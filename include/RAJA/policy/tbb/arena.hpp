@@ -0,0 +1,142 @@
+/*!
+ ******************************************************************************
+ *
+ * \file
+ *
+ * \brief   Header file containing RAJA task_arena helpers for TBB.
+ *
+ *          Provides NUMA-constrained arena construction and the machinery
+ *          used by TBB policy implementations to run work inside the arena
+ *          carried by a policy.
+ *
+ ******************************************************************************
+ */
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-20, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/COPYRIGHT file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#ifndef RAJA_arena_tbb_HPP
+#define RAJA_arena_tbb_HPP
+
+#include "RAJA/config.hpp"
+
+#if defined(RAJA_ENABLE_TBB)
+
+#include <cstddef>
+#include <vector>
+
+#include <tbb/task_arena.h>
+
+#if defined(__TBB_ARENA_BINDING) && __TBB_ARENA_BINDING
+#include <tbb/info.h>
+#define RAJA_TBB_HAVE_ARENA_BINDING
+#endif
+
+#include "RAJA/util/macros.hpp"
+
+#include "RAJA/policy/tbb/policy.hpp"
+
+namespace RAJA
+{
+namespace policy
+{
+namespace tbb
+{
+
+/*!
+ * \brief Return the ids of the NUMA nodes visible to TBB.
+ *
+ * When TBB was built without NUMA support (or the topology cannot be
+ * queried) a single id of ::tbb::task_arena::automatic is returned, which
+ * make_tbb_numa_arena() treats as "no constraint".
+ */
+inline std::vector<int> tbb_numa_nodes()
+{
+#if defined(RAJA_TBB_HAVE_ARENA_BINDING)
+  std::vector<int> nodes;
+  for (auto id : ::tbb::info::numa_nodes()) {
+    nodes.push_back(static_cast<int>(id));
+  }
+  return nodes;
+#else
+  return std::vector<int>(1, static_cast<int>(::tbb::task_arena::automatic));
+#endif
+}
+
+/*!
+ * \brief Construct a task_arena whose workers are pinned to a NUMA node.
+ *
+ * \param numa_node id returned by tbb_numa_nodes()
+ * \param max_concurrency maximum number of threads in the arena, defaults to
+ *        the number of cores on the node
+ *
+ * Without TBB NUMA support the arena is unconstrained and only
+ * max_concurrency is honored.
+ */
+inline ::tbb::task_arena make_tbb_numa_arena(
+    int numa_node,
+    int max_concurrency = ::tbb::task_arena::automatic)
+{
+#if defined(RAJA_TBB_HAVE_ARENA_BINDING)
+  return ::tbb::task_arena(
+      ::tbb::task_arena::constraints(numa_node, max_concurrency));
+#else
+  RAJA_UNUSED_VAR(numa_node);
+  return ::tbb::task_arena(max_concurrency);
+#endif
+}
+
+namespace detail
+{
+
+//! arena carried by a TBB policy, nullptr runs in the current arena
+template <typename ExecPolicy>
+RAJA_INLINE ::tbb::task_arena* get_arena(const ExecPolicy&)
+{
+  return nullptr;
+}
+
+RAJA_INLINE ::tbb::task_arena* get_arena(const tbb_arena_for_dynamic& p)
+{
+  return p.arena;
+}
+
+template <std::size_t GrainSize>
+RAJA_INLINE ::tbb::task_arena* get_arena(
+    const tbb_arena_for_static<GrainSize>& p)
+{
+  return p.arena;
+}
+
+/*!
+ * \brief Run func inside the given arena and wait for it to complete.
+ *
+ * A null arena calls func directly so policies without an arena pay nothing.
+ */
+template <typename Func>
+RAJA_INLINE void execute_in_arena(::tbb::task_arena* arena, Func&& func)
+{
+  if (arena) {
+    arena->execute(func);
+  } else {
+    func();
+  }
+}
+
+}  // namespace detail
+
+}  // namespace tbb
+}  // namespace policy
+
+using policy::tbb::make_tbb_numa_arena;
+using policy::tbb::tbb_numa_nodes;
+
+}  // namespace RAJA
+
+#endif  // closing endif for if defined(RAJA_ENABLE_TBB)
+
+#endif  // closing endif for header file include guard
@@ -32,6 +32,7 @@
 #include "RAJA/index/RangeSegment.hpp"
 #include "RAJA/internal/fault_tolerance.hpp"
 #include "RAJA/pattern/forall.hpp"
+#include "RAJA/policy/tbb/arena.hpp"
 #include "RAJA/policy/tbb/policy.hpp"
 #include "RAJA/util/types.hpp"
 
@@ -51,6 +52,52 @@ namespace policy
 namespace tbb
 {
 
+namespace detail
+{
+
+template <typename Iterable, typename Func>
+RAJA_INLINE void tbb_for_dynamic_loop(std::size_t grain_size,
+                                      Iterable&& iter,
+                                      Func&& loop_body)
+{
+  using std::begin;
+  using std::distance;
+  using std::end;
+  using brange = ::tbb::blocked_range<size_t>;
+  auto b = begin(iter);
+  size_t dist = std::abs(distance(begin(iter), end(iter)));
+  ::tbb::parallel_for(brange(0, dist, grain_size), [=](const brange& r) {
+    using RAJA::internal::thread_privatize;
+    auto privatizer = thread_privatize(loop_body);
+    auto body = privatizer.get_priv();
+    for (auto i = r.begin(); i != r.end(); ++i)
+      body(b[i]);
+  });
+}
+
+template <size_t ChunkSize, typename Iterable, typename Func>
+RAJA_INLINE void tbb_for_static_loop(Iterable&& iter, Func&& loop_body)
+{
+  using std::begin;
+  using std::distance;
+  using std::end;
+  using brange = ::tbb::blocked_range<size_t>;
+  auto b = begin(iter);
+  size_t dist = std::abs(distance(begin(iter), end(iter)));
+  ::tbb::parallel_for(
+      brange(0, dist, ChunkSize),
+      [=](const brange& r) {
+        using RAJA::internal::thread_privatize;
+        auto privatizer = thread_privatize(loop_body);
+        auto body = privatizer.get_priv();
+        for (auto i = r.begin(); i != r.end(); ++i)
+          body(b[i]);
+      },
+      tbb_static_partitioner{});
+}
+
+}  // namespace detail
+
 
 /**
  * @brief TBB dynamic for implementation
@@ -74,19 +121,9 @@ RAJA_INLINE resources::EventProxy<resources::Host> forall_impl(resources::Host &
                                                                Iterable&& iter,
                                                                Func&& loop_body)
 {
-  using std::begin;
-  using std::distance;
-  using std::end;
-  using brange = ::tbb::blocked_range<size_t>;
-  auto b = begin(iter);
-  size_t dist = std::abs(distance(begin(iter), end(iter)));
-  ::tbb::parallel_for(brange(0, dist, p.grain_size), [=](const brange& r) {
-    using RAJA::internal::thread_privatize;
-    auto privatizer = thread_privatize(loop_body);
-    auto body = privatizer.get_priv();
-    for (auto i = r.begin(); i != r.end(); ++i)
-      body(b[i]);
-  });
+  detail::tbb_for_dynamic_loop(p.grain_size,
+                               std::forward<Iterable>(iter),
+                               std::forward<Func>(loop_body));
 
   return resources::EventProxy<resources::Host>(&host_res);
 }
@@ -117,22 +154,68 @@ RAJA_INLINE resources::EventProxy<resources::Host> forall_impl(resources::Host &
                                                                Iterable&& iter,
                                                                Func&& loop_body)
 {
-  using std::begin;
-  using std::distance;
-  using std::end;
-  using brange = ::tbb::blocked_range<size_t>;
-  auto b = begin(iter);
-  size_t dist = std::abs(distance(begin(iter), end(iter)));
-  ::tbb::parallel_for(
-      brange(0, dist, ChunkSize),
-      [=](const brange& r) {
-        using RAJA::internal::thread_privatize;
-        auto privatizer = thread_privatize(loop_body);
-        auto body = privatizer.get_priv();
-        for (auto i = r.begin(); i != r.end(); ++i)
-          body(b[i]);
-      },
-      tbb_static_partitioner{});
+  detail::tbb_for_static_loop<ChunkSize>(std::forward<Iterable>(iter),
+                                         std::forward<Func>(loop_body));
+
+  return resources::EventProxy<resources::Host>(&host_res);
+}
+
+///
+/// TBB parallel for policies that execute in a given task_arena
+///
+
+/**
+ * @brief TBB dynamic for implementation inside a task_arena
+ *
+ * @param p tbb tag holding the arena and grain size
+ * @param iter any iterable
+ * @param loop_body loop body
+ *
+ * @return None
+ *
+ * Same as the tbb_for_dynamic implementation, but the parallel_for is issued
+ * from inside the arena held by the policy so only that arena's workers (for
+ * instance, those pinned to one NUMA node) execute the iterations. The call
+ * blocks until the loop completes.
+ */
+
+template <typename Iterable, typename Func>
+RAJA_INLINE resources::EventProxy<resources::Host> forall_impl(resources::Host &host_res,
+                                                               const tbb_arena_for_dynamic& p,
+                                                               Iterable&& iter,
+                                                               Func&& loop_body)
+{
+  const std::size_t grain_size = p.grain_size;
+  detail::execute_in_arena(p.arena, [&]() {
+    detail::tbb_for_dynamic_loop(grain_size, iter, loop_body);
+  });
+
+  return resources::EventProxy<resources::Host>(&host_res);
+}
+
+/**
+ * @brief TBB static for implementation inside a task_arena
+ *
+ * @param p tbb tag holding the arena
+ * @param iter any iterable
+ * @param loop_body loop body
+ *
+ * @return None
+ *
+ * Same as the tbb_for_static implementation, but executed inside the arena
+ * held by the policy. The static partitioner only keeps its thread mapping
+ * stable across loops issued to the same arena.
+ */
+
+template <typename Iterable, typename Func, size_t ChunkSize>
+RAJA_INLINE resources::EventProxy<resources::Host> forall_impl(resources::Host &host_res,
+                                                               const tbb_arena_for_static<ChunkSize>& p,
+                                                               Iterable&& iter,
+                                                               Func&& loop_body)
+{
+  detail::execute_in_arena(p.arena, [&]() {
+    detail::tbb_for_static_loop<ChunkSize>(iter, loop_body);
+  });
 
   return resources::EventProxy<resources::Host>(&host_res);
 }
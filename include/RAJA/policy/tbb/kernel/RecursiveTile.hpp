@@ -0,0 +1,116 @@
+/*!
+ ******************************************************************************
+ *
+ * \file
+ *
+ * \brief   RAJA header file containing the TBB task executor for
+ *          statement::RecursiveTile
+ *
+ ******************************************************************************
+ */
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-20, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/COPYRIGHT file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#ifndef RAJA_policy_tbb_kernel_recursivetile_HPP
+#define RAJA_policy_tbb_kernel_recursivetile_HPP
+
+#include "RAJA/config.hpp"
+
+#if defined(RAJA_ENABLE_TBB)
+
+#include <tbb/task_group.h>
+
+#include "RAJA/pattern/kernel/RecursiveTile.hpp"
+#include "RAJA/pattern/kernel/internal.hpp"
+
+#include "RAJA/util/macros.hpp"
+#include "RAJA/util/types.hpp"
+
+#include "RAJA/policy/tbb/policy.hpp"
+
+namespace RAJA
+{
+
+namespace internal
+{
+
+/*!
+ * Runs the back half of a recursive tile split as a TBB task on a private
+ * copy of the loop data and the front half on the calling thread.
+ */
+struct RecursiveTileTbbTaskSpawner {
+
+  template <typename Data, typename Front, typename Back>
+  RAJA_INLINE void operator()(Data &data, Front &&front, Back &&back) const
+  {
+    camp::decay<Data> task_data(data);
+
+    ::tbb::task_group group;
+    group.run([&]() { back(task_data); });
+    front(data);
+    group.wait();
+  }
+};
+
+
+/*!
+ * Shared TBB executor for statement::RecursiveTile
+ */
+template <typename ArgList,
+          camp::idx_t LeafSize,
+          typename Types,
+          typename... EnclosedStmts>
+struct RecursiveTileTbbExecutor {
+
+  template <typename Data>
+  static RAJA_INLINE void exec(Data &data)
+  {
+    using tiler_t = RecursiveTiler<ArgList, LeafSize, Types, EnclosedStmts...>;
+
+    tiler_t::recurse(data, RecursiveTileTbbTaskSpawner{});
+  }
+};
+
+
+template <camp::idx_t... ArgumentIds,
+          camp::idx_t LeafSize,
+          std::size_t GrainSize,
+          typename... EnclosedStmts,
+          typename Types>
+struct StatementExecutor<statement::RecursiveTile<ArgList<ArgumentIds...>,
+                                                  tile_fixed<LeafSize>,
+                                                  tbb_for_static<GrainSize>,
+                                                  EnclosedStmts...>,
+                         Types>
+    : RecursiveTileTbbExecutor<ArgList<ArgumentIds...>,
+                               LeafSize,
+                               Types,
+                               EnclosedStmts...> {
+};
+
+template <camp::idx_t... ArgumentIds,
+          camp::idx_t LeafSize,
+          typename... EnclosedStmts,
+          typename Types>
+struct StatementExecutor<statement::RecursiveTile<ArgList<ArgumentIds...>,
+                                                  tile_fixed<LeafSize>,
+                                                  tbb_for_dynamic,
+                                                  EnclosedStmts...>,
+                         Types>
+    : RecursiveTileTbbExecutor<ArgList<ArgumentIds...>,
+                               LeafSize,
+                               Types,
+                               EnclosedStmts...> {
+};
+
+}  // namespace internal
+}  // namespace RAJA
+
+#endif  // closing endif for RAJA_ENABLE_TBB guard
+
+#endif  // closing endif for header file include guard
@@ -0,0 +1,100 @@
+/*!
+ ******************************************************************************
+ *
+ * \file
+ *
+ * \brief   RAJA header file containing the TBB executor for
+ *          statement::Reduce
+ *
+ ******************************************************************************
+ */
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-20, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/COPYRIGHT file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#ifndef RAJA_policy_tbb_kernel_Reduce_HPP
+#define RAJA_policy_tbb_kernel_Reduce_HPP
+
+#include "RAJA/config.hpp"
+
+#if defined(RAJA_ENABLE_TBB)
+
+#include <tbb/combinable.h>
+
+#include "RAJA/pattern/kernel/Reduce.hpp"
+#include "RAJA/pattern/kernel/internal.hpp"
+
+#include "RAJA/util/macros.hpp"
+#include "RAJA/util/types.hpp"
+
+#include "RAJA/policy/tbb/policy.hpp"
+
+namespace RAJA
+{
+
+namespace internal
+{
+
+/*!
+ * Partials of a TBB statement::Reduce. TBB privatizes the loop data once
+ * per chunk, so chunks combine into a partial local to the worker thread
+ * and the worker partials are only combined when the Param is updated.
+ */
+template <typename T, template <typename...> class ReduceOperator>
+struct TbbReducePartials {
+
+  ::tbb::combinable<T> values{[]() { return identity(); }};
+
+  static constexpr T identity() { return ReduceOperator<T>::identity(); }
+
+  static T op(T const &a, T const &b) { return ReduceOperator<T>{}(a, b); }
+
+  void combine(T const &partial)
+  {
+    T &local = values.local();
+    local = op(local, partial);
+  }
+
+  T take()
+  {
+    T result = identity();
+    values.combine_each([&](T const &local) { result = op(result, local); });
+    values.clear();
+    return result;
+  }
+};
+
+//
+// Executor that reduces a Param across the tasks of the parallel
+// statements it encloses
+//
+template <template <typename...> class ReduceOperator,
+          typename ParamId,
+          typename... EnclosedStmts,
+          typename Types>
+struct StatementExecutor<
+    statement::Reduce<tbb_reduce, ReduceOperator, ParamId, EnclosedStmts...>, Types> {
+
+  template <typename Data>
+  static RAJA_INLINE void exec(Data &&data)
+  {
+    using value_t = decltype(data.template get_param<ParamId>());
+    using partials_t = TbbReducePartials<value_t, ReduceOperator>;
+
+    execute_host_reduce<partials_t, ParamId, Types>(
+        data, camp::list<EnclosedStmts...>{});
+  }
+};
+
+
+}  // namespace internal
+
+}  // end namespace RAJA
+
+#endif  // closing endif for RAJA_ENABLE_TBB guard
+
+#endif /* RAJA_policy_tbb_kernel_Reduce_HPP */
@@ -22,6 +22,8 @@
 
 #include <cstddef>
 
+#include <tbb/task_arena.h>
+
 namespace RAJA
 {
 namespace policy
@@ -60,6 +62,46 @@ struct tbb_for_static : make_policy_pattern_launch_platform_t<Policy::tbb,
 
 using tbb_for_exec = tbb_for_static<>;
 
+///
+/// Segment execution policies that run inside a user-provided task_arena.
+///
+/// The arena is held by pointer and must outlive every loop launched with
+/// the policy. A null arena runs the loop in the calling thread's current
+/// arena, which makes the default-constructed policy equivalent to its
+/// non-arena counterpart.
+///
+struct tbb_arena_for_dynamic
+    : make_policy_pattern_launch_platform_t<Policy::tbb,
+                                            Pattern::forall,
+                                            Launch::undefined,
+                                            Platform::host> {
+  ::tbb::task_arena* arena;
+  std::size_t grain_size;
+  tbb_arena_for_dynamic(::tbb::task_arena* arena_ = nullptr,
+                        std::size_t grain_size_ = 1)
+      : arena(arena_), grain_size(grain_size_)
+  {
+  }
+  tbb_arena_for_dynamic(::tbb::task_arena& arena_, std::size_t grain_size_ = 1)
+      : arena(&arena_), grain_size(grain_size_)
+  {
+  }
+};
+
+
+template <std::size_t GrainSize = 1>
+struct tbb_arena_for_static
+    : make_policy_pattern_launch_platform_t<Policy::tbb,
+                                            Pattern::forall,
+                                            Launch::undefined,
+                                            Platform::host> {
+  ::tbb::task_arena* arena;
+  tbb_arena_for_static(::tbb::task_arena* arena_ = nullptr) : arena(arena_) {}
+  tbb_arena_for_static(::tbb::task_arena& arena_) : arena(&arena_) {}
+};
+
+using tbb_arena_for_exec = tbb_arena_for_static<>;
+
 ///
 /// Index set segment iteration policies
 ///
@@ -74,6 +116,15 @@ struct tbb_work : make_policy_pattern_launch_platform_t<Policy::tbb,
                                                         Platform::host> {
 };
 
+///
+/// TaskGraph execution policies
+///
+struct tbb_taskgraph : make_policy_pattern_launch_platform_t<Policy::tbb,
+                                                             Pattern::taskgraph,
+                                                             Launch::sync,
+                                                             Platform::host> {
+};
+
 
 ///
 ///////////////////////////////////////////////////////////////////////
@@ -88,14 +139,27 @@ struct tbb_reduce : make_policy_pattern_launch_platform_t<Policy::tbb,
                                                           Platform::host> {
 };
 
+struct tbb_reduce_reproducible
+    : make_policy_pattern_launch_platform_t<Policy::tbb,
+                                            Pattern::reduce,
+                                            Launch::undefined,
+                                            Platform::host,
+                                            reduce::reproducible> {
+};
+
 }  // namespace tbb
 }  // namespace policy
 
+using policy::tbb::tbb_arena_for_dynamic;
+using policy::tbb::tbb_arena_for_exec;
+using policy::tbb::tbb_arena_for_static;
 using policy::tbb::tbb_for_dynamic;
 using policy::tbb::tbb_for_exec;
 using policy::tbb::tbb_for_static;
 using policy::tbb::tbb_reduce;
+using policy::tbb::tbb_reduce_reproducible;
 using policy::tbb::tbb_segit;
+using policy::tbb::tbb_taskgraph;
 using policy::tbb::tbb_work;
 
 }  // namespace RAJA
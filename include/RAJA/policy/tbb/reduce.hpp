@@ -33,6 +33,7 @@
 #include "RAJA/internal/MemUtils_CPU.hpp"
 
 #include "RAJA/pattern/detail/reduce.hpp"
+#include "RAJA/pattern/detail/reduce_reproducible.hpp"
 #include "RAJA/pattern/reduce.hpp"
 
 #include "RAJA/policy/tbb/policy.hpp"
@@ -86,6 +87,8 @@ public:
 
 RAJA_DECLARE_ALL_REDUCERS(tbb_reduce, detail::ReduceTBB)
 
+RAJA_DECLARE_REPRODUCIBLE_SUM_REDUCER(tbb_reduce_reproducible, detail::ReduceTBB)
+
 }  // namespace RAJA
 
 #endif  // closing endif for RAJA_ENABLE_TBB guard
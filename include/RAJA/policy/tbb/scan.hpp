@@ -30,6 +30,7 @@
 #include "RAJA/util/macros.hpp"
 
 #include "RAJA/policy/sequential/policy.hpp"
+#include "RAJA/policy/tbb/arena.hpp"
 
 namespace RAJA
 {
@@ -106,7 +107,7 @@ struct scan_adapter_exclusive : scan_adapter<T, InIter, OutIter, Fn> {
 */
 template <typename ExecPolicy, typename Iter, typename BinFn>
 concepts::enable_if<type_traits::is_tbb_policy<ExecPolicy>> inclusive_inplace(
-    const ExecPolicy&,
+    const ExecPolicy& p,
     Iter begin,
     Iter end,
     BinFn f)
@@ -116,9 +117,12 @@ concepts::enable_if<type_traits::is_tbb_policy<ExecPolicy>> inclusive_inplace(
       Iter,
       Iter,
       BinFn>{begin, begin, f, BinFn::identity()};
-  tbb::parallel_scan(tbb::blocked_range<Index_type>{0,
-                                                    std::distance(begin, end)},
-                     adapter);
+  RAJA::policy::tbb::detail::execute_in_arena(
+      RAJA::policy::tbb::detail::get_arena(p), [&]() {
+        tbb::parallel_scan(
+            tbb::blocked_range<Index_type>{0, std::distance(begin, end)},
+            adapter);
+      });
 }
 
 /*!
@@ -127,7 +131,7 @@ concepts::enable_if<type_traits::is_tbb_policy<ExecPolicy>> inclusive_inplace(
 */
 template <typename ExecPolicy, typename Iter, typename BinFn, typename T>
 concepts::enable_if<type_traits::is_tbb_policy<ExecPolicy>> exclusive_inplace(
-    const ExecPolicy&,
+    const ExecPolicy& p,
     Iter begin,
     Iter end,
     BinFn f,
@@ -138,9 +142,12 @@ concepts::enable_if<type_traits::is_tbb_policy<ExecPolicy>> exclusive_inplace(
       Iter,
       Iter,
       BinFn>{begin, begin, f, v};
-  tbb::parallel_scan(tbb::blocked_range<Index_type>{0,
-                                                    std::distance(begin, end)},
-                     adapter);
+  RAJA::policy::tbb::detail::execute_in_arena(
+      RAJA::policy::tbb::detail::get_arena(p), [&]() {
+        tbb::parallel_scan(
+            tbb::blocked_range<Index_type>{0, std::distance(begin, end)},
+            adapter);
+      });
 }
 
 /*!
@@ -149,7 +156,7 @@ concepts::enable_if<type_traits::is_tbb_policy<ExecPolicy>> exclusive_inplace(
 */
 template <typename ExecPolicy, typename Iter, typename OutIter, typename BinFn>
 concepts::enable_if<type_traits::is_tbb_policy<ExecPolicy>> inclusive(
-    const ExecPolicy&,
+    const ExecPolicy& p,
     const Iter begin,
     const Iter end,
     OutIter out,
@@ -160,9 +167,12 @@ concepts::enable_if<type_traits::is_tbb_policy<ExecPolicy>> inclusive(
       Iter,
       OutIter,
       BinFn>{begin, out, f, BinFn::identity()};
-  tbb::parallel_scan(tbb::blocked_range<Index_type>{0,
-                                                    std::distance(begin, end)},
-                     adapter);
+  RAJA::policy::tbb::detail::execute_in_arena(
+      RAJA::policy::tbb::detail::get_arena(p), [&]() {
+        tbb::parallel_scan(
+            tbb::blocked_range<Index_type>{0, std::distance(begin, end)},
+            adapter);
+      });
 }
 
 /*!
@@ -175,7 +185,7 @@ template <typename ExecPolicy,
           typename BinFn,
           typename T>
 concepts::enable_if<type_traits::is_tbb_policy<ExecPolicy>> exclusive(
-    const ExecPolicy&,
+    const ExecPolicy& p,
     const Iter begin,
     const Iter end,
     OutIter out,
@@ -187,9 +197,12 @@ concepts::enable_if<type_traits::is_tbb_policy<ExecPolicy>> exclusive(
       Iter,
       OutIter,
       BinFn>{begin, out, f, v};
-  tbb::parallel_scan(tbb::blocked_range<Index_type>{0,
-                                                    std::distance(begin, end)},
-                     adapter);
+  RAJA::policy::tbb::detail::execute_in_arena(
+      RAJA::policy::tbb::detail::get_arena(p), [&]() {
+        tbb::parallel_scan(
+            tbb::blocked_range<Index_type>{0, std::distance(begin, end)},
+            adapter);
+      });
 }
 
 }  // namespace scan
@@ -30,6 +30,7 @@
 
 #include "RAJA/util/concepts.hpp"
 
+#include "RAJA/policy/tbb/arena.hpp"
 #include "RAJA/policy/tbb/policy.hpp"
 #include "RAJA/policy/loop/sort.hpp"
 #include "RAJA/pattern/detail/algorithm.hpp"
@@ -46,10 +47,10 @@ namespace detail
 
 /*!
         \brief sort given range using sorter and comparison function
-               by spawning tasks
+               by recursively spawning tasks into a task_group
 */
 template < typename Sorter, typename Iter, typename Compare >
-struct TbbSortTask : tbb::task
+struct TbbSortTask
 {
   using diff_type =
       camp::decay<decltype(camp::val<Iter>() - camp::val<Iter>())>;
@@ -69,7 +70,7 @@ struct TbbSortTask : tbb::task
     , comp(comp_)
   { }
 
-  tbb::task* execute()
+  void operator()() const
   {
     diff_type len = end - begin;
 
@@ -82,22 +83,17 @@ struct TbbSortTask : tbb::task
 
       Iter middle = begin + (len/2);
 
-      // branching nodes break the sorting up recursively
-      TbbSortTask& sort_tank_front =
-          *new( allocate_child() ) TbbSortTask(sorter, begin, middle, comp);
-      TbbSortTask& sort_tank_back =
-          *new( allocate_child() ) TbbSortTask(sorter, middle, end, comp);
-
-      set_ref_count(3);
-      spawn(sort_tank_back);
-      spawn_and_wait_for_all(sort_tank_front);
+      // branching nodes break the sorting up recursively, the back half is
+      // spawned and the front half runs on this thread
+      tbb::task_group group;
+      group.run(TbbSortTask(sorter, middle, end, comp));
+      TbbSortTask(sorter, begin, middle, comp)();
+      group.wait();
 
       // and merge the results
       RAJA::detail::inplace_merge(begin, middle, end, comp);
       //std::inplace_merge(begin, middle, end, comp);
     }
-
-    return nullptr;
   }
 };
 
@@ -106,7 +102,8 @@ struct TbbSortTask : tbb::task
 */
 template <typename Sorter, typename Iter, typename Compare>
 inline
-void tbb_sort(Sorter sorter,
+void tbb_sort(tbb::task_arena* arena,
+              Sorter sorter,
               Iter begin,
               Iter end,
               Compare comp)
@@ -122,9 +119,8 @@ void tbb_sort(Sorter sorter,
 
   } else {
 
-    SortTask& sort_task =
-        *new(tbb::task::allocate_root()) SortTask(sorter, begin, end, comp);
-    tbb::task::spawn_root_and_wait(sort_task);
+    RAJA::policy::tbb::detail::execute_in_arena(
+        arena, SortTask(sorter, begin, end, comp));
 
   }
 }
@@ -136,12 +132,14 @@ void tbb_sort(Sorter sorter,
 */
 template <typename ExecPolicy, typename Iter, typename Compare>
 concepts::enable_if<type_traits::is_tbb_policy<ExecPolicy>>
-unstable(const ExecPolicy&,
+unstable(const ExecPolicy& p,
          Iter begin,
          Iter end,
          Compare comp)
 {
-  tbb::parallel_sort(begin, end, comp);
+  RAJA::policy::tbb::detail::execute_in_arena(
+      RAJA::policy::tbb::detail::get_arena(p),
+      [&]() { tbb::parallel_sort(begin, end, comp); });
 }
 
 /*!
@@ -149,12 +147,13 @@ unstable(const ExecPolicy&,
 */
 template <typename ExecPolicy, typename Iter, typename Compare>
 concepts::enable_if<type_traits::is_tbb_policy<ExecPolicy>>
-stable(const ExecPolicy&,
+stable(const ExecPolicy& p,
        Iter begin,
        Iter end,
        Compare comp)
 {
-  detail::tbb_sort(detail::StableSorter{}, begin, end, comp);
+  detail::tbb_sort(RAJA::policy::tbb::detail::get_arena(p),
+                   detail::StableSorter{}, begin, end, comp);
 }
 
 /*!
@@ -162,7 +161,7 @@ stable(const ExecPolicy&,
 */
 template <typename ExecPolicy, typename KeyIter, typename ValIter, typename Compare>
 concepts::enable_if<type_traits::is_tbb_policy<ExecPolicy>>
-unstable_pairs(const ExecPolicy&,
+unstable_pairs(const ExecPolicy& p,
                KeyIter keys_begin,
                KeyIter keys_end,
                ValIter vals_begin,
@@ -171,7 +170,8 @@ unstable_pairs(const ExecPolicy&,
   auto begin  = RAJA::zip(keys_begin, vals_begin);
   auto end    = RAJA::zip(keys_end, vals_begin+(keys_end-keys_begin));
   using zip_ref = RAJA::detail::IterRef<camp::decay<decltype(begin)>>;
-  detail::tbb_sort(detail::UnstableSorter{}, begin, end, RAJA::compare_first<zip_ref>(comp));
+  detail::tbb_sort(RAJA::policy::tbb::detail::get_arena(p),
+                   detail::UnstableSorter{}, begin, end, RAJA::compare_first<zip_ref>(comp));
 }
 
 /*!
@@ -179,7 +179,7 @@ unstable_pairs(const ExecPolicy&,
 */
 template <typename ExecPolicy, typename KeyIter, typename ValIter, typename Compare>
 concepts::enable_if<type_traits::is_tbb_policy<ExecPolicy>>
-stable_pairs(const ExecPolicy&,
+stable_pairs(const ExecPolicy& p,
              KeyIter keys_begin,
              KeyIter keys_end,
              ValIter vals_begin,
@@ -188,7 +188,8 @@ stable_pairs(const ExecPolicy&,
   auto begin  = RAJA::zip(keys_begin, vals_begin);
   auto end    = RAJA::zip(keys_end, vals_begin+(keys_end-keys_begin));
   using zip_ref = RAJA::detail::IterRef<camp::decay<decltype(begin)>>;
-  detail::tbb_sort(detail::StableSorter{}, begin, end, RAJA::compare_first<zip_ref>(comp));
+  detail::tbb_sort(RAJA::policy::tbb::detail::get_arena(p),
+                   detail::StableSorter{}, begin, end, RAJA::compare_first<zip_ref>(comp));
 }
 
 }  // namespace sort
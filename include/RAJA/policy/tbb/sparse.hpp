@@ -0,0 +1,58 @@
+/*!
+******************************************************************************
+*
+* \file
+*
+* \brief   Header file providing RAJA sparse matrix pattern support for
+*          TBB execution policies.
+*
+******************************************************************************
+*/
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-20, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/COPYRIGHT file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#ifndef RAJA_sparse_tbb_HPP
+#define RAJA_sparse_tbb_HPP
+
+#include "RAJA/config.hpp"
+
+#if defined(RAJA_ENABLE_TBB)
+
+#include <tbb/task_arena.h>
+
+#include "RAJA/util/concepts.hpp"
+
+#include "RAJA/policy/tbb/arena.hpp"
+#include "RAJA/policy/tbb/policy.hpp"
+
+namespace RAJA
+{
+namespace impl
+{
+namespace sparse
+{
+
+/*!
+        \brief one partition per thread of the arena the policy runs in
+*/
+template <typename ExecPolicy>
+concepts::enable_if_t<int, type_traits::is_tbb_policy<ExecPolicy>>
+num_partitions(const ExecPolicy& p)
+{
+  ::tbb::task_arena* arena = ::RAJA::policy::tbb::detail::get_arena(p);
+  return arena ? arena->max_concurrency()
+               : ::tbb::this_task_arena::max_concurrency();
+}
+
+}  // namespace sparse
+}  // namespace impl
+}  // namespace RAJA
+
+#endif  // closing endif for if defined(RAJA_ENABLE_TBB)
+
+#endif  // closing endif for header file include guard
@@ -0,0 +1,82 @@
+/*!
+ ******************************************************************************
+ *
+ * \file
+ *
+ * \brief   Header file containing the TBB TaskGraph executor.
+ *
+ ******************************************************************************
+ */
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-20, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/COPYRIGHT file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#ifndef RAJA_taskgraph_tbb_HPP
+#define RAJA_taskgraph_tbb_HPP
+
+#include "RAJA/config.hpp"
+
+#if defined(RAJA_ENABLE_TBB)
+
+#include <tbb/task_group.h>
+
+#include "RAJA/policy/tbb/policy.hpp"
+
+namespace RAJA
+{
+namespace policy
+{
+namespace tbb
+{
+
+/*!
+ * \brief Runs task n of nodes in group, then runs the successors that
+ *        become ready.
+ */
+template <typename Nodes>
+void taskgraph_spawn(::tbb::task_group &group, Nodes &nodes, size_t n)
+{
+  group.run([&group, &nodes, n] {
+    auto &node = *nodes[n];
+    node.run();
+    for (size_t s : node.successors) {
+      if (nodes[s]->remaining.fetch_sub(1) == 1) {
+        taskgraph_spawn(group, nodes, s);
+      }
+    }
+  });
+}
+
+/*!
+ * \brief Runs the tasks of a tbb_taskgraph in a tbb::task_group, each
+ *        started once its dependences finished.
+ */
+template <typename Nodes>
+RAJA_INLINE void taskgraph_execute_impl(const tbb_taskgraph &, Nodes &nodes)
+{
+  for (auto &node : nodes) {
+    node->remaining.store(node->num_predecessors);
+  }
+
+  ::tbb::task_group group;
+  for (size_t n = 0; n < nodes.size(); ++n) {
+    if (nodes[n]->num_predecessors == 0) {
+      taskgraph_spawn(group, nodes, n);
+    }
+  }
+  group.wait();
+}
+
+}  // namespace tbb
+
+}  // namespace policy
+
+}  // namespace RAJA
+
+#endif  // closing endif for if defined(RAJA_ENABLE_TBB)
+
+#endif  // closing endif for header file include guard
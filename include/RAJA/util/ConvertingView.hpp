@@ -0,0 +1,510 @@
+/*!
+ ******************************************************************************
+ *
+ * \file
+ *
+ * \brief   RAJA header file defining reduced precision storage types and a
+ *          View wrapper that converts between storage and compute types.
+ *
+ ******************************************************************************
+ */
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-20, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/COPYRIGHT file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#ifndef RAJA_util_ConvertingView_HPP
+#define RAJA_util_ConvertingView_HPP
+
+#include "RAJA/config.hpp"
+
+#include <cstdint>
+#include <cstring>
+#include <type_traits>
+
+#if defined(__F16C__) && defined(__AVX__)
+#include <immintrin.h>
+#define RAJA_HAVE_F16C
+#endif
+
+#include "RAJA/index/RangeSegment.hpp"
+
+#include "RAJA/pattern/forall.hpp"
+
+#include "RAJA/policy/simd/policy.hpp"
+
+#include "RAJA/util/View.hpp"
+#include "RAJA/util/macros.hpp"
+#include "RAJA/util/types.hpp"
+
+namespace RAJA
+{
+
+namespace detail
+{
+
+RAJA_HOST_DEVICE RAJA_INLINE std::uint32_t float_as_bits(float f)
+{
+  std::uint32_t u;
+  std::memcpy(&u, &f, sizeof(u));
+  return u;
+}
+
+RAJA_HOST_DEVICE RAJA_INLINE float bits_as_float(std::uint32_t u)
+{
+  float f;
+  std::memcpy(&f, &u, sizeof(f));
+  return f;
+}
+
+/*!
+ * IEEE binary32 to binary16 conversion, round to nearest even.
+ *
+ * Written without data dependent branches so loops over it vectorize.
+ */
+RAJA_HOST_DEVICE RAJA_INLINE std::uint16_t float_to_half_bits(float value)
+{
+  const std::uint32_t f32_infty = 255u << 23;
+  const std::uint32_t f16_max = (127u + 16u) << 23;
+  const std::uint32_t denorm_magic = ((127u - 15u) + (23u - 10u) + 1u) << 23;
+
+  std::uint32_t f = float_as_bits(value);
+  const std::uint32_t sign = f & 0x80000000u;
+  f ^= sign;
+
+  // overflow to infinity, NaN stays a quiet NaN
+  const std::uint32_t inf_nan = (f > f32_infty) ? 0x7e00u : 0x7c00u;
+
+  // subnormal results, let the FPU do the rounding
+  const std::uint32_t denorm =
+      float_as_bits(bits_as_float(f) + bits_as_float(denorm_magic)) -
+      denorm_magic;
+
+  // normal results, rebias the exponent and round the mantissa
+  const std::uint32_t mant_odd = (f >> 13) & 1u;
+  const std::uint32_t normal =
+      (f + (std::uint32_t(15 - 127) << 23) + 0xfffu + mant_odd) >> 13;
+
+  const std::uint32_t out =
+      (f >= f16_max) ? inf_nan : ((f < (113u << 23)) ? denorm : normal);
+
+  return static_cast<std::uint16_t>(out | (sign >> 16));
+}
+
+/*!
+ * IEEE binary16 to binary32 conversion, exact.
+ */
+RAJA_HOST_DEVICE RAJA_INLINE float half_bits_to_float(std::uint16_t h)
+{
+  const std::uint32_t shifted_exp = 0x7c00u << 13;
+  const float magic = bits_as_float(113u << 23);
+
+  std::uint32_t o = (std::uint32_t(h) & 0x7fffu) << 13;
+  const std::uint32_t exp = shifted_exp & o;
+  o += (127u - 15u) << 23;
+
+  const std::uint32_t inf_nan = o + ((128u - 16u) << 23);
+  const std::uint32_t denorm =
+      float_as_bits(bits_as_float(o + (1u << 23)) - magic);
+
+  o = (exp == shifted_exp) ? inf_nan : ((exp == 0) ? denorm : o);
+
+  return bits_as_float(o | ((std::uint32_t(h) & 0x8000u) << 16));
+}
+
+/*!
+ * IEEE binary32 to bfloat16 conversion, round to nearest even.
+ */
+RAJA_HOST_DEVICE RAJA_INLINE std::uint16_t float_to_bfloat16_bits(float value)
+{
+  const std::uint32_t u = float_as_bits(value);
+  const std::uint32_t rounded = (u + 0x7fffu + ((u >> 16) & 1u)) >> 16;
+  const std::uint32_t quiet_nan = (u >> 16) | 0x40u;
+  const bool is_nan = (u & 0x7fffffffu) > 0x7f800000u;
+  return static_cast<std::uint16_t>(is_nan ? quiet_nan : rounded);
+}
+
+RAJA_HOST_DEVICE RAJA_INLINE float bfloat16_bits_to_float(std::uint16_t b)
+{
+  return bits_as_float(std::uint32_t(b) << 16);
+}
+
+}  // namespace detail
+
+
+/*!
+ * IEEE binary16 storage type.
+ *
+ * Only conversions are provided, arithmetic is meant to be done in a wider
+ * type, typically through a ConvertingViewWrapper.
+ */
+struct half {
+  std::uint16_t bits;
+
+  half() = default;
+
+  RAJA_HOST_DEVICE RAJA_INLINE explicit half(float value)
+      : bits(detail::float_to_half_bits(value))
+  {
+  }
+
+  RAJA_HOST_DEVICE RAJA_INLINE operator float() const
+  {
+    return detail::half_bits_to_float(bits);
+  }
+};
+
+/*!
+ * bfloat16 storage type, the upper half of an IEEE binary32.
+ *
+ * Only conversions are provided, arithmetic is meant to be done in a wider
+ * type, typically through a ConvertingViewWrapper.
+ */
+struct bfloat16 {
+  std::uint16_t bits;
+
+  bfloat16() = default;
+
+  RAJA_HOST_DEVICE RAJA_INLINE explicit bfloat16(float value)
+      : bits(detail::float_to_bfloat16_bits(value))
+  {
+  }
+
+  RAJA_HOST_DEVICE RAJA_INLINE operator float() const
+  {
+    return detail::bfloat16_bits_to_float(bits);
+  }
+};
+
+
+/*!
+ * Converts values between the type they are stored as and the type
+ * computations are done in.
+ *
+ * May be specialized for user storage types that are not convertible with
+ * static_cast.
+ */
+template <typename ComputeType, typename StorageType>
+struct StorageConverter {
+
+  RAJA_HOST_DEVICE RAJA_INLINE static ComputeType load(StorageType const &s)
+  {
+    return static_cast<ComputeType>(s);
+  }
+
+  RAJA_HOST_DEVICE RAJA_INLINE static StorageType store(ComputeType c)
+  {
+    return static_cast<StorageType>(c);
+  }
+};
+
+
+/*!
+ * Reference proxy to a StorageType element that reads and writes
+ * ComputeType values, converting on every access.
+ */
+template <typename ComputeType, typename StorageType>
+class ConvertingRef
+{
+public:
+  using value_type = ComputeType;
+  using storage_type = StorageType;
+  using converter_type = StorageConverter<ComputeType, StorageType>;
+
+  RAJA_INLINE
+  RAJA_HOST_DEVICE
+  constexpr explicit ConvertingRef(storage_type *storage_ptr)
+      : m_storage_ptr(storage_ptr){};
+
+  RAJA_INLINE
+  RAJA_HOST_DEVICE
+  constexpr ConvertingRef(ConvertingRef const &c)
+      : m_storage_ptr(c.m_storage_ptr){};
+
+  RAJA_INLINE
+  RAJA_HOST_DEVICE
+  storage_type *getPointer() const { return m_storage_ptr; }
+
+  RAJA_INLINE
+  RAJA_HOST_DEVICE
+  value_type load() const { return converter_type::load(*m_storage_ptr); }
+
+  RAJA_INLINE
+  RAJA_HOST_DEVICE
+  void store(value_type rhs) const { *m_storage_ptr = converter_type::store(rhs); }
+
+  RAJA_INLINE
+  RAJA_HOST_DEVICE
+  operator value_type() const { return load(); }
+
+  RAJA_INLINE
+  RAJA_HOST_DEVICE
+  value_type operator=(value_type rhs) const
+  {
+    store(rhs);
+    return rhs;
+  }
+
+  // assigns the value, not the reference
+  RAJA_INLINE
+  RAJA_HOST_DEVICE
+  value_type operator=(ConvertingRef const &rhs) const
+  {
+    return operator=(rhs.load());
+  }
+
+  RAJA_INLINE
+  RAJA_HOST_DEVICE
+  value_type operator+=(value_type rhs) const { return operator=(load() + rhs); }
+
+  RAJA_INLINE
+  RAJA_HOST_DEVICE
+  value_type operator-=(value_type rhs) const { return operator=(load() - rhs); }
+
+  RAJA_INLINE
+  RAJA_HOST_DEVICE
+  value_type operator*=(value_type rhs) const { return operator=(load() * rhs); }
+
+  RAJA_INLINE
+  RAJA_HOST_DEVICE
+  value_type operator/=(value_type rhs) const { return operator=(load() / rhs); }
+
+private:
+  storage_type *m_storage_ptr;
+};
+
+
+namespace detail
+{
+
+/*!
+ * Element access for ConvertingViewWrapper, read only storage is returned
+ * by value since there is nothing to store back to.
+ */
+template <typename ComputeType, typename StorageType>
+struct ConvertingAccess {
+  using return_type = ConvertingRef<ComputeType, StorageType>;
+
+  RAJA_HOST_DEVICE RAJA_INLINE static return_type make(StorageType &s)
+  {
+    return return_type(&s);
+  }
+};
+
+template <typename ComputeType, typename StorageType>
+struct ConvertingAccess<ComputeType, StorageType const> {
+  using return_type = ComputeType;
+
+  RAJA_HOST_DEVICE RAJA_INLINE static return_type make(StorageType const &s)
+  {
+    return StorageConverter<ComputeType, StorageType>::load(s);
+  }
+};
+
+}  // namespace detail
+
+
+/*!
+ * Wraps a View over reduced precision storage so that it is accessed in
+ * ComputeType.
+ *
+ * Elements are converted on load and store, so kernels do their arithmetic
+ * in ComputeType while memory traffic is that of the storage type. Element
+ * access returns a ConvertingRef proxy, or a ComputeType value for views of
+ * const storage.
+ *
+ *     RAJA::View<RAJA::half, RAJA::Layout<2>> opac_h(opac_data, nx, ny);
+ *     auto opac = RAJA::make_converting_view<double>(opac_h);
+ *
+ *     RAJA::forall<RAJA::simd_exec>(RAJA::RangeSegment(0, ny), [=](int j) {
+ *       sum(i, j) += 0.5 * opac(i, j);
+ *     });
+ *
+ */
+template <typename ComputeType, typename ViewType>
+struct ConvertingViewWrapper {
+  using base_type = ViewType;
+  using pointer_type = typename base_type::pointer_type;
+  using storage_type = typename base_type::value_type;
+  using value_type = ComputeType;
+  using layout_type = typename base_type::layout_type;
+  using access_type = detail::ConvertingAccess<ComputeType, storage_type>;
+  using reference_type = typename access_type::return_type;
+
+  base_type base_;
+
+  RAJA_INLINE
+  constexpr explicit ConvertingViewWrapper(ViewType const &view) : base_{view} {}
+
+  RAJA_INLINE void set_data(pointer_type data_ptr) { base_.set_data(data_ptr); }
+
+  RAJA_HOST_DEVICE RAJA_INLINE constexpr pointer_type const &get_data() const
+  {
+    return base_.get_data();
+  }
+
+  RAJA_HOST_DEVICE RAJA_INLINE constexpr layout_type const &get_layout() const
+  {
+    return base_.get_layout();
+  }
+
+  template <typename... ARGS>
+  RAJA_HOST_DEVICE RAJA_INLINE reference_type operator()(ARGS &&... args) const
+  {
+    return access_type::make(base_.operator()(std::forward<ARGS>(args)...));
+  }
+};
+
+template <typename ComputeType, typename StorageType, typename LayoutType>
+using ConvertingView =
+    ConvertingViewWrapper<ComputeType, View<StorageType, LayoutType>>;
+
+
+template <typename ComputeType, typename ViewType>
+RAJA_INLINE ConvertingViewWrapper<ComputeType, ViewType> make_converting_view(
+    ViewType const &view)
+{
+  return ConvertingViewWrapper<ComputeType, ViewType>(view);
+}
+
+
+namespace detail
+{
+
+template <typename ExecPolicy, typename ComputeType, typename StorageType>
+RAJA_INLINE void convert_load_impl(ExecPolicy const &,
+                                   StorageType const *src,
+                                   ComputeType *dst,
+                                   Index_type len)
+{
+  RAJA::forall<ExecPolicy>(TypedRangeSegment<Index_type>(0, len),
+                           [=](Index_type i) {
+                             dst[i] = StorageConverter<ComputeType,
+                                                       StorageType>::load(src[i]);
+                           });
+}
+
+template <typename ExecPolicy, typename ComputeType, typename StorageType>
+RAJA_INLINE void convert_store_impl(ExecPolicy const &,
+                                    ComputeType const *src,
+                                    StorageType *dst,
+                                    Index_type len)
+{
+  RAJA::forall<ExecPolicy>(TypedRangeSegment<Index_type>(0, len),
+                           [=](Index_type i) {
+                             dst[i] = StorageConverter<ComputeType,
+                                                       StorageType>::store(src[i]);
+                           });
+}
+
+template <typename ComputeType, typename StorageType>
+RAJA_INLINE void convert_load_impl(simd_exec const &,
+                                   StorageType const *RAJA_RESTRICT src,
+                                   ComputeType *RAJA_RESTRICT dst,
+                                   Index_type len)
+{
+  RAJA_SIMD
+  for (Index_type i = 0; i < len; ++i) {
+    dst[i] = StorageConverter<ComputeType, StorageType>::load(src[i]);
+  }
+}
+
+template <typename ComputeType, typename StorageType>
+RAJA_INLINE void convert_store_impl(simd_exec const &,
+                                    ComputeType const *RAJA_RESTRICT src,
+                                    StorageType *RAJA_RESTRICT dst,
+                                    Index_type len)
+{
+  RAJA_SIMD
+  for (Index_type i = 0; i < len; ++i) {
+    dst[i] = StorageConverter<ComputeType, StorageType>::store(src[i]);
+  }
+}
+
+#if defined(RAJA_HAVE_F16C)
+
+// Hardware binary16 conversions, 8 lanes at a time
+
+template <typename ComputeType>
+RAJA_INLINE void convert_load_impl(simd_exec const &,
+                                   half const *RAJA_RESTRICT src,
+                                   ComputeType *RAJA_RESTRICT dst,
+                                   Index_type len)
+{
+  Index_type i = 0;
+  for (; i + 8 <= len; i += 8) {
+    alignas(32) float tmp[8];
+    _mm256_store_ps(tmp,
+                    _mm256_cvtph_ps(_mm_loadu_si128(
+                        reinterpret_cast<__m128i const *>(src + i))));
+    RAJA_SIMD
+    for (Index_type j = 0; j < 8; ++j) {
+      dst[i + j] = static_cast<ComputeType>(tmp[j]);
+    }
+  }
+  for (; i < len; ++i) {
+    dst[i] = static_cast<ComputeType>(static_cast<float>(src[i]));
+  }
+}
+
+template <typename ComputeType>
+RAJA_INLINE void convert_store_impl(simd_exec const &,
+                                    ComputeType const *RAJA_RESTRICT src,
+                                    half *RAJA_RESTRICT dst,
+                                    Index_type len)
+{
+  Index_type i = 0;
+  for (; i + 8 <= len; i += 8) {
+    alignas(32) float tmp[8];
+    RAJA_SIMD
+    for (Index_type j = 0; j < 8; ++j) {
+      tmp[j] = static_cast<float>(src[i + j]);
+    }
+    _mm_storeu_si128(reinterpret_cast<__m128i *>(dst + i),
+                     _mm256_cvtps_ph(_mm256_load_ps(tmp),
+                                     _MM_FROUND_TO_NEAREST_INT));
+  }
+  for (; i < len; ++i) {
+    dst[i] = half(static_cast<float>(src[i]));
+  }
+}
+
+#endif
+
+}  // namespace detail
+
+
+/*!
+ * \brief Converts len contiguous elements of storage to ComputeType.
+ *
+ * Useful to stage a block of a reduced precision field in a wide buffer.
+ * With simd_exec the conversion loop is vectorized, using hardware binary16
+ * conversion instructions when they are available.
+ */
+template <typename ExecPolicy, typename ComputeType, typename StorageType>
+RAJA_INLINE void convert_load(StorageType const *src,
+                              ComputeType *dst,
+                              Index_type len)
+{
+  detail::convert_load_impl(ExecPolicy(), src, dst, len);
+}
+
+/*!
+ * \brief Converts len contiguous ComputeType elements to storage.
+ *
+ * The inverse of convert_load(), values are rounded to nearest even.
+ */
+template <typename ExecPolicy, typename ComputeType, typename StorageType>
+RAJA_INLINE void convert_store(ComputeType const *src,
+                               StorageType *dst,
+                               Index_type len)
+{
+  detail::convert_store_impl(ExecPolicy(), src, dst, len);
+}
+
+}  // namespace RAJA
+
+#endif
@@ -0,0 +1,260 @@
+/*!
+ ******************************************************************************
+ *
+ * \file
+ *
+ * \brief   Header file providing chunk readers for arrays stored in files,
+ *          used by RAJA::stream_forall to process arrays that do not fit
+ *          in memory.
+ *
+ ******************************************************************************
+ */
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-20, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/COPYRIGHT file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#ifndef RAJA_util_FileReader_HPP
+#define RAJA_util_FileReader_HPP
+
+#include "RAJA/config.hpp"
+
+#if !defined(_WIN32)
+
+#include <cerrno>
+#include <cstddef>
+#include <string>
+#include <type_traits>
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include "RAJA/util/macros.hpp"
+#include "RAJA/util/types.hpp"
+
+namespace RAJA
+{
+
+namespace detail
+{
+
+//! open path read only and return its descriptor and size in bytes
+inline int openFileReadOnly(const std::string& path, Index_type& bytes)
+{
+  const int fd = ::open(path.c_str(), O_RDONLY);
+  if (fd < 0) {
+    RAJA_ABORT_OR_THROW("RAJA FileReader: failed to open file");
+  }
+
+  struct stat st;
+  if (::fstat(fd, &st) != 0) {
+    ::close(fd);
+    RAJA_ABORT_OR_THROW("RAJA FileReader: failed to stat file");
+  }
+  bytes = static_cast<Index_type>(st.st_size);
+  return fd;
+}
+
+//! number of values of type T stored after offset bytes of the file open
+//! as fd, which is closed if offset is invalid
+template <typename T>
+Index_type fileValueCount(int fd, Index_type bytes, Index_type offset)
+{
+  if (offset < 0 || offset > bytes ||
+      offset % static_cast<Index_type>(alignof(T)) != 0) {
+    ::close(fd);
+    RAJA_ABORT_OR_THROW("RAJA FileReader: invalid offset");
+  }
+  return (bytes - offset) / static_cast<Index_type>(sizeof(T));
+}
+
+}  // namespace detail
+
+/*!
+ ******************************************************************************
+ *
+ * \brief  Reads chunks of an array of T stored in a file with pread.
+ *
+ * The array starts offset bytes into the file, which allows skipping a
+ * header, and runs to the end of the file. Each chunk is read into a
+ * caller provided buffer.
+ *
+ ******************************************************************************
+ */
+template <typename T>
+class PreadFileReader
+{
+  static_assert(std::is_trivially_copyable<T>::value,
+                "PreadFileReader requires a trivially copyable type");
+
+public:
+  using value_type = T;
+
+  //! load copies values into the buffer passed to it
+  static constexpr bool needs_buffer = true;
+
+  explicit PreadFileReader(const std::string& path, Index_type offset = 0)
+      : m_offset(offset)
+  {
+    Index_type bytes = 0;
+    m_fd = detail::openFileReadOnly(path, bytes);
+    m_size = detail::fileValueCount<T>(m_fd, bytes, offset);
+#if defined(POSIX_FADV_SEQUENTIAL)
+    ::posix_fadvise(m_fd, 0, 0, POSIX_FADV_SEQUENTIAL);
+#endif
+  }
+
+  PreadFileReader(PreadFileReader const&) = delete;
+  PreadFileReader& operator=(PreadFileReader const&) = delete;
+
+  ~PreadFileReader() { ::close(m_fd); }
+
+  //! number of values in the array
+  Index_type size() const { return m_size; }
+
+  /*!
+   * \brief Read values [begin, begin + len) into buffer and return buffer.
+   *
+   * Safe to call concurrently for different ranges and buffers.
+   */
+  const T* load(Index_type begin, Index_type len, T* buffer) const
+  {
+    char* dst = reinterpret_cast<char*>(buffer);
+    size_t remaining = static_cast<size_t>(len) * sizeof(T);
+    off_t pos = static_cast<off_t>(m_offset + begin * sizeof(T));
+
+    while (remaining > 0) {
+      const ssize_t got = ::pread(m_fd, dst, remaining, pos);
+      if (got < 0 && errno == EINTR) {
+        continue;
+      }
+      if (got <= 0) {
+        RAJA_ABORT_OR_THROW("RAJA PreadFileReader: failed to read file");
+      }
+      dst += got;
+      pos += got;
+      remaining -= static_cast<size_t>(got);
+    }
+    return buffer;
+  }
+
+private:
+  int m_fd;
+  Index_type m_offset;
+  Index_type m_size;
+};
+
+/*!
+ ******************************************************************************
+ *
+ * \brief  Reads chunks of an array of T stored in a memory mapped file.
+ *
+ * The array starts offset bytes into the file, which must be a multiple
+ * of alignof(T), and runs to the end of the file. Loading a chunk asks the
+ * kernel to read it ahead and touches each of its pages, so the page
+ * faults are taken by the thread calling load. The returned pointer is
+ * into the mapping, no buffer is used.
+ *
+ ******************************************************************************
+ */
+template <typename T>
+class MappedFileReader
+{
+public:
+  using value_type = T;
+
+  //! load returns a pointer into the mapping and ignores its buffer
+  static constexpr bool needs_buffer = false;
+
+  explicit MappedFileReader(const std::string& path, Index_type offset = 0)
+  {
+    Index_type bytes = 0;
+    const int fd = detail::openFileReadOnly(path, bytes);
+    m_size = detail::fileValueCount<T>(fd, bytes, offset);
+
+    m_page = static_cast<Index_type>(::sysconf(_SC_PAGESIZE));
+    const Index_type map_offset = offset - offset % m_page;
+    m_map_bytes = static_cast<size_t>(bytes - map_offset);
+
+    if (m_map_bytes > 0) {
+      m_map = ::mmap(nullptr,
+                     m_map_bytes,
+                     PROT_READ,
+                     MAP_PRIVATE,
+                     fd,
+                     static_cast<off_t>(map_offset));
+    }
+    ::close(fd);
+    if (m_map == MAP_FAILED) {
+      RAJA_ABORT_OR_THROW("RAJA MappedFileReader: failed to map file");
+    }
+
+    if (m_map_bytes > 0) {
+      ::madvise(m_map, m_map_bytes, MADV_SEQUENTIAL);
+      m_data = reinterpret_cast<const T*>(static_cast<const char*>(m_map) +
+                                          (offset - map_offset));
+    }
+  }
+
+  MappedFileReader(MappedFileReader const&) = delete;
+  MappedFileReader& operator=(MappedFileReader const&) = delete;
+
+  ~MappedFileReader()
+  {
+    if (m_map_bytes > 0) {
+      ::munmap(m_map, m_map_bytes);
+    }
+  }
+
+  //! number of values in the array
+  Index_type size() const { return m_size; }
+
+  //! pointer to the mapped array
+  const T* data() const { return m_data; }
+
+  /*!
+   * \brief Fault in values [begin, begin + len) and return a pointer to
+   *        them in the mapping.
+   */
+  const T* load(Index_type begin, Index_type len, T*) const
+  {
+    if (len <= 0) {
+      return m_data + begin;
+    }
+
+    const char* first = reinterpret_cast<const char*>(m_data + begin);
+    const char* last = reinterpret_cast<const char*>(m_data + begin + len);
+    const char* base = static_cast<const char*>(m_map);
+
+    const Index_type page_begin = ((first - base) / m_page) * m_page;
+    ::madvise(const_cast<char*>(base + page_begin),
+              static_cast<size_t>(last - (base + page_begin)),
+              MADV_WILLNEED);
+
+    volatile char sink = 0;
+    for (const char* p = base + page_begin; p < last; p += m_page) {
+      sink = sink + *p;
+    }
+    (void)sink;
+
+    return m_data + begin;
+  }
+
+private:
+  void* m_map = nullptr;
+  size_t m_map_bytes = 0;
+  Index_type m_page = 0;
+  Index_type m_size = 0;
+  const T* m_data = nullptr;
+};
+
+}  // namespace RAJA
+
+#endif  // !defined(_WIN32)
+
+#endif  // closing endif for header file include guard
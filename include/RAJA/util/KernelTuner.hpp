@@ -0,0 +1,478 @@
+/*!
+ ******************************************************************************
+ *
+ * \file
+ *
+ * \brief   Header file providing an offline tuning harness for
+ *          RAJA::kernel policies.
+ *
+ *          A family of KernelPolicy types is generated from loop orders
+ *          and tile sizes, every member is timed on representative problem
+ *          sizes, and a header is written that maps problem size buckets
+ *          to the fastest member of the family.
+ *
+ ******************************************************************************
+ */
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-20, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/COPYRIGHT file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#ifndef RAJA_util_KernelTuner_HPP
+#define RAJA_util_KernelTuner_HPP
+
+#include "RAJA/config.hpp"
+
+#include <algorithm>
+#include <cctype>
+#include <cstddef>
+#include <limits>
+#include <ostream>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "camp/camp.hpp"
+
+#include "RAJA/pattern/kernel.hpp"
+#include "RAJA/util/Timer.hpp"
+#include "RAJA/util/macros.hpp"
+
+namespace RAJA
+{
+
+namespace detail
+{
+
+template <typename ExecPolicy, camp::idx_t... Order>
+struct tuning_for_nest;
+
+template <typename ExecPolicy>
+struct tuning_for_nest<ExecPolicy> {
+  using type = statement::Lambda<0>;
+};
+
+template <typename ExecPolicy, camp::idx_t First, camp::idx_t... Rest>
+struct tuning_for_nest<ExecPolicy, First, Rest...> {
+  using type =
+      statement::For<First,
+                     ExecPolicy,
+                     typename tuning_for_nest<ExecPolicy, Rest...>::type>;
+};
+
+template <camp::idx_t TileSize,
+          typename ExecPolicy,
+          typename Inner,
+          camp::idx_t... Order>
+struct tuning_tile_nest;
+
+template <camp::idx_t TileSize, typename ExecPolicy, typename Inner>
+struct tuning_tile_nest<TileSize, ExecPolicy, Inner> {
+  using type = Inner;
+};
+
+template <camp::idx_t TileSize,
+          typename ExecPolicy,
+          typename Inner,
+          camp::idx_t First,
+          camp::idx_t... Rest>
+struct tuning_tile_nest<TileSize, ExecPolicy, Inner, First, Rest...> {
+  using type = statement::Tile<
+      First,
+      tile_fixed<TileSize>,
+      ExecPolicy,
+      typename tuning_tile_nest<TileSize, ExecPolicy, Inner, Rest...>::type>;
+};
+
+template <typename OuterExec, typename InnerExec, camp::idx_t... Order>
+struct tuning_loop_order;
+
+template <typename OuterExec,
+          typename InnerExec,
+          camp::idx_t First,
+          camp::idx_t... Rest>
+struct tuning_loop_order<OuterExec, InnerExec, First, Rest...> {
+  using type = KernelPolicy<
+      statement::For<First,
+                     OuterExec,
+                     typename tuning_for_nest<InnerExec, Rest...>::type>>;
+};
+
+template <camp::idx_t TileSize,
+          typename OuterExec,
+          typename InnerExec,
+          camp::idx_t... Order>
+struct tuning_tiled_loop_order;
+
+template <camp::idx_t TileSize,
+          typename OuterExec,
+          typename InnerExec,
+          camp::idx_t First,
+          camp::idx_t... Rest>
+struct tuning_tiled_loop_order<TileSize, OuterExec, InnerExec, First, Rest...> {
+  using type = KernelPolicy<statement::Tile<
+      First,
+      tile_fixed<TileSize>,
+      OuterExec,
+      typename tuning_tile_nest<
+          TileSize,
+          InnerExec,
+          typename tuning_for_nest<InnerExec, First, Rest...>::type,
+          Rest...>::type>>;
+};
+
+template <typename... Lists>
+struct tuning_concat;
+
+template <>
+struct tuning_concat<> {
+  using type = camp::list<>;
+};
+
+template <typename... Ts>
+struct tuning_concat<camp::list<Ts...>> {
+  using type = camp::list<Ts...>;
+};
+
+template <typename... Ts, typename... Us, typename... Rest>
+struct tuning_concat<camp::list<Ts...>, camp::list<Us...>, Rest...>
+    : tuning_concat<camp::list<Ts..., Us...>, Rest...> {
+};
+
+template <camp::idx_t... Order>
+std::string tuning_order_name(camp::idx_seq<Order...>)
+{
+  std::string name = "order (";
+  std::string sep = "";
+  int dummy[] = {0, (name += sep + std::to_string(Order), sep = ",", 0)...};
+  RAJA_UNUSED_VAR(dummy);
+  return name + ")";
+}
+
+}  // namespace detail
+
+/*!
+ * For loops nested in the given order, outermost first. The outermost loop
+ * runs with OuterExec and the others with InnerExec.
+ */
+template <typename OuterExec, typename InnerExec, camp::idx_t... Order>
+using loop_order_policy =
+    typename detail::tuning_loop_order<OuterExec, InnerExec, Order...>::type;
+
+/*!
+ * Same as loop_order_policy with every loop tiled by TileSize. The tile
+ * loops are nested in the same order as the loops within a tile, and the
+ * outermost tile loop runs with OuterExec.
+ */
+template <camp::idx_t TileSize,
+          typename OuterExec,
+          typename InnerExec,
+          camp::idx_t... Order>
+using tiled_loop_order_policy =
+    typename detail::tuning_tiled_loop_order<TileSize,
+                                             OuterExec,
+                                             InnerExec,
+                                             Order...>::type;
+
+/*!
+ * All loops collapsed into one loop run with CollapseExec, for example
+ * omp_parallel_collapse_exec, in the given order.
+ */
+template <typename CollapseExec, camp::idx_t... Order>
+using collapse_loop_order_policy = KernelPolicy<
+    statement::Collapse<CollapseExec,
+                        ArgList<Order...>,
+                        statement::Lambda<0>>>;
+
+//! Concatenate camp::lists of policies, to tune hand written policies too
+template <typename... Lists>
+using join_policy_lists = typename detail::tuning_concat<Lists...>::type;
+
+/*!
+ * Every loop order of an N deep loop nest as camp::idx_seq types, given
+ * outermost loop first.
+ */
+template <camp::idx_t N>
+struct loop_orders;
+
+template <>
+struct loop_orders<1> {
+  using type = camp::list<camp::idx_seq<0>>;
+};
+
+template <>
+struct loop_orders<2> {
+  using type = camp::list<camp::idx_seq<0, 1>, camp::idx_seq<1, 0>>;
+};
+
+template <>
+struct loop_orders<3> {
+  using type = camp::list<camp::idx_seq<0, 1, 2>,
+                          camp::idx_seq<0, 2, 1>,
+                          camp::idx_seq<1, 0, 2>,
+                          camp::idx_seq<1, 2, 0>,
+                          camp::idx_seq<2, 0, 1>,
+                          camp::idx_seq<2, 1, 0>>;
+};
+
+template <camp::idx_t N>
+using loop_orders_t = typename loop_orders<N>::type;
+
+/*!
+ * For each loop order in Orders, the untiled loop_order_policy followed by
+ * a tiled_loop_order_policy for each size in TileSizes, a camp::idx_seq.
+ *
+ * type is the camp::list of policies and names() describes each of them in
+ * the same order.
+ */
+template <typename OuterExec,
+          typename InnerExec,
+          typename Orders,
+          typename TileSizes>
+struct kernel_policy_family;
+
+template <typename OuterExec,
+          typename InnerExec,
+          typename Order,
+          typename TileSizes>
+struct kernel_policy_order_family;
+
+template <typename OuterExec,
+          typename InnerExec,
+          camp::idx_t... Order,
+          camp::idx_t... TileSizes>
+struct kernel_policy_order_family<OuterExec,
+                                  InnerExec,
+                                  camp::idx_seq<Order...>,
+                                  camp::idx_seq<TileSizes...>> {
+  using type = camp::list<
+      loop_order_policy<OuterExec, InnerExec, Order...>,
+      tiled_loop_order_policy<TileSizes, OuterExec, InnerExec, Order...>...>;
+
+  static void append_names(std::vector<std::string> &names)
+  {
+    const std::string order = detail::tuning_order_name(camp::idx_seq<Order...>{});
+    names.push_back(order);
+    int dummy[] = {
+        0, (names.push_back(order + " tile " + std::to_string(TileSizes)), 0)...};
+    RAJA_UNUSED_VAR(dummy);
+  }
+};
+
+template <typename OuterExec,
+          typename InnerExec,
+          typename... Orders,
+          typename TileSizes>
+struct kernel_policy_family<OuterExec,
+                            InnerExec,
+                            camp::list<Orders...>,
+                            TileSizes> {
+  using type = join_policy_lists<typename kernel_policy_order_family<
+      OuterExec,
+      InnerExec,
+      Orders,
+      TileSizes>::type...>;
+
+  static std::vector<std::string> names()
+  {
+    std::vector<std::string> names;
+    int dummy[] = {0,
+                   (kernel_policy_order_family<OuterExec,
+                                               InnerExec,
+                                               Orders,
+                                               TileSizes>::append_names(names),
+                    0)...};
+    RAJA_UNUSED_VAR(dummy);
+    return names;
+  }
+};
+
+/*!
+ * Runs and times the members of a camp::list of KernelPolicy types with the
+ * same segment tuple and body. Policies are numbered by their position in
+ * the list.
+ */
+template <typename PolicyList>
+class KernelTuner;
+
+template <typename... Policies>
+class KernelTuner<camp::list<Policies...>>
+{
+public:
+  static constexpr size_t num_policies = sizeof...(Policies);
+
+  //! run RAJA::kernel with the policy at position index
+  template <typename SegmentTuple, typename Body>
+  static void run(size_t index, SegmentTuple const &segments, Body const &body)
+  {
+    if (index >= num_policies) {
+      RAJA_ABORT_OR_THROW("KernelTuner: policy index out of range");
+    }
+    size_t i = 0;
+    int dummy[] = {0,
+                   (i++ == index ? (RAJA::kernel<Policies>(segments, body), 0)
+                                 : 0)...};
+    RAJA_UNUSED_VAR(dummy);
+  }
+
+  /*!
+   * Time each policy in seconds: one untimed run to warm up, then the
+   * fastest of reps runs.
+   */
+  template <typename SegmentTuple, typename Body>
+  static std::vector<double> time(SegmentTuple const &segments,
+                                  Body const &body,
+                                  int reps = 3)
+  {
+    std::vector<double> times;
+    times.reserve(num_policies);
+    int dummy[] = {
+        0, (times.push_back(time_policy<Policies>(segments, body, reps)), 0)...};
+    RAJA_UNUSED_VAR(dummy);
+    return times;
+  }
+
+private:
+  template <typename Policy, typename SegmentTuple, typename Body>
+  static double time_policy(SegmentTuple const &segments,
+                            Body const &body,
+                            int reps)
+  {
+    RAJA::kernel<Policy>(segments, body);
+
+    double best = std::numeric_limits<double>::max();
+    for (int r = 0; r < reps; ++r) {
+      RAJA::Timer timer;
+      timer.start();
+      RAJA::kernel<Policy>(segments, body);
+      timer.stop();
+      best = std::min(best, static_cast<double>(timer.elapsed()));
+    }
+    return best;
+  }
+};
+
+/*!
+ * Fastest policy for each tuned problem size.
+ *
+ * Sizes are kept in increasing order. A problem of size n uses the policy
+ * of the smallest tuned size that is not less than n, and problems larger
+ * than every tuned size use the policy of the largest one.
+ */
+class KernelTuningTable
+{
+public:
+  KernelTuningTable() = default;
+
+  explicit KernelTuningTable(std::vector<std::string> policy_names)
+      : names(std::move(policy_names))
+  {
+  }
+
+  //! record the times from KernelTuner::time for a problem size
+  void add(long size, std::vector<double> const &times)
+  {
+    if (times.empty()) {
+      RAJA_ABORT_OR_THROW("KernelTuningTable: no times given");
+    }
+    Entry entry{size,
+                static_cast<size_t>(
+                    std::min_element(times.begin(), times.end()) -
+                    times.begin()),
+                times};
+    auto pos = std::find_if(entries.begin(),
+                            entries.end(),
+                            [=](Entry const &e) { return e.size >= size; });
+    if (pos != entries.end() && pos->size == size) {
+      *pos = entry;
+    } else {
+      entries.insert(pos, entry);
+    }
+  }
+
+  //! position of the policy to use for a problem of the given size
+  size_t best(long size) const
+  {
+    if (entries.empty()) {
+      RAJA_ABORT_OR_THROW("KernelTuningTable: no sizes tuned");
+    }
+    for (Entry const &e : entries) {
+      if (size <= e.size) {
+        return e.best;
+      }
+    }
+    return entries.back().best;
+  }
+
+  size_t num_sizes() const { return entries.size(); }
+
+  /*!
+   * Write a header defining namespace <name>_tuning with
+   * select_policy(size), which returns the same position as best(size)
+   * without rerunning the tuning.
+   */
+  void write_header(std::ostream &os, std::string const &name) const
+  {
+    if (entries.empty()) {
+      RAJA_ABORT_OR_THROW("KernelTuningTable: no sizes tuned");
+    }
+
+    std::string guard = name + "_TUNING_HPP";
+    std::transform(guard.begin(), guard.end(), guard.begin(), [](char c) {
+      return static_cast<char>(std::toupper(static_cast<unsigned char>(c)));
+    });
+
+    os << "// Generated by RAJA::KernelTuningTable, do not edit.\n"
+       << "#ifndef " << guard << "\n"
+       << "#define " << guard << "\n\n"
+       << "#include <cstddef>\n\n"
+       << "namespace " << name << "_tuning\n{\n\n";
+
+    for (Entry const &e : entries) {
+      os << "// size " << e.size << ": policy " << e.best;
+      if (e.best < names.size()) {
+        os << ", " << names[e.best];
+      }
+      os << ", " << e.times[e.best] << " s\n";
+    }
+
+    os << "\nconstexpr long size_bounds[] = {";
+    for (size_t i = 0; i < entries.size(); ++i) {
+      os << (i ? ", " : "") << entries[i].size;
+    }
+    os << "};\n"
+       << "constexpr std::size_t best_policy[] = {";
+    for (size_t i = 0; i < entries.size(); ++i) {
+      os << (i ? ", " : "") << entries[i].best;
+    }
+    os << "};\n\n"
+       << "inline std::size_t select_policy(long size)\n{\n"
+       << "  for (std::size_t b = 0; b + 1 < " << entries.size()
+       << "; ++b) {\n"
+       << "    if (size <= size_bounds[b]) {\n"
+       << "      return best_policy[b];\n"
+       << "    }\n"
+       << "  }\n"
+       << "  return best_policy[" << entries.size() - 1 << "];\n"
+       << "}\n\n"
+       << "}  // namespace " << name << "_tuning\n\n"
+       << "#endif\n";
+  }
+
+private:
+  struct Entry {
+    long size;
+    size_t best;
+    std::vector<double> times;
+  };
+
+  std::vector<std::string> names;
+  std::vector<Entry> entries;
+};
+
+}  // namespace RAJA
+
+#endif  // closing endif for header file include guard
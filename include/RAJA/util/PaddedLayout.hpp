@@ -0,0 +1,301 @@
+/*!
+ ******************************************************************************
+ *
+ * \file
+ *
+ * \brief   RAJA header file defining padded Layout constructors and View
+ *          helpers that allocate matching aligned storage.
+ *
+ ******************************************************************************
+ */
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-20, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/COPYRIGHT file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#ifndef RAJA_PADDEDLAYOUT_HPP
+#define RAJA_PADDEDLAYOUT_HPP
+
+#include "RAJA/config.hpp"
+
+#include <array>
+#include <cstddef>
+
+#include "RAJA/index/IndexValue.hpp"
+
+#include "RAJA/internal/MemUtils_CPU.hpp"
+
+#include "RAJA/util/Layout.hpp"
+#include "RAJA/util/OffsetLayout.hpp"
+#include "RAJA/util/Permutations.hpp"
+#include "RAJA/util/PermutedLayout.hpp"
+#include "RAJA/util/View.hpp"
+
+namespace RAJA
+{
+
+/*!
+ * Default size in bytes of the stride pattern that make_aligned_layout
+ * avoids. Strides that are a multiple of this size map consecutive rows
+ * onto the same L1 cache sets and trigger 4K aliasing of loads and stores.
+ */
+constexpr size_t LAYOUT_CONFLICT_BYTES = 4096;
+
+/*!
+ * @brief Creates a permuted Layout with padded dimensions.
+ *
+ * padding[i] extra elements are added to the extent of dimension i when
+ * the strides are computed. The logical sizes of the layout are unchanged,
+ * so bounds checks and size() still refer to the unpadded extents, while
+ * toIndices() inverts the padded mapping. Padding the stride-1 dimension
+ * pads every row, padding an outer dimension pads every plane. Padding of
+ * the dimension with the longest stride only affects the storage size.
+ *
+ * Use layout_storage_size() to get the number of elements that must be
+ * allocated for the padded layout.
+ *
+ *     // 256x256 rows of 64 doubles, pad the middle dimension by one row
+ *     auto layout = make_padded_layout({{256, 256, 64}},
+ *                                      {{0, 1, 0}},
+ *                                      as_array<PERM_IJK>::get());
+ *
+ */
+template <size_t Rank, typename IdxLin = Index_type>
+auto make_padded_layout(std::array<IdxLin, Rank> sizes,
+                        std::array<IdxLin, Rank> padding,
+                        std::array<camp::idx_t, Rank> permutation)
+    -> Layout<Rank, IdxLin>
+{
+  std::array<IdxLin, Rank> extents;
+  for (size_t i = 0; i < Rank; ++i) {
+    // Zero sized dimensions are not padded, they have zero stride
+    extents[i] = sizes[i] ? sizes[i] + padding[i] : 1;
+  }
+
+  std::array<IdxLin, Rank> strides;
+  IdxLin stride = 1;
+  for (size_t i = Rank; i > 0; --i) {
+    camp::idx_t dim = permutation[i - 1];
+    strides[dim] = sizes[dim] ? stride : 0;
+    stride *= extents[dim];
+  }
+
+  auto ret = Layout<Rank, IdxLin>();
+  for (size_t i = 0; i < Rank; ++i) {
+    ret.sizes[i] = sizes[i];
+    ret.strides[i] = strides[i];
+    ret.inv_strides[i] = strides[i] ? strides[i] : 1;
+    ret.inv_mods[i] = extents[i];
+  }
+  return ret;
+}
+
+/*!
+ * @brief Computes per-dimension padding for an aligned, conflict free layout.
+ *
+ * The stride-1 dimension is padded so that each row starts on an
+ * alignment byte boundary, given the first element is aligned. Then,
+ * moving outward in the striding order, the extent of each dimension is
+ * grown by one whenever the next stride would be a multiple of
+ * conflict_bytes (a power-of-two extent usually is). The outermost
+ * dimension is never padded.
+ *
+ * An alignment that is not a multiple of sizeof(ValueType) is ignored, a
+ * conflict_bytes of zero disables the conflict padding.
+ */
+template <typename ValueType, size_t Rank, typename IdxLin = Index_type>
+std::array<IdxLin, Rank> make_aligned_layout_padding(
+    std::array<IdxLin, Rank> sizes,
+    std::array<camp::idx_t, Rank> permutation,
+    size_t alignment = DATA_ALIGN,
+    size_t conflict_bytes = LAYOUT_CONFLICT_BYTES)
+{
+  const IdxLin align_elems =
+      (alignment >= sizeof(ValueType) && alignment % sizeof(ValueType) == 0)
+          ? static_cast<IdxLin>(alignment / sizeof(ValueType))
+          : IdxLin(1);
+  const IdxLin conflict_elems =
+      static_cast<IdxLin>(conflict_bytes / sizeof(ValueType));
+
+  std::array<IdxLin, Rank> padding;
+  for (size_t i = 0; i < Rank; ++i) {
+    padding[i] = 0;
+  }
+
+  IdxLin stride = 1;
+  for (size_t i = Rank; i > 1; --i) {
+    camp::idx_t dim = permutation[i - 1];
+    if (!sizes[dim]) {
+      continue;
+    }
+
+    // grow the stride-1 dimension in whole alignment units to keep the rows
+    // aligned, outer strides are already aligned so grow them by one
+    const IdxLin step = (i == Rank) ? align_elems : IdxLin(1);
+    IdxLin extent = ((sizes[dim] + step - 1) / step) * step;
+
+    // stride is never a multiple of conflict_elems here, so stride * extent
+    // and stride * (extent + step) cannot both be
+    if (conflict_elems > align_elems && (stride * extent) % conflict_elems == 0) {
+      extent += step;
+    }
+
+    padding[dim] = extent - sizes[dim];
+    stride *= extent;
+  }
+
+  return padding;
+}
+
+/*!
+ * @brief Creates a permuted Layout padded for alignment and to avoid cache
+ * set conflicts.
+ *
+ * Padding is computed with make_aligned_layout_padding() for elements of
+ * ValueType. Pair it with make_aligned_view() to allocate storage whose
+ * first element is aligned to RAJA::DATA_ALIGN.
+ *
+ *     // 256x256x64 doubles: rows of 64 stay dense (512 bytes), the middle
+ *     // extent is padded to 257 so planes no longer stride by 128KB
+ *     auto layout = make_aligned_layout<double>({{256, 256, 64}},
+ *                                               as_array<PERM_IJK>::get());
+ *
+ */
+template <typename ValueType, size_t Rank, typename IdxLin = Index_type>
+auto make_aligned_layout(std::array<IdxLin, Rank> sizes,
+                         std::array<camp::idx_t, Rank> permutation,
+                         size_t alignment = DATA_ALIGN,
+                         size_t conflict_bytes = LAYOUT_CONFLICT_BYTES)
+    -> Layout<Rank, IdxLin>
+{
+  return make_padded_layout<Rank, IdxLin>(
+      sizes,
+      make_aligned_layout_padding<ValueType, Rank, IdxLin>(sizes,
+                                                           permutation,
+                                                           alignment,
+                                                           conflict_bytes),
+      permutation);
+}
+
+/*!
+ * @brief Creates a padded OffsetLayout, see make_padded_layout().
+ */
+template <size_t Rank, typename IdxLin = Index_type>
+auto make_padded_offset_layout(const std::array<IdxLin, Rank>& lower,
+                               const std::array<IdxLin, Rank>& upper,
+                               const std::array<IdxLin, Rank>& padding,
+                               const std::array<camp::idx_t, Rank>& permutation)
+    -> OffsetLayout<Rank, IdxLin>
+{
+  std::array<IdxLin, Rank> sizes;
+  for (size_t i = 0; i < Rank; ++i) {
+    sizes[i] = upper[i] - lower[i] + 1;
+  }
+  return internal::OffsetLayout_impl<camp::make_idx_seq_t<Rank>, IdxLin>::
+      from_layout_and_offsets(lower,
+                              make_padded_layout(sizes, padding, permutation));
+}
+
+/*!
+ * @brief Creates an aligned, conflict padded OffsetLayout, see
+ * make_aligned_layout().
+ */
+template <typename ValueType, size_t Rank, typename IdxLin = Index_type>
+auto make_aligned_offset_layout(const std::array<IdxLin, Rank>& lower,
+                                const std::array<IdxLin, Rank>& upper,
+                                const std::array<camp::idx_t, Rank>& permutation,
+                                size_t alignment = DATA_ALIGN,
+                                size_t conflict_bytes = LAYOUT_CONFLICT_BYTES)
+    -> OffsetLayout<Rank, IdxLin>
+{
+  std::array<IdxLin, Rank> sizes;
+  for (size_t i = 0; i < Rank; ++i) {
+    sizes[i] = upper[i] - lower[i] + 1;
+  }
+  return make_padded_offset_layout<Rank, IdxLin>(
+      lower,
+      upper,
+      make_aligned_layout_padding<ValueType, Rank, IdxLin>(sizes,
+                                                           permutation,
+                                                           alignment,
+                                                           conflict_bytes),
+      permutation);
+}
+
+/*!
+ * @brief Number of elements of storage addressed by a layout.
+ *
+ * Unlike size(), which is the product of the logical sizes, this is one
+ * past the largest linear index and accounts for padding.
+ */
+template <camp::idx_t... RangeInts, typename IdxLin, ptrdiff_t StrideOneDim>
+RAJA_INLINE IdxLin layout_storage_size(
+    detail::LayoutBase_impl<camp::idx_seq<RangeInts...>, IdxLin, StrideOneDim>
+        const& layout)
+{
+  IdxLin storage = 1;
+  for (size_t i = 0; i < sizeof...(RangeInts); ++i) {
+    if (!layout.sizes[i]) {
+      return 0;
+    }
+    storage += (layout.sizes[i] - 1) * layout.strides[i];
+  }
+  return storage;
+}
+
+template <camp::idx_t... RangeInts, typename IdxLin>
+RAJA_INLINE IdxLin layout_storage_size(
+    internal::OffsetLayout_impl<camp::idx_seq<RangeInts...>, IdxLin> const&
+        layout)
+{
+  return layout_storage_size(layout.base_);
+}
+
+/*!
+ * @brief Allocates storage for a View over layout and returns the View.
+ *
+ * The data is aligned to RAJA::DATA_ALIGN (or alignof(ValueType) if that is
+ * larger) and holds layout_storage_size(layout) elements, which are left
+ * uninitialized. The storage is owned by the caller and must be released
+ * with free_aligned_view().
+ *
+ *     auto layout = make_aligned_layout<double>({{n, n}},
+ *                                               as_array<PERM_IJ>::get());
+ *     auto view = make_aligned_view<double>(layout);
+ *     ...
+ *     free_aligned_view(view);
+ *
+ */
+template <typename ValueType, typename LayoutType>
+View<ValueType, LayoutType> make_aligned_view(LayoutType const& layout)
+{
+  const size_t alignment = alignof(ValueType) > size_t(DATA_ALIGN)
+                               ? alignof(ValueType)
+                               : size_t(DATA_ALIGN);
+
+  // aligned_alloc requires the size to be a multiple of the alignment
+  size_t bytes = static_cast<size_t>(layout_storage_size(layout)) *
+                 sizeof(ValueType);
+  bytes = ((bytes + alignment - 1) / alignment) * alignment;
+
+  ValueType* data = allocate_aligned_type<ValueType>(alignment,
+                                                     bytes ? bytes : alignment);
+  return View<ValueType, LayoutType>(data, layout);
+}
+
+/*!
+ * @brief Frees the storage of a View created with make_aligned_view().
+ */
+template <typename ValueType, typename LayoutType>
+void free_aligned_view(internal::ViewBase<ValueType, ValueType*, LayoutType>& view)
+{
+  free_aligned(view.get_data());
+  view.set_data(nullptr);
+}
+
+}  // namespace RAJA
+
+#endif
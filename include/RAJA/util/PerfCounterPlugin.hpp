@@ -0,0 +1,58 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-20, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/COPYRIGHT file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#ifndef RAJA_Perf_Counter_Plugin_HPP
+#define RAJA_Perf_Counter_Plugin_HPP
+
+#include <string>
+
+#include "RAJA/util/PluginOptions.hpp"
+#include "RAJA/util/PluginStrategy.hpp"
+
+namespace RAJA {
+namespace util {
+
+  /*!
+   * Plugin that reads Linux perf_event hardware counters around each host
+   * kernel launch: cycles, instructions, last level cache misses and
+   * backend stalled cycles.
+   *
+   * The plugin does nothing unless the RAJA_PERF_COUNTERS environment
+   * variable is set. Launches are grouped by the call site of the launch,
+   * and the report is written at finalize, to stdout if RAJA_PERF_COUNTERS
+   * is "1" or "stdout" and otherwise to the file it names.
+   *
+   * Counters are opened for each thread that launches kernels. When RAJA is
+   * built with OpenMP, launches made outside of a parallel region also read
+   * the counters of the other OpenMP threads, so counts include the whole
+   * team. The launching thread reads its own counters with rdpmc when the
+   * kernel allows it. Counters that cannot be opened are reported as
+   * unavailable, and if none can be opened the plugin disables itself.
+   */
+  class PerfCounterPlugin : public ::RAJA::util::PluginStrategy
+  {
+  public:
+    PerfCounterPlugin();
+
+    void preLaunch(const RAJA::util::PluginContext& p) override;
+
+    void postLaunch(const RAJA::util::PluginContext& p) override;
+
+    void finalize() override;
+
+  private:
+    bool enabled;
+    std::string output;
+
+  };  // end PerfCounterPlugin class
+
+  void linkPerfCounterPlugin();
+
+}  // end namespace util
+}  // end namespace RAJA
+
+#endif
@@ -0,0 +1,241 @@
+/*!
+ ******************************************************************************
+ *
+ * \file
+ *
+ * \brief   RAJA header file defining sparse matrix views in CSR and
+ *          SELL-C-sigma formats.
+ *
+ ******************************************************************************
+ */
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-20, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/COPYRIGHT file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#ifndef RAJA_util_SparseView_HPP
+#define RAJA_util_SparseView_HPP
+
+#include "RAJA/config.hpp"
+
+#include <algorithm>
+#include <numeric>
+#include <type_traits>
+#include <vector>
+
+#include "camp/camp.hpp"
+
+#include "RAJA/util/macros.hpp"
+#include "RAJA/util/types.hpp"
+
+namespace RAJA
+{
+
+/*!
+ * \brief Non-owning view of a sparse matrix in compressed sparse row format.
+ *
+ * row_ptr holds num_rows + 1 offsets into col_idx and values, the nonzeros
+ * of row r are [row_ptr[r], row_ptr[r+1]).
+ *
+ *     RAJA::CSRView<double> A(nrows, ncols, row_ptr, col_idx, vals);
+ *     RAJA::spmv(RAJA::omp_parallel_for_exec{}, A, x, y);
+ *
+ */
+template <typename ValueType, typename IndexType = Index_type>
+struct CSRView {
+  using value_type = ValueType;
+  using index_type = IndexType;
+
+  IndexType num_rows;
+  IndexType num_cols;
+  IndexType const* row_ptr;
+  IndexType const* col_idx;
+  ValueType* values;
+
+  RAJA_HOST_DEVICE RAJA_INLINE constexpr CSRView(IndexType num_rows_,
+                                                 IndexType num_cols_,
+                                                 IndexType const* row_ptr_,
+                                                 IndexType const* col_idx_,
+                                                 ValueType* values_)
+      : num_rows(num_rows_),
+        num_cols(num_cols_),
+        row_ptr(row_ptr_),
+        col_idx(col_idx_),
+        values(values_)
+  {
+  }
+
+  //! number of stored nonzeros
+  RAJA_HOST_DEVICE RAJA_INLINE constexpr IndexType nnz() const
+  {
+    return row_ptr[num_rows] - row_ptr[0];
+  }
+
+  RAJA_HOST_DEVICE RAJA_INLINE constexpr IndexType row_begin(IndexType r) const
+  {
+    return row_ptr[r];
+  }
+
+  RAJA_HOST_DEVICE RAJA_INLINE constexpr IndexType row_end(IndexType r) const
+  {
+    return row_ptr[r + 1];
+  }
+
+  RAJA_HOST_DEVICE RAJA_INLINE constexpr IndexType row_length(IndexType r) const
+  {
+    return row_ptr[r + 1] - row_ptr[r];
+  }
+};
+
+
+/*!
+ * \brief Non-owning view of a sparse matrix in SELL-C-sigma format.
+ *
+ * Rows are sorted by length within windows of sigma rows and grouped into
+ * chunks of ChunkSize consecutive (sorted) rows. Each chunk is stored
+ * column major and padded to its longest row, so element j of lane l of
+ * chunk c is at chunk_ptr[c] + j * ChunkSize + l. Padding has value zero
+ * and a valid column index. row_perm maps a sorted slot to its row;
+ * slots past num_rows in the last chunk are padding.
+ *
+ * Lanes of a chunk are independent, which is what makes the format
+ * vectorizable. Use SellMatrix to build one from CSR data.
+ */
+template <typename ValueType,
+          camp::idx_t ChunkSize,
+          typename IndexType = Index_type>
+struct SellView {
+  static_assert(ChunkSize > 0, "SELL chunk size must be positive");
+
+  using value_type = ValueType;
+  using index_type = IndexType;
+  static constexpr camp::idx_t chunk_size = ChunkSize;
+
+  IndexType num_rows;
+  IndexType num_cols;
+  IndexType const* chunk_ptr;
+  IndexType const* row_perm;
+  IndexType const* col_idx;
+  ValueType* values;
+
+  RAJA_HOST_DEVICE RAJA_INLINE constexpr IndexType num_chunks() const
+  {
+    return (num_rows + ChunkSize - 1) / ChunkSize;
+  }
+
+  //! number of stored elements of chunk c in each lane, including padding
+  RAJA_HOST_DEVICE RAJA_INLINE constexpr IndexType chunk_width(IndexType c) const
+  {
+    return (chunk_ptr[c + 1] - chunk_ptr[c]) / ChunkSize;
+  }
+};
+
+
+/*!
+ * \brief Owning SELL-C-sigma matrix built from CSR data on the host.
+ *
+ * sigma is the sorting window in rows. A sigma of 1 keeps the original row
+ * order, a sigma of num_rows sorts all rows by length, which minimizes
+ * padding at the cost of locality in the result vector.
+ */
+template <typename ValueType,
+          camp::idx_t ChunkSize,
+          typename IndexType = Index_type>
+class SellMatrix
+{
+public:
+  using value_type = typename std::remove_const<ValueType>::type;
+  using view_type = SellView<ValueType, ChunkSize, IndexType>;
+
+  SellMatrix(CSRView<ValueType, IndexType> const& csr, IndexType sigma)
+      : m_num_rows(csr.num_rows), m_num_cols(csr.num_cols)
+  {
+    const IndexType n = csr.num_rows;
+    const IndexType C = static_cast<IndexType>(ChunkSize);
+    const IndexType nchunks = (n + C - 1) / C;
+    if (sigma < 1) {
+      sigma = 1;
+    }
+
+    // sort rows by decreasing length within each sigma window
+    m_row_perm.resize(nchunks * C);
+    std::iota(m_row_perm.begin(), m_row_perm.begin() + n, IndexType(0));
+    for (IndexType w = 0; w < n; w += sigma) {
+      const IndexType w_end = std::min(n, w + sigma);
+      std::stable_sort(m_row_perm.begin() + w,
+                       m_row_perm.begin() + w_end,
+                       [&](IndexType a, IndexType b) {
+                         return csr.row_length(a) > csr.row_length(b);
+                       });
+    }
+    // padding slots point at row 0 but are never written
+    std::fill(m_row_perm.begin() + n, m_row_perm.end(), IndexType(0));
+
+    m_chunk_ptr.resize(nchunks + 1);
+    m_chunk_ptr[0] = 0;
+    for (IndexType c = 0; c < nchunks; ++c) {
+      IndexType width = 0;
+      for (IndexType l = 0; l < C; ++l) {
+        const IndexType s = c * C + l;
+        if (s < n) {
+          width = std::max(width, csr.row_length(m_row_perm[s]));
+        }
+      }
+      m_chunk_ptr[c + 1] = m_chunk_ptr[c] + width * C;
+    }
+
+    m_col_idx.assign(m_chunk_ptr[nchunks], IndexType(0));
+    m_values.assign(m_chunk_ptr[nchunks], value_type(0));
+    for (IndexType c = 0; c < nchunks; ++c) {
+      for (IndexType l = 0; l < C; ++l) {
+        const IndexType s = c * C + l;
+        if (s >= n) {
+          continue;
+        }
+        const IndexType r = m_row_perm[s];
+        IndexType pos = m_chunk_ptr[c] + l;
+        for (IndexType k = csr.row_begin(r); k < csr.row_end(r); ++k) {
+          m_col_idx[pos] = csr.col_idx[k];
+          m_values[pos] = csr.values[k];
+          pos += C;
+        }
+      }
+    }
+  }
+
+  //! stored elements including padding, compare to the CSR nnz for overhead
+  IndexType storage_size() const { return static_cast<IndexType>(m_values.size()); }
+
+  view_type view()
+  {
+    return view_type{m_num_rows,
+                     m_num_cols,
+                     m_chunk_ptr.data(),
+                     m_row_perm.data(),
+                     m_col_idx.data(),
+                     m_values.data()};
+  }
+
+private:
+  IndexType m_num_rows;
+  IndexType m_num_cols;
+  std::vector<IndexType> m_chunk_ptr;
+  std::vector<IndexType> m_row_perm;
+  std::vector<IndexType> m_col_idx;
+  std::vector<value_type> m_values;
+};
+
+template <camp::idx_t ChunkSize, typename ValueType, typename IndexType>
+SellMatrix<ValueType, ChunkSize, IndexType> make_sell_matrix(
+    CSRView<ValueType, IndexType> const& csr,
+    typename CSRView<ValueType, IndexType>::index_type sigma)
+{
+  return SellMatrix<ValueType, ChunkSize, IndexType>(csr, sigma);
+}
+
+}  // namespace RAJA
+
+#endif
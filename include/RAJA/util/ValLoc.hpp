@@ -0,0 +1,106 @@
+/*!
+ ******************************************************************************
+ *
+ * \file
+ *
+ * \brief   Header file for the value and location pair used by the
+ *          atomicMinLoc and atomicMaxLoc operations.
+ *
+ ******************************************************************************
+ */
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-20, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/COPYRIGHT file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#ifndef RAJA_util_ValLoc_HPP
+#define RAJA_util_ValLoc_HPP
+
+#include <cstddef>
+
+#include "RAJA/config.hpp"
+
+#include "RAJA/util/macros.hpp"
+
+namespace RAJA
+{
+
+namespace detail
+{
+
+/*!
+ * Pairs that fit in 8 or 16 bytes are aligned to their packed size so the
+ * host atomics can swap them with a single 64-bit or 128-bit CAS.
+ */
+template <typename T, typename IndexType>
+struct valloc_alignment {
+  static constexpr size_t bytes = sizeof(T) + sizeof(IndexType);
+  static constexpr size_t packed = bytes <= 8 ? 8 : (bytes <= 16 ? 16 : 1);
+  static constexpr size_t natural =
+      alignof(T) > alignof(IndexType) ? alignof(T) : alignof(IndexType);
+  static constexpr size_t value = packed > natural ? packed : natural;
+};
+
+}  // namespace detail
+
+/*!
+ * @brief A value and its location, updated together by atomicMinLoc and
+ * atomicMaxLoc.
+ *
+ * When two pairs hold the same value the one with the smaller location
+ * wins, so the result of a min-loc or max-loc does not depend on the order
+ * of the updates. For example:
+ *
+ *     RAJA::ValLoc<double, int> dtmin(1.0e30, -1);
+ *
+ *     RAJA::forall<RAJA::omp_parallel_for_exec>(zones, [=](int z) {
+ *       RAJA::atomicMinLoc<RAJA::omp_atomic>(&dtmin, zone_dt(z), z);
+ *     });
+ */
+template <typename T, typename IndexType>
+struct alignas(detail::valloc_alignment<T, IndexType>::value) ValLoc {
+  using value_type = T;
+  using index_type = IndexType;
+
+  T val;
+  IndexType loc;
+
+  ValLoc() = default;
+
+  RAJA_HOST_DEVICE
+  constexpr ValLoc(T v, IndexType l) : val(v), loc(l) {}
+
+  RAJA_HOST_DEVICE
+  constexpr T getVal() const { return val; }
+
+  RAJA_HOST_DEVICE
+  constexpr IndexType getLoc() const { return loc; }
+};
+
+namespace detail
+{
+
+//! true if a should replace b in a min-loc, ties go to the smaller location
+template <typename T, typename IndexType>
+RAJA_HOST_DEVICE constexpr bool minloc_better(ValLoc<T, IndexType> const &a,
+                                              ValLoc<T, IndexType> const &b)
+{
+  return a.val < b.val || (a.val == b.val && a.loc < b.loc);
+}
+
+//! true if a should replace b in a max-loc, ties go to the smaller location
+template <typename T, typename IndexType>
+RAJA_HOST_DEVICE constexpr bool maxloc_better(ValLoc<T, IndexType> const &a,
+                                              ValLoc<T, IndexType> const &b)
+{
+  return a.val > b.val || (a.val == b.val && a.loc < b.loc);
+}
+
+}  // namespace detail
+
+}  // namespace RAJA
+
+#endif
@@ -0,0 +1,586 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-20, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/COPYRIGHT file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#include "RAJA/util/PerfCounterPlugin.hpp"
+
+#include "RAJA/config.hpp"
+#include "RAJA/util/macros.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <map>
+#include <mutex>
+#include <string>
+#include <vector>
+
+#if defined(__linux__)
+#include <cxxabi.h>
+#include <dlfcn.h>
+#include <linux/perf_event.h>
+#include <sys/ioctl.h>
+#include <sys/mman.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif
+
+#if defined(RAJA_ENABLE_OPENMP)
+#include <omp.h>
+#endif
+
+#if defined(__linux__)
+
+namespace {
+
+constexpr int num_counters = 4;
+
+enum : int { cycles, instructions, llc_misses, stalled_cycles };
+
+const uint64_t counter_configs[num_counters] = {
+    PERF_COUNT_HW_CPU_CYCLES,
+    PERF_COUNT_HW_INSTRUCTIONS,
+    PERF_COUNT_HW_CACHE_MISSES,
+    PERF_COUNT_HW_STALLED_CYCLES_BACKEND};
+
+struct KernelTotals {
+  uint64_t launches = 0;
+  uint64_t counts[num_counters] = {0, 0, 0, 0};
+};
+
+using TotalsMap = std::map<const void*, KernelTotals>;
+
+// bit c is set once any thread has opened counter c
+std::atomic<unsigned> available_mask{0u};
+
+// set if no counter could be opened
+std::atomic<bool> counters_failed{false};
+
+
+/*!
+ * Counters of one thread, opened by that thread as one perf_event group.
+ */
+class CounterGroup
+{
+public:
+  bool open()
+  {
+    for (int c = 0; c < num_counters; ++c) {
+      perf_event_attr attr;
+      std::memset(&attr, 0, sizeof(attr));
+      attr.size = sizeof(attr);
+      attr.type = PERF_TYPE_HARDWARE;
+      attr.config = counter_configs[c];
+      attr.disabled = (m_leader < 0) ? 1 : 0;
+      attr.exclude_kernel = 1;
+      attr.exclude_hv = 1;
+      attr.read_format = PERF_FORMAT_GROUP | PERF_FORMAT_TOTAL_TIME_ENABLED |
+                         PERF_FORMAT_TOTAL_TIME_RUNNING;
+
+      const int fd = static_cast<int>(
+          syscall(__NR_perf_event_open, &attr, 0, -1, m_leader, 0));
+      if (fd < 0) {
+        continue;
+      }
+      if (m_leader < 0) {
+        m_leader = fd;
+      }
+      m_fds[c] = fd;
+      m_slots[c] = m_num++;
+
+      void* page = mmap(nullptr,
+                        static_cast<size_t>(sysconf(_SC_PAGESIZE)),
+                        PROT_READ,
+                        MAP_SHARED,
+                        fd,
+                        0);
+      m_pages[c] = (page == MAP_FAILED)
+                       ? nullptr
+                       : static_cast<perf_event_mmap_page*>(page);
+
+      available_mask.fetch_or(1u << c);
+    }
+
+    if (m_leader < 0) {
+      return false;
+    }
+
+    ioctl(m_leader, PERF_EVENT_IOC_RESET, PERF_IOC_FLAG_GROUP);
+    ioctl(m_leader, PERF_EVENT_IOC_ENABLE, PERF_IOC_FLAG_GROUP);
+    return true;
+  }
+
+  void close()
+  {
+    for (int c = 0; c < num_counters; ++c) {
+      if (m_pages[c] != nullptr) {
+        munmap(m_pages[c], static_cast<size_t>(sysconf(_SC_PAGESIZE)));
+        m_pages[c] = nullptr;
+      }
+      if (m_fds[c] >= 0) {
+        ::close(m_fds[c]);
+        m_fds[c] = -1;
+      }
+      m_slots[c] = -1;
+    }
+    m_leader = -1;
+    m_num = 0;
+  }
+
+  // must be called by the thread that opened the counters, both ways of
+  // reading scale for multiplexing so reads taken either way can be mixed
+  void read(uint64_t (&values)[num_counters]) const
+  {
+    if (!readRdpmc(values)) {
+      readGroup(values);
+    }
+  }
+
+private:
+#if defined(__x86_64__)
+  static uint64_t rdpmc(uint32_t counter)
+  {
+    uint32_t lo, hi;
+    asm volatile("rdpmc" : "=a"(lo), "=d"(hi) : "c"(counter));
+    return (static_cast<uint64_t>(hi) << 32) | lo;
+  }
+
+  static uint64_t rdtsc()
+  {
+    uint32_t lo, hi;
+    asm volatile("rdtsc" : "=a"(lo), "=d"(hi));
+    return (static_cast<uint64_t>(hi) << 32) | lo;
+  }
+#endif
+
+  // estimate of the count had the counter run whenever it was enabled
+  static uint64_t scaled(uint64_t raw, uint64_t enabled, uint64_t running)
+  {
+    if (running == 0 || running >= enabled) {
+      return raw;
+    }
+    return static_cast<uint64_t>(static_cast<double>(raw) * enabled / running);
+  }
+
+  // read counters in user space, fails if any counter is not scheduled,
+  // the enabled and running times come from the mmap page advanced to now
+  // with the TSC as described in perf_event_open(2)
+  bool readRdpmc(uint64_t (&values)[num_counters]) const
+  {
+#if defined(__x86_64__)
+    for (int c = 0; c < num_counters; ++c) {
+      values[c] = 0;
+      if (m_fds[c] < 0) {
+        continue;
+      }
+      perf_event_mmap_page const volatile* pc = m_pages[c];
+      if (pc == nullptr) {
+        return false;
+      }
+      uint32_t seq;
+      uint64_t count, enabled, running;
+      uint64_t cyc, time_offset = 0;
+      uint32_t time_mult = 0;
+      uint16_t time_shift = 0;
+      do {
+        seq = pc->lock;
+        asm volatile("" ::: "memory");
+        enabled = pc->time_enabled;
+        running = pc->time_running;
+        cyc = 0;
+        if (pc->cap_user_time && enabled != running) {
+          cyc = rdtsc();
+          time_offset = pc->time_offset;
+          time_mult = pc->time_mult;
+          time_shift = pc->time_shift;
+        }
+        const uint32_t idx = pc->index;
+        if (!pc->cap_user_rdpmc || idx == 0) {
+          return false;
+        }
+        const int shift = 64 - pc->pmc_width;
+        int64_t pmc = static_cast<int64_t>(rdpmc(idx - 1));
+        pmc = static_cast<int64_t>(static_cast<uint64_t>(pmc) << shift) >>
+              shift;
+        count = static_cast<uint64_t>(pc->offset + pmc);
+        asm volatile("" ::: "memory");
+      } while (pc->lock != seq);
+      if (cyc != 0) {
+        const uint64_t quot = cyc >> time_shift;
+        const uint64_t rem = cyc & ((uint64_t(1) << time_shift) - 1);
+        const uint64_t delta =
+            time_offset + quot * time_mult + ((rem * time_mult) >> time_shift);
+        enabled += delta;
+        running += delta;
+      }
+      values[c] = scaled(count, enabled, running);
+    }
+    return true;
+#else
+    RAJA_UNUSED_ARG(values);
+    return false;
+#endif
+  }
+
+  // read counters with one system call, scaled if the group was multiplexed
+  void readGroup(uint64_t (&values)[num_counters]) const
+  {
+    uint64_t buf[3 + num_counters] = {0};
+    std::fill(values, values + num_counters, uint64_t(0));
+    if (m_leader < 0 || ::read(m_leader, buf, sizeof(buf)) <= 0) {
+      return;
+    }
+    const uint64_t enabled = buf[1];
+    const uint64_t running = buf[2];
+    for (int c = 0; c < num_counters; ++c) {
+      if (m_slots[c] < 0 || running == 0) {
+        continue;
+      }
+      values[c] = scaled(buf[3 + m_slots[c]], enabled, running);
+    }
+  }
+
+  int m_fds[num_counters] = {-1, -1, -1, -1};
+  int m_slots[num_counters] = {-1, -1, -1, -1};
+  perf_event_mmap_page* m_pages[num_counters] = {nullptr,
+                                                 nullptr,
+                                                 nullptr,
+                                                 nullptr};
+  int m_leader = -1;
+  int m_num = 0;
+};
+
+
+struct ThreadCounters;
+
+struct PerfState {
+  std::mutex mutex;
+  TotalsMap totals;
+  std::vector<ThreadCounters*> threads;
+};
+
+PerfState& perfState()
+{
+  static PerfState state;
+  return state;
+}
+
+void mergeTotals(TotalsMap& into, TotalsMap const& from)
+{
+  for (auto const& kernel : from) {
+    KernelTotals& t = into[kernel.first];
+    t.launches += kernel.second.launches;
+    for (int c = 0; c < num_counters; ++c) {
+      t.counts[c] += kernel.second.counts[c];
+    }
+  }
+}
+
+/*!
+ * Counters, open launches and totals of one thread.
+ */
+struct ThreadCounters {
+  struct Start {
+    const void* site;
+    uint64_t counts[num_counters];
+  };
+
+  CounterGroup group;
+  bool opened = false;
+  bool tried = false;
+  std::vector<Start> starts;
+  TotalsMap totals;
+
+  ThreadCounters()
+  {
+    PerfState& state = perfState();
+    std::lock_guard<std::mutex> lock(state.mutex);
+    state.threads.push_back(this);
+  }
+
+  ~ThreadCounters()
+  {
+    PerfState& state = perfState();
+    {
+      std::lock_guard<std::mutex> lock(state.mutex);
+      mergeTotals(state.totals, totals);
+      state.threads.erase(
+          std::remove(state.threads.begin(), state.threads.end(), this),
+          state.threads.end());
+    }
+    group.close();
+  }
+
+  void read(uint64_t (&values)[num_counters])
+  {
+    if (!tried) {
+      tried = true;
+      opened = group.open();
+      if (!opened && available_mask.load() == 0u &&
+          !counters_failed.exchange(true)) {
+        std::fprintf(stderr,
+                     "[PerfCounterPlugin]: perf_event_open failed, hardware "
+                     "counters are disabled\n");
+      }
+    }
+    if (opened) {
+      group.read(values);
+    } else {
+      std::fill(values, values + num_counters, uint64_t(0));
+    }
+  }
+};
+
+ThreadCounters& threadCounters()
+{
+  static thread_local ThreadCounters counters;
+  return counters;
+}
+
+// counters of the calling thread, and of its OpenMP team when it is not
+// already in a parallel region
+void readCounters(uint64_t (&values)[num_counters])
+{
+  if (counters_failed) {
+    std::fill(values, values + num_counters, uint64_t(0));
+    return;
+  }
+#if defined(RAJA_ENABLE_OPENMP)
+  if (!omp_in_parallel() && omp_get_max_threads() > 1) {
+    uint64_t team[num_counters] = {0, 0, 0, 0};
+#pragma omp parallel
+    {
+      uint64_t mine[num_counters];
+      threadCounters().read(mine);
+      for (int c = 0; c < num_counters; ++c) {
+#pragma omp atomic
+        team[c] += mine[c];
+      }
+    }
+    std::copy(team, team + num_counters, values);
+    return;
+  }
+#endif
+  threadCounters().read(values);
+}
+
+// call site as object file and offset, for addr2line, and enclosing symbol
+std::string kernelName(const void* site)
+{
+  Dl_info info;
+  if (dladdr(site, &info) == 0 || info.dli_fname == nullptr) {
+    char address[32];
+    std::snprintf(address, sizeof(address), "%p", site);
+    return address;
+  }
+
+  char offset[32];
+  std::snprintf(offset,
+                sizeof(offset),
+                "+0x%llx",
+                static_cast<unsigned long long>(
+                    static_cast<const char*>(site) -
+                    static_cast<const char*>(info.dli_fbase)));
+  std::string name = std::string(info.dli_fname) + offset;
+
+  if (info.dli_sname != nullptr) {
+    int status = 0;
+    char* demangled =
+        abi::__cxa_demangle(info.dli_sname, nullptr, nullptr, &status);
+    name += " ";
+    name += (status == 0 && demangled != nullptr) ? demangled : info.dli_sname;
+    std::free(demangled);
+  }
+  return name;
+}
+
+double ratio(uint64_t num, uint64_t den, double scale)
+{
+  return den ? scale * static_cast<double>(num) / static_cast<double>(den)
+             : 0.0;
+}
+
+void writeReport(std::FILE* out, TotalsMap const& totals)
+{
+  const unsigned mask = available_mask.load();
+  auto has = [&](int c) { return (mask & (1u << c)) != 0u; };
+
+  std::vector<std::pair<const void*, KernelTotals>> kernels(totals.begin(),
+                                                            totals.end());
+  std::sort(kernels.begin(),
+            kernels.end(),
+            [](std::pair<const void*, KernelTotals> const& a,
+               std::pair<const void*, KernelTotals> const& b) {
+              return a.second.counts[cycles] > b.second.counts[cycles];
+            });
+
+  std::fprintf(out, "[PerfCounterPlugin]: host kernels by launch site\n");
+  std::fprintf(out,
+               "%10s %16s %16s %6s %14s %8s %9s  %s\n",
+               "launches",
+               "cycles",
+               "instructions",
+               "IPC",
+               "LLC misses",
+               "LLC MPKI",
+               "stalled %",
+               "launch site");
+
+  auto count = [&](char (&str)[24], KernelTotals const& t, int c) {
+    if (has(c)) {
+      std::snprintf(str, sizeof(str), "%llu",
+                    static_cast<unsigned long long>(t.counts[c]));
+    }
+  };
+
+  for (auto const& kernel : kernels) {
+    KernelTotals const& t = kernel.second;
+    char cyc[24] = "n/a", ins[24] = "n/a", llc[24] = "n/a";
+    char ipc[24] = "n/a", mpki[24] = "n/a", stalled[24] = "n/a";
+    count(cyc, t, cycles);
+    count(ins, t, instructions);
+    count(llc, t, llc_misses);
+    if (has(cycles) && has(instructions)) {
+      std::snprintf(ipc, sizeof(ipc), "%.2f",
+                    ratio(t.counts[instructions], t.counts[cycles], 1.0));
+    }
+    if (has(llc_misses) && has(instructions)) {
+      std::snprintf(mpki, sizeof(mpki), "%.2f",
+                    ratio(t.counts[llc_misses], t.counts[instructions],
+                          1000.0));
+    }
+    if (has(stalled_cycles) && has(cycles)) {
+      std::snprintf(stalled, sizeof(stalled), "%.1f",
+                    ratio(t.counts[stalled_cycles], t.counts[cycles], 100.0));
+    }
+    std::fprintf(out,
+                 "%10llu %16s %16s %6s %14s %8s %9s  %s\n",
+                 static_cast<unsigned long long>(t.launches),
+                 cyc,
+                 ins,
+                 ipc,
+                 llc,
+                 mpki,
+                 stalled,
+                 kernelName(kernel.first).c_str());
+  }
+}
+
+}  // end anonymous namespace
+
+#endif  // __linux__
+
+
+namespace RAJA {
+namespace util {
+
+PerfCounterPlugin::PerfCounterPlugin() : enabled(false)
+{
+#if defined(__linux__)
+  char* env = getenv("RAJA_PERF_COUNTERS");
+  if (env == nullptr)
+  {
+    return;
+  }
+  enabled = true;
+  output = env;
+#endif
+}
+
+void PerfCounterPlugin::preLaunch(const RAJA::util::PluginContext& p)
+{
+#if defined(__linux__)
+  if (!enabled || p.platform != RAJA::Platform::host)
+  {
+    return;
+  }
+  ThreadCounters::Start start;
+  start.site = __builtin_return_address(0);
+  readCounters(start.counts);
+  threadCounters().starts.push_back(start);
+#else
+  RAJA_UNUSED_ARG(p);
+#endif
+}
+
+void PerfCounterPlugin::postLaunch(const RAJA::util::PluginContext& p)
+{
+#if defined(__linux__)
+  if (!enabled || p.platform != RAJA::Platform::host)
+  {
+    return;
+  }
+  ThreadCounters& thread = threadCounters();
+  if (thread.starts.empty())
+  {
+    return;
+  }
+  uint64_t counts[num_counters];
+  readCounters(counts);
+
+  ThreadCounters::Start const& start = thread.starts.back();
+  KernelTotals& totals = thread.totals[start.site];
+  totals.launches += 1;
+  for (int c = 0; c < num_counters; ++c)
+  {
+    // scaled estimates can step back when multiplexing changes the ratio
+    if (counts[c] > start.counts[c])
+    {
+      totals.counts[c] += counts[c] - start.counts[c];
+    }
+  }
+  thread.starts.pop_back();
+#else
+  RAJA_UNUSED_ARG(p);
+#endif
+}
+
+void PerfCounterPlugin::finalize()
+{
+#if defined(__linux__)
+  if (!enabled)
+  {
+    return;
+  }
+  enabled = false;
+
+  TotalsMap totals;
+  {
+    PerfState& state = perfState();
+    std::lock_guard<std::mutex> lock(state.mutex);
+    mergeTotals(totals, state.totals);
+    state.totals.clear();
+    for (ThreadCounters* thread : state.threads)
+    {
+      mergeTotals(totals, thread->totals);
+      thread->totals.clear();
+    }
+  }
+
+  const bool to_stdout = (output == "1" || output == "stdout");
+  std::FILE* out = to_stdout ? stdout : std::fopen(output.c_str(), "w");
+  if (out == nullptr)
+  {
+    perror("[PerfCounterPlugin]: Could not open report file");
+    return;
+  }
+  writeReport(out, totals);
+  if (!to_stdout)
+  {
+    std::fclose(out);
+  }
+#endif
+}
+
+void linkPerfCounterPlugin() {}
+
+} // end namespace util
+} // end namespace RAJA
+
+static RAJA::util::PluginRegistry::add<RAJA::util::PerfCounterPlugin> P("PerfCounterPlugin", "Reports hardware performance counters of host kernels.");
@@ -0,0 +1,199 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-20, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/COPYRIGHT file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+///
+/// Header file containing tests for batched small matrix operations
+///
+
+#ifndef __TEST_BATCHED_HPP__
+#define __TEST_BATCHED_HPP__
+
+#include <cmath>
+#include <random>
+#include <vector>
+
+//
+// Fill a batch of N x N matrices with values in [-1, 1]
+//
+template <camp::idx_t N>
+std::vector<double> makeBatchedMatrices(RAJA::Index_type batch,
+                                        unsigned seed)
+{
+  std::mt19937 gen(seed);
+  std::uniform_real_distribution<double> dist(-1.0, 1.0);
+
+  std::vector<double> data(batch * N * N);
+  for (auto& v : data) {
+    v = dist(gen);
+  }
+  return data;
+}
+
+template <typename EXEC_POLICY, camp::idx_t N>
+void BatchedGemmTestImpl(RAJA::Index_type batch)
+{
+  auto layout = RAJA::batched::make_layout<N, N>(batch);
+
+  std::vector<double> a = makeBatchedMatrices<N>(batch, 1);
+  std::vector<double> b = makeBatchedMatrices<N>(batch, 2);
+  std::vector<double> c = makeBatchedMatrices<N>(batch, 3);
+  std::vector<double> d(c);
+
+  RAJA::batched::MatrixView<double> A(a.data(), layout);
+  RAJA::batched::MatrixView<double> B(b.data(), layout);
+  RAJA::batched::MatrixView<double> C(c.data(), layout);
+  RAJA::batched::MatrixView<double> D(d.data(), layout);
+
+  // matrix entries of consecutive batch entries are adjacent
+  if (batch > 1) {
+    ASSERT_EQ(&A(1, 0, 0) - &A(0, 0, 0), 1);
+  }
+
+  RAJA::batched::gemm<EXEC_POLICY, N, N, N>(batch, A, B, C);
+  RAJA::batched::gemm<EXEC_POLICY, N, N, N>(batch, A, B, D, 2.0, 0.5);
+
+  for (RAJA::Index_type e = 0; e < batch; ++e) {
+    for (camp::idx_t i = 0; i < N; ++i) {
+      for (camp::idx_t j = 0; j < N; ++j) {
+        double sum = 0.0;
+        for (camp::idx_t k = 0; k < N; ++k) {
+          sum += A(e, i, k) * B(e, k, j);
+        }
+        ASSERT_NEAR(C(e, i, j), sum, 1.0e-12);
+      }
+    }
+  }
+
+  std::vector<double> c_orig = makeBatchedMatrices<N>(batch, 3);
+  RAJA::batched::MatrixView<double> C_orig(c_orig.data(), layout);
+  for (RAJA::Index_type e = 0; e < batch; ++e) {
+    for (camp::idx_t i = 0; i < N; ++i) {
+      for (camp::idx_t j = 0; j < N; ++j) {
+        ASSERT_NEAR(D(e, i, j), 2.0 * C(e, i, j) + 0.5 * C_orig(e, i, j),
+                    1.0e-12);
+      }
+    }
+  }
+}
+
+template <typename EXEC_POLICY, camp::idx_t N>
+void BatchedSolveTestImpl(RAJA::Index_type batch)
+{
+  constexpr camp::idx_t NRHS = 2;
+
+  auto layout = RAJA::batched::make_layout<N, N>(batch);
+  auto rhs_layout = RAJA::batched::make_layout<N, NRHS>(batch);
+
+  std::vector<double> a = makeBatchedMatrices<N>(batch, 4);
+  std::vector<double> lu(a);
+  std::vector<double> b(batch * N * NRHS);
+  std::vector<double> x(batch * N * NRHS);
+  std::vector<RAJA::Index_type> piv(batch * N);
+
+  std::mt19937 gen(5);
+  std::uniform_real_distribution<double> dist(-1.0, 1.0);
+  for (auto& v : b) {
+    v = dist(gen);
+  }
+  x = b;
+
+  RAJA::batched::MatrixView<double> A(a.data(), layout);
+  RAJA::batched::MatrixView<double> LU(lu.data(), layout);
+  RAJA::batched::MatrixView<double> B(b.data(), rhs_layout);
+  RAJA::batched::MatrixView<double> X(x.data(), rhs_layout);
+  RAJA::batched::PivotView P(piv.data(),
+                             RAJA::batched::make_pivot_layout<N>(batch));
+
+  RAJA::batched::lu_factor<EXEC_POLICY, N>(batch, LU, P);
+  RAJA::batched::lu_solve<EXEC_POLICY, N, NRHS>(batch, LU, P, X);
+
+  for (RAJA::Index_type e = 0; e < batch; ++e) {
+    for (camp::idx_t k = 0; k < N; ++k) {
+      ASSERT_GE(P(e, k), k);
+      ASSERT_LT(P(e, k), N);
+    }
+    for (camp::idx_t i = 0; i < N; ++i) {
+      for (camp::idx_t c = 0; c < NRHS; ++c) {
+        double sum = 0.0;
+        for (camp::idx_t k = 0; k < N; ++k) {
+          sum += A(e, i, k) * X(e, k, c);
+        }
+        ASSERT_NEAR(sum, B(e, i, c), 1.0e-8);
+      }
+    }
+  }
+}
+
+template <typename EXEC_POLICY, camp::idx_t N>
+void BatchedInverseTestImpl(RAJA::Index_type batch)
+{
+  auto layout = RAJA::batched::make_layout<N, N>(batch);
+
+  std::vector<double> a = makeBatchedMatrices<N>(batch, 6);
+  std::vector<double> lu(a);
+  std::vector<double> inv(batch * N * N);
+
+  RAJA::batched::MatrixView<double> A(a.data(), layout);
+  RAJA::batched::MatrixView<double> LU(lu.data(), layout);
+  RAJA::batched::MatrixView<double> Inv(inv.data(), layout);
+
+  RAJA::batched::inverse<EXEC_POLICY, N>(batch, LU, Inv);
+
+  for (RAJA::Index_type e = 0; e < batch; ++e) {
+    for (camp::idx_t i = 0; i < N; ++i) {
+      for (camp::idx_t j = 0; j < N; ++j) {
+        double sum = 0.0;
+        for (camp::idx_t k = 0; k < N; ++k) {
+          sum += A(e, i, k) * Inv(e, k, j);
+        }
+        ASSERT_NEAR(sum, (i == j) ? 1.0 : 0.0, 1.0e-8);
+      }
+    }
+  }
+}
+
+
+template <typename T>
+class BatchedTest : public ::testing::Test
+{
+};
+
+TYPED_TEST_SUITE_P(BatchedTest);
+
+TYPED_TEST_P(BatchedTest, Gemm)
+{
+  using EXEC_POLICY = typename camp::at<TypeParam, camp::num<0>>::type;
+
+  BatchedGemmTestImpl<EXEC_POLICY, 1>(5);
+  BatchedGemmTestImpl<EXEC_POLICY, 3>(1);
+  BatchedGemmTestImpl<EXEC_POLICY, 3>(1000);
+  BatchedGemmTestImpl<EXEC_POLICY, 8>(257);
+}
+
+TYPED_TEST_P(BatchedTest, LUSolve)
+{
+  using EXEC_POLICY = typename camp::at<TypeParam, camp::num<0>>::type;
+
+  BatchedSolveTestImpl<EXEC_POLICY, 1>(5);
+  BatchedSolveTestImpl<EXEC_POLICY, 3>(1000);
+  BatchedSolveTestImpl<EXEC_POLICY, 8>(257);
+}
+
+TYPED_TEST_P(BatchedTest, Inverse)
+{
+  using EXEC_POLICY = typename camp::at<TypeParam, camp::num<0>>::type;
+
+  BatchedInverseTestImpl<EXEC_POLICY, 3>(1000);
+  BatchedInverseTestImpl<EXEC_POLICY, 5>(130);
+}
+
+REGISTER_TYPED_TEST_SUITE_P(BatchedTest,
+                            Gemm,
+                            LUSolve,
+                            Inverse);
+
+#endif  // __TEST_BATCHED_HPP__
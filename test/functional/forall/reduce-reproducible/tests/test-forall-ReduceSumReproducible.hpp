@@ -0,0 +1,109 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-20, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/COPYRIGHT file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#ifndef __TEST_FORALL_REDUCESUMREPRODUCIBLE_HPP__
+#define __TEST_FORALL_REDUCESUMREPRODUCIBLE_HPP__
+
+#include <cmath>
+#include <cstdlib>
+#include <vector>
+
+template <typename DATA_TYPE, typename EXEC_POLICY, typename REDUCE_POLICY>
+void ForallReduceSumReproducibleTestImpl(RAJA::Index_type len)
+{
+  RAJA::TypedRangeSegment<RAJA::Index_type> r1(0, 3 * len);
+
+  //
+  // Large values that cancel in pairs, interleaved with small ones. The
+  // exact sum is the sum of the small values, which a plain floating point
+  // sum loses depending on the order of additions.
+  //
+  std::vector<DATA_TYPE> values(3 * len);
+  DATA_TYPE exact_sum = 0;
+  for (RAJA::Index_type i = 0; i < len; ++i) {
+    const DATA_TYPE big = static_cast<DATA_TYPE>(
+        std::ldexp(1.0 + rand() % 100, 20 + rand() % 40));
+    const DATA_TYPE small = static_cast<DATA_TYPE>(0.25 * (rand() % 4));
+    values[3 * i] = big;
+    values[3 * i + 1] = small;
+    values[(3 * i + 3 * (len / 2) + 2) % (3 * len)] = -big;
+    exact_sum += small;
+  }
+  DATA_TYPE* data = values.data();
+
+  RAJA::ReduceSum<REDUCE_POLICY, DATA_TYPE> sum(0);
+  RAJA::ReduceSum<REDUCE_POLICY, DATA_TYPE> sum2(2);
+
+  RAJA::forall<EXEC_POLICY>(r1, [=](RAJA::Index_type idx) {
+    sum += data[idx];
+    sum2 += data[idx];
+  });
+
+  ASSERT_EQ(static_cast<DATA_TYPE>(sum.get()), exact_sum);
+  ASSERT_EQ(static_cast<DATA_TYPE>(sum2.get()), exact_sum + 2);
+
+  //
+  // Values without an exactly representable sum must give the same bits
+  // as a sequential reproducible sum, in any order.
+  //
+  for (RAJA::Index_type i = 0; i < 3 * len; ++i) {
+    values[i] = static_cast<DATA_TYPE>(
+        std::ldexp(1.0 / (1 + rand() % 1000), rand() % 60 - 30));
+  }
+
+  RAJA::ReduceSum<RAJA::seq_reduce_reproducible, DATA_TYPE> seq_sum(0);
+  for (RAJA::Index_type i = 3 * len; i > 0; --i) {
+    seq_sum += values[i - 1];
+  }
+
+  sum.reset(0);
+
+  RAJA::forall<EXEC_POLICY>(r1, [=](RAJA::Index_type idx) {
+    sum += data[idx];
+  });
+
+  ASSERT_EQ(sum.get(), seq_sum.get());
+
+  sum.reset(0);
+  seq_sum.reset(0);
+
+  const int nloops = 2;
+
+  for (int j = 0; j < nloops; ++j) {
+    RAJA::forall<EXEC_POLICY>(r1, [=](RAJA::Index_type idx) {
+      sum += data[idx];
+    });
+    for (RAJA::Index_type i = 0; i < 3 * len; ++i) {
+      seq_sum += values[i];
+    }
+  }
+
+  ASSERT_EQ(sum.get(), seq_sum.get());
+}
+
+
+TYPED_TEST_SUITE_P(ForallReduceSumReproducibleTest);
+template <typename T>
+class ForallReduceSumReproducibleTest : public ::testing::Test
+{
+};
+
+TYPED_TEST_P(ForallReduceSumReproducibleTest, ReduceSumReproducibleForall)
+{
+  using DATA_TYPE     = typename camp::at<TypeParam, camp::num<0>>::type;
+  using EXEC_POLICY   = typename camp::at<TypeParam, camp::num<1>>::type;
+  using REDUCE_POLICY = typename camp::at<TypeParam, camp::num<2>>::type;
+
+  ForallReduceSumReproducibleTestImpl<DATA_TYPE, EXEC_POLICY, REDUCE_POLICY>(1);
+  ForallReduceSumReproducibleTestImpl<DATA_TYPE, EXEC_POLICY, REDUCE_POLICY>(214);
+  ForallReduceSumReproducibleTestImpl<DATA_TYPE, EXEC_POLICY, REDUCE_POLICY>(3571);
+}
+
+REGISTER_TYPED_TEST_SUITE_P(ForallReduceSumReproducibleTest,
+                            ReduceSumReproducibleForall);
+
+#endif  // __TEST_FORALL_REDUCESUMREPRODUCIBLE_HPP__
@@ -0,0 +1,118 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-20, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/COPYRIGHT file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+///
+/// Source file containing tests for the parallel color index set builder.
+///
+
+#include "RAJA_test-base.hpp"
+
+#include "RAJA/index/IndexSetBuilders.hpp"
+
+#include "camp/resource.hpp"
+
+#include <vector>
+
+//
+// Color the zones of an nx x ny quad mesh by the nodes they touch and
+// check every zone is in exactly one segment and no two zones of a
+// segment share a node.
+//
+template <typename EXEC_POLICY>
+void ColorIndexSetTestImpl(int nx, int ny, bool use_permutation)
+{
+  const int num_zones = nx * ny;
+  const int num_nodes = (nx + 1) * (ny + 1);
+
+  std::vector<RAJA::Index_type> zone_to_node(4 * num_zones);
+  for (int j = 0; j < ny; ++j) {
+    for (int i = 0; i < nx; ++i) {
+      const int z = j * nx + i;
+      const int n = j * (nx + 1) + i;
+      zone_to_node[4 * z] = n;
+      zone_to_node[4 * z + 1] = n + 1;
+      zone_to_node[4 * z + 2] = n + nx + 1;
+      zone_to_node[4 * z + 3] = n + nx + 2;
+    }
+  }
+
+  std::vector<RAJA::Index_type> perm(num_zones);
+  std::vector<RAJA::Index_type> iperm(num_zones);
+
+  camp::resources::Resource res{camp::resources::Host()};
+
+  RAJA::TypedIndexSet<RAJA::RangeSegment, RAJA::ListSegment> iset;
+
+  RAJA::buildParallelColorIndexset<EXEC_POLICY>(
+      iset,
+      res,
+      zone_to_node.data(),
+      num_zones,
+      4,
+      num_nodes,
+      use_permutation ? perm.data() : nullptr,
+      use_permutation ? iperm.data() : nullptr);
+
+  ASSERT_EQ(iset.getLength(), static_cast<size_t>(num_zones));
+
+  // a quad mesh needs at least 4 colors, greedy coloring at most 9
+  if (num_zones >= 4) {
+    ASSERT_GE(iset.getNumSegments(), 4u);
+  }
+  ASSERT_LE(iset.getNumSegments(), 9u);
+
+  std::vector<int> zone_count(num_zones, 0);
+  std::vector<int> node_segment(num_nodes, -1);
+
+  for (size_t s = 0; s < iset.getNumSegments(); ++s) {
+    std::vector<RAJA::Index_type> zones;
+    iset.segmentCall(s, [&](auto const& seg) {
+      for (auto z : seg) {
+        zones.push_back(use_permutation ? perm[z] : z);
+        if (use_permutation) {
+          ASSERT_EQ(iperm[perm[z]], z);
+        }
+      }
+    });
+
+    // zones of a segment are in increasing order
+    for (size_t k = 1; k < zones.size(); ++k) {
+      if (!use_permutation) {
+        ASSERT_LT(zones[k - 1], zones[k]);
+      }
+    }
+
+    for (auto z : zones) {
+      ++zone_count[z];
+      for (int k = 0; k < 4; ++k) {
+        const RAJA::Index_type n = zone_to_node[4 * z + k];
+        ASSERT_NE(node_segment[n], static_cast<int>(s));
+        node_segment[n] = static_cast<int>(s);
+      }
+    }
+  }
+
+  for (int z = 0; z < num_zones; ++z) {
+    ASSERT_EQ(zone_count[z], 1);
+  }
+}
+
+TEST(IndexSetBuild, ParallelColorSequential)
+{
+  ColorIndexSetTestImpl<RAJA::seq_exec>(1, 1, false);
+  ColorIndexSetTestImpl<RAJA::seq_exec>(7, 5, false);
+  ColorIndexSetTestImpl<RAJA::seq_exec>(40, 33, true);
+}
+
+#if defined(RAJA_ENABLE_OPENMP)
+TEST(IndexSetBuild, ParallelColorOpenMP)
+{
+  ColorIndexSetTestImpl<RAJA::omp_parallel_for_exec>(7, 5, false);
+  ColorIndexSetTestImpl<RAJA::omp_parallel_for_exec>(40, 33, true);
+  ColorIndexSetTestImpl<RAJA::omp_parallel_for_exec>(128, 97, false);
+}
+#endif
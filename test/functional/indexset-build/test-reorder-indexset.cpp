@@ -0,0 +1,210 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-20, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/COPYRIGHT file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+///
+/// Source file containing tests for the reordering index set builders.
+///
+
+#include "RAJA_test-base.hpp"
+
+#include "RAJA/index/IndexSetBuilders.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <cstdlib>
+#include <numeric>
+#include <random>
+#include <vector>
+
+//
+// Check iset holds numSegments range segments covering [0, num) in
+// order, and perm and iperm are inverse permutations.
+//
+void checkReorderIndexSet(RAJA::TypedIndexSet<RAJA::RangeSegment>& iset,
+                          std::vector<RAJA::Index_type> const& perm,
+                          std::vector<RAJA::Index_type> const& iperm,
+                          int num,
+                          int numSegments)
+{
+  ASSERT_EQ(iset.getLength(), static_cast<size_t>(num));
+  ASSERT_EQ(iset.getNumSegments(),
+            static_cast<size_t>(std::min(numSegments, num)));
+
+  RAJA::Index_type pos = 0;
+  for (size_t s = 0; s < iset.getNumSegments(); ++s) {
+    iset.segmentCall(s, [&](auto const& seg) {
+      for (auto i : seg) {
+        ASSERT_EQ(i, pos);
+        ++pos;
+      }
+    });
+  }
+
+  std::vector<int> count(num, 0);
+  for (int p = 0; p < num; ++p) {
+    ++count[perm[p]];
+    ASSERT_EQ(iperm[perm[p]], p);
+  }
+  for (int i = 0; i < num; ++i) {
+    ASSERT_EQ(count[i], 1);
+  }
+}
+
+//
+// Order the zones of an nx x ny quad mesh, numbered in random order, and
+// check zones sharing a node are close in the new order.
+//
+template <typename EXEC_POLICY>
+void RCMIndexSetTestImpl(int nx, int ny, int numSegments)
+{
+  const int num_zones = nx * ny;
+  const int num_nodes = (nx + 1) * (ny + 1);
+
+  std::vector<RAJA::Index_type> shuffle(num_zones);
+  std::iota(shuffle.begin(), shuffle.end(), 0);
+  std::shuffle(shuffle.begin(), shuffle.end(), std::mt19937(5));
+
+  std::vector<RAJA::Index_type> zone_to_node(4 * num_zones);
+  for (int j = 0; j < ny; ++j) {
+    for (int i = 0; i < nx; ++i) {
+      const RAJA::Index_type z = shuffle[j * nx + i];
+      const int n = j * (nx + 1) + i;
+      zone_to_node[4 * z] = n;
+      zone_to_node[4 * z + 1] = n + 1;
+      zone_to_node[4 * z + 2] = n + nx + 1;
+      zone_to_node[4 * z + 3] = n + nx + 2;
+    }
+  }
+
+  std::vector<RAJA::Index_type> perm(num_zones);
+  std::vector<RAJA::Index_type> iperm(num_zones);
+
+  RAJA::TypedIndexSet<RAJA::RangeSegment> iset;
+
+  RAJA::buildReverseCuthillMcKeeIndexset<EXEC_POLICY>(iset,
+                                                      zone_to_node.data(),
+                                                      num_zones,
+                                                      4,
+                                                      num_nodes,
+                                                      numSegments,
+                                                      perm.data(),
+                                                      iperm.data());
+
+  checkReorderIndexSet(iset, perm, iperm, num_zones, numSegments);
+
+  // zones sharing a node are at most about two mesh rows apart
+  const RAJA::Index_type max_band = 2 * std::min(nx, ny) + 2;
+  for (int z = 0; z < num_zones; ++z) {
+    for (int y = 0; y < num_zones; ++y) {
+      bool share = false;
+      for (int k = 0; k < 4 && !share; ++k) {
+        for (int l = 0; l < 4; ++l) {
+          share = share || zone_to_node[4 * z + k] == zone_to_node[4 * y + l];
+        }
+      }
+      if (share) {
+        ASSERT_LE(std::labs(iperm[z] - iperm[y]), max_band);
+      }
+    }
+  }
+}
+
+//
+// Order the cells of an nx x ny x nz grid, numbered in random order, by
+// their centers and check consecutive cells are close.
+//
+template <typename EXEC_POLICY>
+void SpaceFillingCurveIndexSetTestImpl(RAJA::SpaceFillingCurve curve,
+                                       int nx,
+                                       int ny,
+                                       int nz,
+                                       int numSegments)
+{
+  const int num_cells = nx * ny * nz;
+
+  std::vector<RAJA::Index_type> shuffle(num_cells);
+  std::iota(shuffle.begin(), shuffle.end(), 0);
+  std::shuffle(shuffle.begin(), shuffle.end(), std::mt19937(7));
+
+  std::vector<double> x(num_cells);
+  std::vector<double> y(num_cells);
+  std::vector<double> z(num_cells);
+  for (int k = 0; k < nz; ++k) {
+    for (int j = 0; j < ny; ++j) {
+      for (int i = 0; i < nx; ++i) {
+        const RAJA::Index_type c = shuffle[(k * ny + j) * nx + i];
+        x[c] = i + 0.5;
+        y[c] = j + 0.5;
+        z[c] = k + 0.5;
+      }
+    }
+  }
+
+  std::vector<RAJA::Index_type> perm(num_cells);
+  std::vector<RAJA::Index_type> iperm(num_cells);
+
+  RAJA::TypedIndexSet<RAJA::RangeSegment> iset;
+
+  RAJA::buildSpaceFillingCurveIndexset<EXEC_POLICY>(
+      iset,
+      curve,
+      x.data(),
+      y.data(),
+      (nz > 1) ? z.data() : nullptr,
+      num_cells,
+      numSegments,
+      perm.data(),
+      iperm.data());
+
+  checkReorderIndexSet(iset, perm, iperm, num_cells, numSegments);
+
+  // mean distance between consecutive cells
+  double dist = 0.0;
+  for (int p = 1; p < num_cells; ++p) {
+    dist += std::fabs(x[perm[p]] - x[perm[p - 1]]) +
+            std::fabs(y[perm[p]] - y[perm[p - 1]]) +
+            std::fabs(z[perm[p]] - z[perm[p - 1]]);
+  }
+  if (num_cells > 1) {
+    dist /= num_cells - 1;
+    if (curve == RAJA::SpaceFillingCurve::hilbert) {
+      ASSERT_LT(dist, 1.5);
+    } else {
+      ASSERT_LT(dist, 2.5);
+    }
+  }
+}
+
+TEST(IndexSetBuild, ReorderSequential)
+{
+  RCMIndexSetTestImpl<RAJA::seq_exec>(1, 1, 4);
+  RCMIndexSetTestImpl<RAJA::seq_exec>(7, 5, 3);
+  RCMIndexSetTestImpl<RAJA::seq_exec>(40, 33, 8);
+
+  for (auto curve : {RAJA::SpaceFillingCurve::morton,
+                     RAJA::SpaceFillingCurve::hilbert}) {
+    SpaceFillingCurveIndexSetTestImpl<RAJA::seq_exec>(curve, 1, 1, 1, 2);
+    SpaceFillingCurveIndexSetTestImpl<RAJA::seq_exec>(curve, 37, 23, 1, 4);
+    SpaceFillingCurveIndexSetTestImpl<RAJA::seq_exec>(curve, 16, 16, 16, 8);
+  }
+}
+
+#if defined(RAJA_ENABLE_OPENMP)
+TEST(IndexSetBuild, ReorderOpenMP)
+{
+  RCMIndexSetTestImpl<RAJA::omp_parallel_for_exec>(7, 5, 3);
+  RCMIndexSetTestImpl<RAJA::omp_parallel_for_exec>(40, 33, 8);
+
+  for (auto curve : {RAJA::SpaceFillingCurve::morton,
+                     RAJA::SpaceFillingCurve::hilbert}) {
+    SpaceFillingCurveIndexSetTestImpl<RAJA::omp_parallel_for_exec>(
+        curve, 37, 23, 1, 4);
+    SpaceFillingCurveIndexSetTestImpl<RAJA::omp_parallel_for_exec>(
+        curve, 16, 16, 16, 8);
+  }
+}
+#endif
@@ -0,0 +1,102 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-20, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/COPYRIGHT file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#ifndef __TEST_KERNEL_FUSE_HPP__
+#define __TEST_KERNEL_FUSE_HPP__
+
+//
+// For each of NM rows, a producer loop of length NI writes a row of a and
+// a fused consumer loop of length NJ reads it at the same iterate. Check
+// the results and that each iterate of each loop ran exactly once.
+//
+template <typename INDEX_TYPE, typename WORKING_RES, typename EXEC_POLICY>
+void KernelFuseTestImpl(INDEX_TYPE NM, INDEX_TYPE NI, INDEX_TYPE NJ)
+{
+  camp::resources::Resource host_res{camp::resources::Host()};
+  camp::resources::Resource work_res{WORKING_RES::get_default()};
+
+  INDEX_TYPE* a_array = work_res.allocate<INDEX_TYPE>(NM * NI);
+  INDEX_TYPE* b_array = work_res.allocate<INDEX_TYPE>(NM * NJ);
+  INDEX_TYPE* count_array = work_res.allocate<INDEX_TYPE>(NM * (NI + NJ));
+
+  INDEX_TYPE* check_a = host_res.allocate<INDEX_TYPE>(NM * NI);
+  INDEX_TYPE* check_b = host_res.allocate<INDEX_TYPE>(NM * NJ);
+  INDEX_TYPE* check_count = host_res.allocate<INDEX_TYPE>(NM * (NI + NJ));
+
+  work_res.memset(count_array, 0, sizeof(INDEX_TYPE) * NM * (NI + NJ));
+
+  RAJA::TypedRangeSegment<INDEX_TYPE> mseg(0, NM);
+  RAJA::TypedRangeSegment<INDEX_TYPE> iseg(0, NI);
+  RAJA::TypedRangeSegment<INDEX_TYPE> jseg(0, NJ);
+
+  RAJA::kernel<EXEC_POLICY>(
+
+    RAJA::make_tuple(mseg, iseg, jseg),
+
+    [=] (INDEX_TYPE m, INDEX_TYPE i) {
+      a_array[m * NI + i] = m + i;
+      count_array[m * (NI + NJ) + i] += 1;
+    },
+
+    [=] (INDEX_TYPE m, INDEX_TYPE j) {
+      b_array[m * NJ + j] = (j < NI) ? 2 * a_array[m * NI + j] : 1;
+      count_array[m * (NI + NJ) + NI + j] += 1;
+    }
+
+  );
+
+  work_res.memcpy(check_a, a_array, sizeof(INDEX_TYPE) * NM * NI);
+  work_res.memcpy(check_b, b_array, sizeof(INDEX_TYPE) * NM * NJ);
+  work_res.memcpy(check_count,
+                  count_array,
+                  sizeof(INDEX_TYPE) * NM * (NI + NJ));
+
+  for (INDEX_TYPE m = 0; m < NM; ++m) {
+    for (INDEX_TYPE i = 0; i < NI; ++i) {
+      ASSERT_EQ(check_a[m * NI + i], static_cast<INDEX_TYPE>(m + i));
+      ASSERT_EQ(check_count[m * (NI + NJ) + i], 1);
+    }
+    for (INDEX_TYPE j = 0; j < NJ; ++j) {
+      ASSERT_EQ(check_b[m * NJ + j],
+                static_cast<INDEX_TYPE>((j < NI) ? 2 * (m + j) : 1));
+      ASSERT_EQ(check_count[m * (NI + NJ) + NI + j], 1);
+    }
+  }
+
+  work_res.deallocate(a_array);
+  work_res.deallocate(b_array);
+  work_res.deallocate(count_array);
+
+  host_res.deallocate(check_a);
+  host_res.deallocate(check_b);
+  host_res.deallocate(check_count);
+}
+
+
+TYPED_TEST_SUITE_P(KernelFuseTest);
+template <typename T>
+class KernelFuseTest : public ::testing::Test
+{
+};
+
+TYPED_TEST_P(KernelFuseTest, FuseKernel)
+{
+  using INDEX_TYPE  = typename camp::at<TypeParam, camp::num<0>>::type;
+  using WORKING_RES = typename camp::at<TypeParam, camp::num<1>>::type;
+  using EXEC_POLICY = typename camp::at<TypeParam, camp::num<2>>::type;
+
+  // matching, shorter consumer, longer consumer and empty producer
+  KernelFuseTestImpl<INDEX_TYPE, WORKING_RES, EXEC_POLICY>(3, 50, 50);
+  KernelFuseTestImpl<INDEX_TYPE, WORKING_RES, EXEC_POLICY>(4, 37, 20);
+  KernelFuseTestImpl<INDEX_TYPE, WORKING_RES, EXEC_POLICY>(5, 20, 37);
+  KernelFuseTestImpl<INDEX_TYPE, WORKING_RES, EXEC_POLICY>(2, 0, 9);
+}
+
+REGISTER_TYPED_TEST_SUITE_P(KernelFuseTest,
+                            FuseKernel);
+
+#endif  // __TEST_KERNEL_FUSE_HPP__
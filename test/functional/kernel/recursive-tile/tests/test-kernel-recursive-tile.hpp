@@ -0,0 +1,95 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-20, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/COPYRIGHT file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#ifndef __TEST_KERNEL_RECURSIVE_TILE_HPP__
+#define __TEST_KERNEL_RECURSIVE_TILE_HPP__
+
+//
+// Transpose an (last0-first0) x (last1-first1) matrix with a recursively
+// tiled kernel and check that every entry was written exactly once.
+//
+template <typename INDEX_TYPE, typename WORKING_RES, typename EXEC_POLICY>
+void KernelRecursiveTileTestImpl(INDEX_TYPE first0, INDEX_TYPE last0,
+                                 INDEX_TYPE first1, INDEX_TYPE last1)
+{
+  camp::resources::Resource host_res{camp::resources::Host()};
+  camp::resources::Resource work_res{WORKING_RES::get_default()};
+
+  const INDEX_TYPE N0 = last0 - first0;
+  const INDEX_TYPE N1 = last1 - first1;
+  const INDEX_TYPE N = N0 * N1;
+
+  INDEX_TYPE* in_array = work_res.allocate<INDEX_TYPE>(N);
+  INDEX_TYPE* out_array = work_res.allocate<INDEX_TYPE>(N);
+  INDEX_TYPE* count_array = work_res.allocate<INDEX_TYPE>(N);
+
+  INDEX_TYPE* check_out = host_res.allocate<INDEX_TYPE>(N);
+  INDEX_TYPE* check_count = host_res.allocate<INDEX_TYPE>(N);
+
+  for (INDEX_TYPE i = 0; i < N; ++i) {
+    check_out[i] = i;
+  }
+  work_res.memcpy(in_array, check_out, sizeof(INDEX_TYPE) * N);
+  work_res.memset(out_array, 0, sizeof(INDEX_TYPE) * N);
+  work_res.memset(count_array, 0, sizeof(INDEX_TYPE) * N);
+
+  RAJA::TypedRangeSegment<INDEX_TYPE> rseg0(first0, last0);
+  RAJA::TypedRangeSegment<INDEX_TYPE> rseg1(first1, last1);
+
+  RAJA::kernel<EXEC_POLICY>(
+
+    RAJA::make_tuple(rseg0, rseg1),
+
+    [=] (INDEX_TYPE i, INDEX_TYPE j) {
+      const INDEX_TYPE r = i - first0;
+      const INDEX_TYPE c = j - first1;
+      out_array[c * N0 + r] = in_array[r * N1 + c];
+      count_array[r * N1 + c] += 1;
+    }
+
+  );
+
+  work_res.memcpy(check_out, out_array, sizeof(INDEX_TYPE) * N);
+  work_res.memcpy(check_count, count_array, sizeof(INDEX_TYPE) * N);
+
+  for (INDEX_TYPE r = 0; r < N0; ++r) {
+    for (INDEX_TYPE c = 0; c < N1; ++c) {
+      ASSERT_EQ(check_out[c * N0 + r], r * N1 + c);
+      ASSERT_EQ(check_count[r * N1 + c], 1);
+    }
+  }
+
+  work_res.deallocate(in_array);
+  work_res.deallocate(out_array);
+  work_res.deallocate(count_array);
+
+  host_res.deallocate(check_out);
+  host_res.deallocate(check_count);
+}
+
+
+TYPED_TEST_SUITE_P(KernelRecursiveTileTest);
+template <typename T>
+class KernelRecursiveTileTest : public ::testing::Test
+{
+};
+
+TYPED_TEST_P(KernelRecursiveTileTest, RecursiveTileKernel)
+{
+  using INDEX_TYPE  = typename camp::at<TypeParam, camp::num<0>>::type;
+  using WORKING_RES = typename camp::at<TypeParam, camp::num<1>>::type;
+  using EXEC_POLICY = typename camp::at<TypeParam, camp::num<2>>::type;
+
+  KernelRecursiveTileTestImpl<INDEX_TYPE, WORKING_RES, EXEC_POLICY>(0, 5, 0, 3);
+  KernelRecursiveTileTestImpl<INDEX_TYPE, WORKING_RES, EXEC_POLICY>(0, 64, 0, 64);
+  KernelRecursiveTileTestImpl<INDEX_TYPE, WORKING_RES, EXEC_POLICY>(3, 40, 1, 118);
+}
+
+REGISTER_TYPED_TEST_SUITE_P(KernelRecursiveTileTest,
+                            RecursiveTileKernel);
+
+#endif  // __TEST_KERNEL_RECURSIVE_TILE_HPP__
@@ -0,0 +1,214 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-20, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/COPYRIGHT file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#ifndef __TEST_KERNEL_REDUCE_STATEMENT_HPP__
+#define __TEST_KERNEL_REDUCE_STATEMENT_HPP__
+
+//
+// Compute the dot product of each row of an N0 x N1 matrix with a vector,
+// reducing each row with statement::Reduce.
+//
+template <typename INDEX_TYPE, typename WORKING_RES, typename EXEC_POLICY>
+void KernelReduceStatementTestImpl(INDEX_TYPE N0, INDEX_TYPE N1)
+{
+  camp::resources::Resource host_res{camp::resources::Host()};
+  camp::resources::Resource work_res{WORKING_RES::get_default()};
+
+  const INDEX_TYPE N = N0 * N1;
+
+  long* mat = work_res.allocate<long>(N);
+  long* vec = work_res.allocate<long>(N1);
+  long* dot = work_res.allocate<long>(N0);
+
+  long* check_mat = host_res.allocate<long>(N);
+  long* check_vec = host_res.allocate<long>(N1);
+  long* check_dot = host_res.allocate<long>(N0);
+
+  for (INDEX_TYPE i = 0; i < N0; ++i) {
+    for (INDEX_TYPE j = 0; j < N1; ++j) {
+      check_mat[i * N1 + j] = (i + j) % 7 - 3;
+    }
+  }
+  for (INDEX_TYPE j = 0; j < N1; ++j) {
+    check_vec[j] = j % 5 + 1;
+  }
+  work_res.memcpy(mat, check_mat, sizeof(long) * N);
+  work_res.memcpy(vec, check_vec, sizeof(long) * N1);
+  work_res.memset(dot, 0, sizeof(long) * N0);
+
+  RAJA::TypedRangeSegment<INDEX_TYPE> rseg0(0, N0);
+  RAJA::TypedRangeSegment<INDEX_TYPE> rseg1(0, N1);
+
+  RAJA::kernel_param<EXEC_POLICY>(
+
+    RAJA::make_tuple(rseg0, rseg1),
+
+    RAJA::make_tuple(static_cast<long>(0)),
+
+    [=] (INDEX_TYPE i, INDEX_TYPE j, long& value) {
+      value += mat[i * N1 + j] * vec[j];
+    },
+
+    [=] (INDEX_TYPE i, long& value) {
+      dot[i] = value;
+    },
+
+    [=] (long& value) {
+      value = 0;
+    }
+
+  );
+
+  work_res.memcpy(check_dot, dot, sizeof(long) * N0);
+
+  for (INDEX_TYPE i = 0; i < N0; ++i) {
+    long expected = 0;
+    for (INDEX_TYPE j = 0; j < N1; ++j) {
+      expected += check_mat[i * N1 + j] * check_vec[j];
+    }
+    ASSERT_EQ(check_dot[i], expected);
+  }
+
+  work_res.deallocate(mat);
+  work_res.deallocate(vec);
+  work_res.deallocate(dot);
+
+  host_res.deallocate(check_mat);
+  host_res.deallocate(check_vec);
+  host_res.deallocate(check_dot);
+}
+
+
+template <typename T>
+class KernelReduceStatementTest : public ::testing::Test
+{
+};
+TYPED_TEST_SUITE_P(KernelReduceStatementTest);
+
+TYPED_TEST_P(KernelReduceStatementTest, ReduceStatementKernel)
+{
+  using INDEX_TYPE  = typename camp::at<TypeParam, camp::num<0>>::type;
+  using WORKING_RES = typename camp::at<TypeParam, camp::num<1>>::type;
+  using EXEC_POLICY = typename camp::at<TypeParam, camp::num<2>>::type;
+
+  KernelReduceStatementTestImpl<INDEX_TYPE, WORKING_RES, EXEC_POLICY>(1, 1);
+  KernelReduceStatementTestImpl<INDEX_TYPE, WORKING_RES, EXEC_POLICY>(7, 1000);
+  KernelReduceStatementTestImpl<INDEX_TYPE, WORKING_RES, EXEC_POLICY>(64, 3001);
+}
+
+REGISTER_TYPED_TEST_SUITE_P(KernelReduceStatementTest,
+                            ReduceStatementKernel);
+
+
+//
+// Compute the sum of an N0 x N1 matrix, starting from a non-zero value, in
+// an outer statement::Reduce and the maximum of each row in an inner one,
+// so the inner Reduce runs on the loop data of the outer Reduce.
+//
+template <typename INDEX_TYPE, typename WORKING_RES, typename EXEC_POLICY>
+void KernelNestedReduceStatementTestImpl(INDEX_TYPE N0, INDEX_TYPE N1)
+{
+  camp::resources::Resource host_res{camp::resources::Host()};
+  camp::resources::Resource work_res{WORKING_RES::get_default()};
+
+  const INDEX_TYPE N = N0 * N1;
+  const long init_sum = 1000;
+
+  long* mat = work_res.allocate<long>(N);
+  long* row_max = work_res.allocate<long>(N0);
+  long* sum = work_res.allocate<long>(1);
+
+  long* check_mat = host_res.allocate<long>(N);
+  long* check_row_max = host_res.allocate<long>(N0);
+  long* check_sum = host_res.allocate<long>(1);
+
+  for (INDEX_TYPE i = 0; i < N0; ++i) {
+    for (INDEX_TYPE j = 0; j < N1; ++j) {
+      check_mat[i * N1 + j] = (i * 31 + j * 17) % 101 - 50;
+    }
+  }
+  work_res.memcpy(mat, check_mat, sizeof(long) * N);
+  work_res.memset(row_max, 0, sizeof(long) * N0);
+  work_res.memset(sum, 0, sizeof(long));
+
+  RAJA::TypedRangeSegment<INDEX_TYPE> rseg0(0, N0);
+  RAJA::TypedRangeSegment<INDEX_TYPE> rseg1(0, N1);
+
+  RAJA::kernel_param<EXEC_POLICY>(
+
+    RAJA::make_tuple(rseg0, rseg1),
+
+    RAJA::make_tuple(init_sum, static_cast<long>(0)),
+
+    [=] (INDEX_TYPE i, INDEX_TYPE j, long& total, long& max_value) {
+      const long value = mat[i * N1 + j];
+      total += value;
+      max_value = value > max_value ? value : max_value;
+    },
+
+    [=] (INDEX_TYPE i, long& total, long& max_value) {
+      row_max[i] = max_value;
+      total += 1;
+    },
+
+    [=] (long& max_value) {
+      max_value = RAJA::operators::maximum<long>::identity();
+    },
+
+    [=] (long& total) {
+      sum[0] = total;
+    }
+
+  );
+
+  work_res.memcpy(check_row_max, row_max, sizeof(long) * N0);
+  work_res.memcpy(check_sum, sum, sizeof(long));
+
+  long expected_sum = init_sum;
+  for (INDEX_TYPE i = 0; i < N0; ++i) {
+    long expected_max = check_mat[i * N1];
+    for (INDEX_TYPE j = 0; j < N1; ++j) {
+      const long value = check_mat[i * N1 + j];
+      expected_sum += value;
+      expected_max = value > expected_max ? value : expected_max;
+    }
+    expected_sum += 1;
+    ASSERT_EQ(check_row_max[i], expected_max);
+  }
+  ASSERT_EQ(check_sum[0], expected_sum);
+
+  work_res.deallocate(mat);
+  work_res.deallocate(row_max);
+  work_res.deallocate(sum);
+
+  host_res.deallocate(check_mat);
+  host_res.deallocate(check_row_max);
+  host_res.deallocate(check_sum);
+}
+
+
+template <typename T>
+class KernelNestedReduceStatementTest : public ::testing::Test
+{
+};
+TYPED_TEST_SUITE_P(KernelNestedReduceStatementTest);
+
+TYPED_TEST_P(KernelNestedReduceStatementTest, NestedReduceStatementKernel)
+{
+  using INDEX_TYPE  = typename camp::at<TypeParam, camp::num<0>>::type;
+  using WORKING_RES = typename camp::at<TypeParam, camp::num<1>>::type;
+  using EXEC_POLICY = typename camp::at<TypeParam, camp::num<2>>::type;
+
+  KernelNestedReduceStatementTestImpl<INDEX_TYPE, WORKING_RES, EXEC_POLICY>(1, 1);
+  KernelNestedReduceStatementTestImpl<INDEX_TYPE, WORKING_RES, EXEC_POLICY>(7, 1000);
+  KernelNestedReduceStatementTestImpl<INDEX_TYPE, WORKING_RES, EXEC_POLICY>(64, 3001);
+}
+
+REGISTER_TYPED_TEST_SUITE_P(KernelNestedReduceStatementTest,
+                            NestedReduceStatementKernel);
+
+#endif  // __TEST_KERNEL_REDUCE_STATEMENT_HPP__
@@ -0,0 +1,158 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-20, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/COPYRIGHT file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+///
+/// Header file containing tests for RAJA stream_forall over file readers
+///
+
+#ifndef __TEST_STREAM_FORALL_HPP__
+#define __TEST_STREAM_FORALL_HPP__
+
+#include <cstdint>
+#include <cstdio>
+#include <string>
+#include <vector>
+
+#include <unistd.h>
+
+//
+// Temporary file holding a 64 bit header followed by len doubles, where
+// value i is (i % 97) * 0.5. Removed when destroyed.
+//
+class StreamTestFile
+{
+public:
+  explicit StreamTestFile(RAJA::Index_type len)
+  {
+    char name[] = "/tmp/raja-stream-XXXXXX";
+    const int fd = ::mkstemp(name);
+    ::close(fd);
+    path = name;
+
+    std::vector<double> values(len);
+    for (RAJA::Index_type i = 0; i < len; ++i) {
+      values[i] = (i % 97) * 0.5;
+    }
+
+    const std::int64_t header = len;
+    std::FILE* f = std::fopen(path.c_str(), "wb");
+    std::fwrite(&header, sizeof(header), 1, f);
+    std::fwrite(values.data(), sizeof(double), values.size(), f);
+    std::fclose(f);
+  }
+
+  ~StreamTestFile() { std::remove(path.c_str()); }
+
+  std::string path;
+};
+
+template <typename EXEC_POLICY, typename REDUCE_POLICY, typename READER>
+void StreamForallTestImpl(READER const& reader,
+                          RAJA::Index_type len,
+                          RAJA::Index_type chunk_length)
+{
+  double ref_sum = 0.0;
+  for (RAJA::Index_type i = 0; i < len; ++i) {
+    ref_sum += (i % 97) * 0.5;
+  }
+
+  RAJA::ReduceSum<REDUCE_POLICY, double> sum(0.0);
+  RAJA::ReduceSum<REDUCE_POLICY, RAJA::Index_type> wrong(0);
+  RAJA::ReduceMax<REDUCE_POLICY, RAJA::Index_type> last(-1);
+
+  RAJA::stream_forall<EXEC_POLICY>(reader,
+                                   chunk_length,
+                                   [=](RAJA::Index_type i, double v) {
+    sum += v;
+    if (v != (i % 97) * 0.5) {
+      wrong += 1;
+    }
+    last.max(i);
+  });
+
+  ASSERT_EQ(sum.get(), ref_sum);
+  ASSERT_EQ(wrong.get(), 0);
+  ASSERT_EQ(last.get(), len - 1);
+
+  // chunks cover the array in order
+  RAJA::Index_type next = 0;
+  RAJA::stream_chunks(reader,
+                      chunk_length,
+                      [&](RAJA::Index_type begin,
+                          double const* data,
+                          RAJA::Index_type n) {
+    ASSERT_EQ(begin, next);
+    ASSERT_GT(n, 0);
+    ASSERT_LE(n, chunk_length);
+    ASSERT_EQ(data[0], (begin % 97) * 0.5);
+    ASSERT_EQ(data[n - 1], ((begin + n - 1) % 97) * 0.5);
+    next += n;
+  });
+  ASSERT_EQ(next, len);
+}
+
+template <typename EXEC_POLICY, typename REDUCE_POLICY>
+void StreamForallFileTestImpl(RAJA::Index_type len)
+{
+  StreamTestFile file(len);
+  const RAJA::Index_type offset = sizeof(std::int64_t);
+
+  RAJA::PreadFileReader<double> pread_reader(file.path, offset);
+  RAJA::MappedFileReader<double> mapped_reader(file.path, offset);
+
+  ASSERT_EQ(pread_reader.size(), len);
+  ASSERT_EQ(mapped_reader.size(), len);
+
+  for (RAJA::Index_type chunk_length : {1, 7, 1000, 4096}) {
+    StreamForallTestImpl<EXEC_POLICY, REDUCE_POLICY>(pread_reader,
+                                                     len,
+                                                     chunk_length);
+    StreamForallTestImpl<EXEC_POLICY, REDUCE_POLICY>(mapped_reader,
+                                                     len,
+                                                     chunk_length);
+  }
+}
+
+
+template <typename T>
+class StreamForallTest : public ::testing::Test
+{
+};
+
+TYPED_TEST_SUITE_P(StreamForallTest);
+
+TYPED_TEST_P(StreamForallTest, StreamForallFile)
+{
+  using EXEC_POLICY = typename camp::at<TypeParam, camp::num<0>>::type;
+  using REDUCE_POLICY = typename camp::at<TypeParam, camp::num<1>>::type;
+
+  StreamForallFileTestImpl<EXEC_POLICY, REDUCE_POLICY>(1);
+  StreamForallFileTestImpl<EXEC_POLICY, REDUCE_POLICY>(1000);
+  StreamForallFileTestImpl<EXEC_POLICY, REDUCE_POLICY>(100003);
+}
+
+TYPED_TEST_P(StreamForallTest, StreamForallEmpty)
+{
+  using EXEC_POLICY = typename camp::at<TypeParam, camp::num<0>>::type;
+
+  StreamTestFile file(0);
+  RAJA::PreadFileReader<double> reader(file.path, sizeof(std::int64_t));
+
+  ASSERT_EQ(reader.size(), 0);
+
+  bool called = false;
+  RAJA::stream_forall<EXEC_POLICY>(reader, 16, [&](RAJA::Index_type, double) {
+    called = true;
+  });
+  ASSERT_FALSE(called);
+}
+
+REGISTER_TYPED_TEST_SUITE_P(StreamForallTest,
+                            StreamForallFile,
+                            StreamForallEmpty);
+
+#endif  // __TEST_STREAM_FORALL_HPP__
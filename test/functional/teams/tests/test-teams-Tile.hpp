@@ -0,0 +1,118 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-20, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/COPYRIGHT file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#ifndef __TEST_TEAMS_TILE_HPP__
+#define __TEST_TEAMS_TILE_HPP__
+
+#include <vector>
+
+template <typename LAUNCH_POLICY, typename TILE_POLICY, typename LOOP_POLICY>
+void TeamsTileTestImpl(const int N, const int tile_size)
+{
+  std::vector<int> tile_idx(N, -1);
+  std::vector<int> local_idx(N, -1);
+  int* tile_ptr = tile_idx.data();
+  int* local_ptr = local_idx.data();
+
+  RAJA::expt::launch<LAUNCH_POLICY>(RAJA::expt::HOST,
+    RAJA::expt::Resources(RAJA::expt::Teams(1), RAJA::expt::Threads(1)),
+        [=](RAJA::expt::LaunchContext ctx) {
+
+          RAJA::expt::tile<TILE_POLICY>(ctx, tile_size, RAJA::RangeSegment(0, N),
+            [&](RAJA::RangeSegment const &t) {
+
+              RAJA::expt::loop_icount<LOOP_POLICY>(ctx, t, [&](int i, int ii) {
+                  tile_ptr[i] = *t.begin() / tile_size;
+                  local_ptr[i] = ii;
+              });
+          });
+        });
+
+  for (int i = 0; i < N; ++i) {
+    ASSERT_EQ(tile_idx[i], i / tile_size);
+    ASSERT_EQ(local_idx[i], i % tile_size);
+  }
+}
+
+template <typename LAUNCH_POLICY, typename TILE_POLICY, typename LOOP_POLICY>
+void TeamsTile2DTestImpl(const int N, const int tile_size)
+{
+  std::vector<int> A(N*N, 0);
+  std::vector<int> At(N*N, 0);
+  int* A_ptr = A.data();
+  int* At_ptr = At.data();
+
+  for (int i = 0; i < N*N; ++i) {
+    A[i] = i;
+  }
+
+  // tiled transpose through a tile-local buffer
+  RAJA::expt::launch<LAUNCH_POLICY>(RAJA::expt::HOST,
+    RAJA::expt::Resources(RAJA::expt::Teams(1), RAJA::expt::Threads(1)),
+        [=](RAJA::expt::LaunchContext ctx) {
+
+          RAJA::expt::tile<TILE_POLICY>(ctx, tile_size, RAJA::RangeSegment(0, N),
+            [&](RAJA::RangeSegment const &ty) {
+
+              RAJA::expt::tile<host_loop_policy<RAJA::loop_exec>>(
+                  ctx, tile_size, RAJA::RangeSegment(0, N),
+                [&](RAJA::RangeSegment const &tx) {
+
+                  std::vector<int> buf(tile_size * tile_size, -1);
+
+                  RAJA::expt::loop_icount<LOOP_POLICY>(ctx, tx, ty,
+                    [&](int c, int r, int ic, int ir) {
+                      buf[ic + tile_size * ir] = A_ptr[c + N * r];
+                  });
+
+                  RAJA::expt::loop_icount<LOOP_POLICY>(ctx, tx, ty,
+                    [&](int c, int r, int ic, int ir) {
+                      At_ptr[r + N * c] = buf[ic + tile_size * ir];
+                  });
+              });
+          });
+        });
+
+  for (int r = 0; r < N; ++r) {
+    for (int c = 0; c < N; ++c) {
+      ASSERT_EQ(At[r + N * c], A[c + N * r]);
+    }
+  }
+}
+
+
+TYPED_TEST_SUITE_P(TeamsTileTest);
+template <typename T>
+class TeamsTileTest : public ::testing::Test
+{
+};
+
+TYPED_TEST_P(TeamsTileTest, Tile1D)
+{
+  using LAUNCH_POLICY = typename camp::at<typename camp::at<TypeParam,camp::num<0>>::type, camp::num<0>>::type;
+  using TILE_POLICY = typename camp::at<typename camp::at<TypeParam,camp::num<0>>::type, camp::num<1>>::type;
+  using LOOP_POLICY = typename camp::at<typename camp::at<TypeParam,camp::num<0>>::type, camp::num<2>>::type;
+
+  TeamsTileTestImpl<LAUNCH_POLICY, TILE_POLICY, LOOP_POLICY>(1000, 64);
+  TeamsTileTestImpl<LAUNCH_POLICY, TILE_POLICY, LOOP_POLICY>(128, 32);
+  TeamsTileTestImpl<LAUNCH_POLICY, TILE_POLICY, LOOP_POLICY>(5, 16);
+}
+
+TYPED_TEST_P(TeamsTileTest, Tile2D)
+{
+  using LAUNCH_POLICY = typename camp::at<typename camp::at<TypeParam,camp::num<0>>::type, camp::num<0>>::type;
+  using TILE_POLICY = typename camp::at<typename camp::at<TypeParam,camp::num<0>>::type, camp::num<1>>::type;
+  using LOOP_POLICY = typename camp::at<typename camp::at<TypeParam,camp::num<0>>::type, camp::num<2>>::type;
+
+  TeamsTile2DTestImpl<LAUNCH_POLICY, TILE_POLICY, LOOP_POLICY>(100, 16);
+}
+
+REGISTER_TYPED_TEST_SUITE_P(TeamsTileTest,
+                            Tile1D,
+                            Tile2D);
+
+#endif  // __TEST_TEAMS_TILE_HPP__
@@ -0,0 +1,188 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-20, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/COPYRIGHT file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+///
+/// Header file containing tests for RAJA structured halo exchange.
+///
+
+#ifndef __TEST_WORKGROUP_HALO__
+#define __TEST_WORKGROUP_HALO__
+
+#include "RAJA_test-workgroup.hpp"
+
+#include <array>
+#include <vector>
+
+
+//
+// Exchange the halos of a periodic domain with itself. The neighbor
+// opposite to neighbor n stands in for the remote process, so the buffer
+// received from neighbor n is the buffer packed for the opposite neighbor.
+//
+template <typename ExecPolicy,
+          typename OrderPolicy,
+          typename StoragePolicy,
+          typename Allocator,
+          typename WORKING_RES
+          >
+void testWorkGroupHaloExchange(std::array<RAJA::Index_type, 3> const& interior,
+                               RAJA::Index_type width,
+                               std::array<camp::idx_t, 3> const& perm,
+                               int num_vars,
+                               int num_cycles)
+{
+  using policy = RAJA::WorkGroupPolicy<ExecPolicy, OrderPolicy, StoragePolicy>;
+  using halo_type = RAJA::HaloExchange<policy, double, 3, Allocator>;
+
+  camp::resources::Resource host_res{camp::resources::Host()};
+  camp::resources::Resource working_res{WORKING_RES::get_default()};
+
+  std::array<RAJA::Index_type, 3> extents;
+  for (int d = 0; d < 3; ++d) {
+    extents[d] = interior[d] + 2 * width;
+  }
+
+  RAJA::Layout<3> layout = RAJA::make_permuted_layout(extents, perm);
+  const RAJA::Index_type var_size = layout.size();
+
+  // value of the periodic image of a cell in the interior
+  auto expected = [&](int v, RAJA::Index_type i, RAJA::Index_type j,
+                      RAJA::Index_type k) {
+    RAJA::Index_type idx[3] = {i, j, k};
+    for (int d = 0; d < 3; ++d) {
+      idx[d] = ((idx[d] - width) % interior[d] + interior[d]) % interior[d];
+    }
+    return 1000000.0 * v + 10000.0 * idx[0] + 100.0 * idx[1] + idx[2];
+  };
+
+  auto is_interior = [&](RAJA::Index_type i, RAJA::Index_type j,
+                         RAJA::Index_type k) {
+    return i >= width && i < extents[0] - width &&
+           j >= width && j < extents[1] - width &&
+           k >= width && k < extents[2] - width;
+  };
+
+  double* test_array = host_res.allocate<double>(var_size);
+  std::vector<double*> vars(num_vars);
+
+  halo_type halo(layout, Allocator{});
+
+  for (int v = 0; v < num_vars; ++v) {
+    for (RAJA::Index_type i = 0; i < extents[0]; ++i) {
+      for (RAJA::Index_type j = 0; j < extents[1]; ++j) {
+        for (RAJA::Index_type k = 0; k < extents[2]; ++k) {
+          test_array[layout(i, j, k)] =
+              is_interior(i, j, k) ? expected(v, i, j, k) : -1.0;
+        }
+      }
+    }
+    vars[v] = working_res.allocate<double>(var_size);
+    working_res.memcpy(vars[v], test_array, sizeof(double) * var_size);
+
+    ASSERT_EQ(halo.add_variable(vars[v]), static_cast<size_t>(v));
+  }
+
+  auto neighbors = RAJA::make_halo_neighbors<3>(extents, width);
+  ASSERT_EQ(neighbors.size(), static_cast<size_t>(26));
+
+  for (auto const& neighbor : neighbors) {
+    halo.add_neighbor(neighbor.pack_box, neighbor.unpack_box);
+  }
+  const size_t num_neighbors = halo.num_neighbors();
+
+  std::vector<double*> send_buffers(num_neighbors);
+  std::vector<double*> recv_buffers(num_neighbors);
+  for (size_t n = 0; n < num_neighbors; ++n) {
+    const size_t opposite = num_neighbors - 1 - n;
+    for (int d = 0; d < 3; ++d) {
+      ASSERT_EQ(neighbors[n].direction[d], -neighbors[opposite].direction[d]);
+    }
+    ASSERT_EQ(halo.buffer_size(n),
+              num_vars * neighbors[n].pack_box.size());
+
+    send_buffers[n] = working_res.allocate<double>(halo.buffer_size(n));
+    recv_buffers[n] = working_res.allocate<double>(halo.buffer_size(n));
+  }
+
+  double** send_ptrs = working_res.allocate<double*>(num_neighbors);
+  double** recv_ptrs = working_res.allocate<double*>(num_neighbors);
+  working_res.memcpy(send_ptrs,
+                     send_buffers.data(),
+                     sizeof(double*) * num_neighbors);
+  working_res.memcpy(recv_ptrs,
+                     recv_buffers.data(),
+                     sizeof(double*) * num_neighbors);
+
+  for (int c = 0; c < num_cycles; ++c) {
+
+    auto pack_site = halo.pack(send_ptrs);
+
+    // local stand-in for sends and receives
+    for (size_t n = 0; n < num_neighbors; ++n) {
+      const size_t opposite = num_neighbors - 1 - n;
+      working_res.memcpy(recv_buffers[n],
+                         send_buffers[opposite],
+                         sizeof(double) * halo.buffer_size(n));
+    }
+
+    auto unpack_site = halo.unpack(recv_ptrs);
+  }
+
+  for (int v = 0; v < num_vars; ++v) {
+    working_res.memcpy(test_array, vars[v], sizeof(double) * var_size);
+
+    for (RAJA::Index_type i = 0; i < extents[0]; ++i) {
+      for (RAJA::Index_type j = 0; j < extents[1]; ++j) {
+        for (RAJA::Index_type k = 0; k < extents[2]; ++k) {
+          ASSERT_EQ(test_array[layout(i, j, k)], expected(v, i, j, k));
+        }
+      }
+    }
+  }
+
+  working_res.deallocate(send_ptrs);
+  working_res.deallocate(recv_ptrs);
+  for (size_t n = 0; n < num_neighbors; ++n) {
+    working_res.deallocate(send_buffers[n]);
+    working_res.deallocate(recv_buffers[n]);
+  }
+  for (int v = 0; v < num_vars; ++v) {
+    working_res.deallocate(vars[v]);
+  }
+  host_res.deallocate(test_array);
+}
+
+
+template <typename T>
+class WorkGroupHaloExchangeFunctionalTest : public ::testing::Test
+{
+};
+
+TYPED_TEST_SUITE_P(WorkGroupHaloExchangeFunctionalTest);
+
+
+TYPED_TEST_P(WorkGroupHaloExchangeFunctionalTest, WorkGroupHaloExchange)
+{
+  using ExecPolicy = typename camp::at<TypeParam, camp::num<0>>::type;
+  using OrderPolicy = typename camp::at<TypeParam, camp::num<1>>::type;
+  using StoragePolicy = typename camp::at<TypeParam, camp::num<2>>::type;
+  using Allocator = typename camp::at<TypeParam, camp::num<3>>::type;
+  using WORKING_RESOURCE = typename camp::at<TypeParam, camp::num<4>>::type;
+
+  // default and permuted layouts, ghost widths 1 and 2
+  testWorkGroupHaloExchange< ExecPolicy, OrderPolicy, StoragePolicy,
+                             Allocator, WORKING_RESOURCE >(
+      {{5, 4, 3}}, 1, {{0, 1, 2}}, 2, 2);
+  testWorkGroupHaloExchange< ExecPolicy, OrderPolicy, StoragePolicy,
+                             Allocator, WORKING_RESOURCE >(
+      {{6, 5, 4}}, 2, {{2, 0, 1}}, 3, 1);
+  testWorkGroupHaloExchange< ExecPolicy, OrderPolicy, StoragePolicy,
+                             Allocator, WORKING_RESOURCE >(
+      {{4, 7, 5}}, 1, {{1, 2, 0}}, 1, 1);
+}
+
+#endif  //__TEST_WORKGROUP_HALO__
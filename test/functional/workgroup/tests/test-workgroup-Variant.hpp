@@ -0,0 +1,161 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-20, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/COPYRIGHT file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+///
+/// Header file containing tests for RAJA workgroup variant storage.
+///
+
+#ifndef __TEST_WORKGROUP_VARIANT__
+#define __TEST_WORKGROUP_VARIANT__
+
+#include "RAJA_test-workgroup.hpp"
+#include "RAJA_test-forall-data.hpp"
+
+#include <vector>
+
+
+template < typename T >
+struct WorkGroupVariantAddIndex
+{
+  T* ptr;
+
+  RAJA_HOST_DEVICE void operator()(RAJA::Index_type i) const
+  {
+    ptr[i] += T(i);
+  }
+};
+
+template < typename T >
+struct WorkGroupVariantAddValue
+{
+  T* ptr;
+  T val;
+
+  RAJA_HOST_DEVICE void operator()(RAJA::Index_type i) const
+  {
+    ptr[i] += val;
+  }
+};
+
+
+//
+// Enqueue interleaved loops of two loop body types into a WorkGroup with
+// variant storage, and run the group several times.
+//
+template <typename ExecPolicy,
+          typename OrderPolicy,
+          typename Allocator,
+          typename WORKING_RES
+          >
+void testWorkGroupVariantMultiple(RAJA::Index_type N,
+                                  RAJA::Index_type num_loops,
+                                  RAJA::Index_type pool_reuse,
+                                  RAJA::Index_type group_reuse)
+{
+  using IndexType = RAJA::Index_type;
+  using segment_type = RAJA::TypedRangeSegment<IndexType>;
+  using type = double;
+
+  using StoragePolicy = RAJA::variant_array_of_objects<
+      RAJA::workgroup_loop<segment_type, WorkGroupVariantAddIndex<type>>,
+      RAJA::workgroup_loop<segment_type, WorkGroupVariantAddValue<type>>>;
+
+  using policy = RAJA::WorkGroupPolicy<ExecPolicy, OrderPolicy, StoragePolicy>;
+
+  using WorkPool_type = RAJA::WorkPool<policy, IndexType, RAJA::xargs<>, Allocator>;
+  using WorkGroup_type = RAJA::WorkGroup<policy, IndexType, RAJA::xargs<>, Allocator>;
+  using WorkSite_type = RAJA::WorkSite<policy, IndexType, RAJA::xargs<>, Allocator>;
+
+  camp::resources::Resource working_res{WORKING_RES::get_default()};
+
+  // each loop gets its own rows so unordered policies do not race
+  type* working_array;
+  type* check_array;
+  type* test_array;
+
+  allocateForallTestData<type>(N * 2 * num_loops,
+                               working_res,
+                               &working_array,
+                               &check_array,
+                               &test_array);
+
+  WorkPool_type pool(Allocator{});
+  WorkGroup_type group = pool.instantiate();
+  WorkSite_type site = group.run();
+
+  for (IndexType pr = 0; pr < pool_reuse; pr++) {
+
+    const type val(3 + pr);
+
+    for (IndexType j = 0; j < num_loops; j++) {
+      const IndexType begin = j % N;
+      pool.enqueue(segment_type{ begin, N },
+                   WorkGroupVariantAddIndex<type>{working_array + N * (2*j)});
+      pool.enqueue(segment_type{ 0, N - begin },
+                   WorkGroupVariantAddValue<type>{working_array + N * (2*j+1), val});
+    }
+
+    ASSERT_EQ(pool.num_loops(), static_cast<size_t>(2 * num_loops));
+
+    group = pool.instantiate();
+
+    for (IndexType gr = 0; gr < group_reuse; gr++) {
+
+      for (IndexType i = 0; i < N * 2 * num_loops; i++) {
+        test_array[i] = type(0);
+      }
+      working_res.memcpy(working_array, test_array, sizeof(type) * N * 2 * num_loops);
+
+      for (IndexType j = 0; j < num_loops; j++) {
+        const IndexType begin = j % N;
+        for (IndexType i = begin; i < N; i++) {
+          test_array[N * (2*j) + i] = type(i);
+        }
+        for (IndexType i = 0; i < N - begin; i++) {
+          test_array[N * (2*j+1) + i] = val;
+        }
+      }
+
+      site = group.run();
+
+      working_res.memcpy(check_array, working_array, sizeof(type) * N * 2 * num_loops);
+
+      for (IndexType i = 0; i < N * 2 * num_loops; i++) {
+        ASSERT_EQ(test_array[i], check_array[i]);
+      }
+    }
+  }
+
+  deallocateForallTestData<type>(working_res,
+                                 working_array,
+                                 check_array,
+                                 test_array);
+}
+
+
+template <typename T>
+class WorkGroupVariantMultipleFunctionalTest : public ::testing::Test
+{
+};
+
+TYPED_TEST_SUITE_P(WorkGroupVariantMultipleFunctionalTest);
+
+
+TYPED_TEST_P(WorkGroupVariantMultipleFunctionalTest, WorkGroupVariantMultiple)
+{
+  using ExecPolicy = typename camp::at<TypeParam, camp::num<0>>::type;
+  using OrderPolicy = typename camp::at<TypeParam, camp::num<1>>::type;
+  using Allocator = typename camp::at<TypeParam, camp::num<2>>::type;
+  using WORKING_RESOURCE = typename camp::at<TypeParam, camp::num<3>>::type;
+
+  testWorkGroupVariantMultiple< ExecPolicy, OrderPolicy,
+                                Allocator, WORKING_RESOURCE >(1, 1, 1, 1);
+  testWorkGroupVariantMultiple< ExecPolicy, OrderPolicy,
+                                Allocator, WORKING_RESOURCE >(1000, 17, 3, 2);
+}
+
+#endif  //__TEST_WORKGROUP_VARIANT__
@@ -15,7 +15,11 @@
 using SequentialForallIndexSetExecPols =
   camp::list< RAJA::ExecPolicy<RAJA::seq_segit, RAJA::seq_exec>,
               RAJA::ExecPolicy<RAJA::seq_segit, RAJA::loop_exec>,
-              RAJA::ExecPolicy<RAJA::seq_segit, RAJA::simd_exec> >;
+              RAJA::ExecPolicy<RAJA::seq_segit, RAJA::simd_exec>,
+              RAJA::ExecPolicy<RAJA::flatten_segit<RAJA::seq_exec, 7>,
+                               RAJA::seq_exec>,
+              RAJA::ExecPolicy<RAJA::flatten_segit<RAJA::loop_exec>,
+                               RAJA::simd_exec> >;
 
 //
 // Sequential execution policy types for reduction tests.
@@ -31,7 +35,11 @@ using OpenMPForallIndexSetExecPols =
   camp::list< RAJA::ExecPolicy<RAJA::omp_parallel_for_segit, RAJA::seq_exec>,
               RAJA::ExecPolicy<RAJA::omp_parallel_for_segit, RAJA::loop_exec>,
               RAJA::ExecPolicy<RAJA::omp_parallel_for_segit, RAJA::simd_exec>,
-              RAJA::ExecPolicy<RAJA::seq_segit, RAJA::omp_parallel_for_exec> >;
+              RAJA::ExecPolicy<RAJA::seq_segit, RAJA::omp_parallel_for_exec>,
+              RAJA::ExecPolicy<RAJA::flatten_segit<RAJA::omp_parallel_for_exec, 7>,
+                               RAJA::loop_exec>,
+              RAJA::ExecPolicy<RAJA::flatten_segit<RAJA::omp_parallel_for_exec>,
+                               RAJA::simd_exec> >;
 
 using OpenMPForallIndexSetReduceExecPols =
   camp::list< RAJA::ExecPolicy<RAJA::omp_parallel_for_segit, RAJA::seq_exec>,
@@ -52,7 +60,9 @@ using TBBForallIndexSetExecPols =
               RAJA::ExecPolicy<RAJA::seq_segit, RAJA::tbb_for_static< 2 >>,
               RAJA::ExecPolicy<RAJA::seq_segit, RAJA::tbb_for_static< 4 >>,
               RAJA::ExecPolicy<RAJA::seq_segit, RAJA::tbb_for_static< 8 >>,
-              RAJA::ExecPolicy<RAJA::seq_segit, RAJA::tbb_for_dynamic> >;
+              RAJA::ExecPolicy<RAJA::seq_segit, RAJA::tbb_for_dynamic>,
+              RAJA::ExecPolicy<RAJA::flatten_segit<RAJA::tbb_for_dynamic, 7>,
+                               RAJA::loop_exec> >;
 
 using TBBForallIndexSetReduceExecPols =
   camp::list< RAJA::ExecPolicy<RAJA::tbb_for_exec, RAJA::seq_exec>,
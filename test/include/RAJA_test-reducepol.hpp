@@ -18,6 +18,9 @@
 // Sequential reduction policy types
 using SequentialReducePols = camp::list< RAJA::seq_reduce >;
 
+using SequentialReproducibleReducePols =
+  camp::list< RAJA::seq_reduce_reproducible >;
+
 #if defined(RAJA_ENABLE_OPENMP)
 using OpenMPReducePols = 
 #if 0 // is ordered reduction broken???
@@ -26,10 +29,16 @@ using OpenMPReducePols =
 #else
   camp::list< RAJA::omp_reduce >;
 #endif
+
+using OpenMPReproducibleReducePols =
+  camp::list< RAJA::omp_reduce_reproducible >;
 #endif
 
 #if defined(RAJA_ENABLE_TBB)
 using TBBReducePols = camp::list< RAJA::tbb_reduce >;
+
+using TBBReproducibleReducePols =
+  camp::list< RAJA::tbb_reduce_reproducible >;
 #endif
 
 #if defined(RAJA_ENABLE_TARGET_OPENMP)
@@ -98,4 +98,46 @@ using Hip_launch_policies = camp::list<
 #endif // RAJA_ENABLE_HIP
 
 
+//
+// Host policies for tile and loop_icount tests: launch, tile, inner loop
+//
+#if defined(RAJA_DEVICE_ACTIVE)
+template <typename POL>
+using host_loop_policy = RAJA::expt::LoopPolicy<POL, POL>;
+template <typename POL>
+using host_launch_policy = RAJA::expt::LaunchPolicy<POL, POL>;
+#else
+template <typename POL>
+using host_loop_policy = RAJA::expt::LoopPolicy<POL>;
+template <typename POL>
+using host_launch_policy = RAJA::expt::LaunchPolicy<POL>;
+#endif
+
+using Sequential_tile_policies = camp::list<
+        camp::list<
+         host_launch_policy<RAJA::expt::seq_launch_t>,
+         host_loop_policy<RAJA::seq_exec>,
+         host_loop_policy<RAJA::seq_exec>>,
+        camp::list<
+         host_launch_policy<RAJA::expt::seq_launch_t>,
+         host_loop_policy<RAJA::loop_exec>,
+         host_loop_policy<RAJA::loop_exec>>,
+        camp::list<
+         host_launch_policy<RAJA::expt::seq_launch_t>,
+         host_loop_policy<RAJA::loop_exec>,
+         host_loop_policy<RAJA::simd_exec>>>;
+
+#if defined(RAJA_ENABLE_OPENMP)
+using OpenMP_tile_policies = camp::list<
+        camp::list<
+         host_launch_policy<RAJA::expt::omp_launch_t>,
+         host_loop_policy<RAJA::omp_parallel_for_exec>,
+         host_loop_policy<RAJA::loop_exec>>,
+        camp::list<
+         host_launch_policy<RAJA::expt::omp_launch_t>,
+         host_loop_policy<RAJA::omp_parallel_for_exec>,
+         host_loop_policy<RAJA::simd_exec>>>;
+#endif  // RAJA_ENABLE_OPENMP
+
+
 #endif  // __RAJA_test_teams_execpol_HPP__
@@ -0,0 +1,50 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-20, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/COPYRIGHT file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#include "RAJA/RAJA.hpp"
+#include "gtest/gtest.h"
+
+#include <cstdlib>
+#include <fstream>
+#include <string>
+#include <vector>
+
+// The report lists each launch site once, with its number of launches,
+// whether or not hardware counters can be read on this machine.
+TEST(PluginTestPerfCounters, Report)
+{
+  const char* report = std::getenv("RAJA_PERF_COUNTERS");
+  ASSERT_NE(report, nullptr);
+
+  std::vector<double> a(1000, 0.0);
+  double* a_ptr = a.data();
+
+  for (int r = 0; r < 3; ++r) {
+    RAJA::forall<RAJA::seq_exec>(RAJA::RangeSegment(0, 1000),
+                                 [=](int i) { a_ptr[i] += 1.0; });
+    RAJA::forall<RAJA::loop_exec>(RAJA::RangeSegment(0, 1000),
+                                  [=](int i) { a_ptr[i] *= 2.0; });
+  }
+
+  RAJA::util::finalize_plugins();
+
+  std::ifstream in(report);
+  ASSERT_TRUE(in.good());
+
+  std::string line;
+  std::getline(in, line);
+  ASSERT_NE(line.find("PerfCounterPlugin"), std::string::npos);
+  std::getline(in, line);
+  ASSERT_NE(line.find("launches"), std::string::npos);
+
+  int sites = 0;
+  while (std::getline(in, line)) {
+    ASSERT_EQ(std::stoi(line), 3);
+    ++sites;
+  }
+  ASSERT_EQ(sites, 2);
+}
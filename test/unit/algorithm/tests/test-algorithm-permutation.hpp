@@ -0,0 +1,108 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-20, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/COPYRIGHT file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+///
+/// Header file containing tests for sort permutation, gather and apply
+/// permutation patterns
+///
+
+#ifndef __TEST_UNIT_ALGORITHM_PERMUTATION_HPP__
+#define __TEST_UNIT_ALGORITHM_PERMUTATION_HPP__
+
+#include <random>
+#include <string>
+#include <vector>
+
+//
+// Particle record large enough that moving it through a sort is costly
+//
+struct PermutationTestRecord {
+  double x[12];
+  RAJA::Index_type id;
+};
+
+template <typename EXEC_POLICY>
+void PermutationTestImpl(RAJA::Index_type n)
+{
+  std::mt19937 gen(n);
+  std::uniform_int_distribution<int> dist(0, 50);
+
+  // many equal keys to check the permutation is stable
+  std::vector<int> keys(n);
+  for (auto& k : keys) {
+    k = dist(gen);
+  }
+  const std::vector<int> keys_orig(keys);
+
+  std::vector<RAJA::Index_type> perm(n);
+  RAJA::sort_permutation<EXEC_POLICY>(keys.begin(), keys.end(), perm.begin());
+
+  ASSERT_EQ(keys, keys_orig);
+  for (RAJA::Index_type i = 1; i < n; ++i) {
+    ASSERT_LE(keys[perm[i - 1]], keys[perm[i]]);
+    if (keys[perm[i - 1]] == keys[perm[i]]) {
+      ASSERT_LT(perm[i - 1], perm[i]);
+    }
+  }
+
+  std::vector<int> perm_int(n);
+  RAJA::argsort(EXEC_POLICY{}, keys, perm_int, RAJA::operators::greater<int>{});
+  for (RAJA::Index_type i = 1; i < n; ++i) {
+    ASSERT_GE(keys[perm_int[i - 1]], keys[perm_int[i]]);
+  }
+
+  std::vector<PermutationTestRecord> records(n);
+  std::vector<std::string> names(n);
+  for (RAJA::Index_type i = 0; i < n; ++i) {
+    records[i].id = i;
+    records[i].x[11] = keys[i];
+    names[i] = "particle " + std::to_string(i);
+  }
+
+  std::vector<PermutationTestRecord> gathered(n);
+  RAJA::gather<EXEC_POLICY>(perm.data(),
+                            perm.data() + n,
+                            records.data(),
+                            gathered.data());
+
+  RAJA::apply_permutation<EXEC_POLICY>(perm.begin(),
+                                       perm.end(),
+                                       records.data(),
+                                       names.begin(),
+                                       keys.data());
+
+  for (RAJA::Index_type i = 0; i < n; ++i) {
+    ASSERT_EQ(gathered[i].id, perm[i]);
+    ASSERT_EQ(records[i].id, perm[i]);
+    ASSERT_EQ(records[i].x[11], keys_orig[perm[i]]);
+    ASSERT_EQ(names[i], "particle " + std::to_string(perm[i]));
+    ASSERT_EQ(keys[i], keys_orig[perm[i]]);
+  }
+}
+
+
+template <typename T>
+class PermutationUnitTest : public ::testing::Test
+{
+};
+
+TYPED_TEST_SUITE_P(PermutationUnitTest);
+
+TYPED_TEST_P(PermutationUnitTest, PermutationTest)
+{
+  using EXEC_POLICY = typename camp::at<TypeParam, camp::num<0>>::type;
+
+  PermutationTestImpl<EXEC_POLICY>(0);
+  PermutationTestImpl<EXEC_POLICY>(1);
+  PermutationTestImpl<EXEC_POLICY>(1000);
+  PermutationTestImpl<EXEC_POLICY>(5001);
+}
+
+REGISTER_TYPED_TEST_SUITE_P(PermutationUnitTest,
+                            PermutationTest);
+
+#endif  // __TEST_UNIT_ALGORITHM_PERMUTATION_HPP__
@@ -104,7 +104,9 @@ using OpenMPSortSorters =
 using TBBSortSorters =
   camp::list<
               PolicySort<RAJA::tbb_for_exec>,
-              PolicySortPairs<RAJA::tbb_for_exec>
+              PolicySortPairs<RAJA::tbb_for_exec>,
+              PolicySort<RAJA::tbb_arena_for_exec>,
+              PolicySortPairs<RAJA::tbb_arena_for_exec>
             >;
 
 #endif
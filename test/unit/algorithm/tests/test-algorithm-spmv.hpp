@@ -0,0 +1,140 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-20, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/COPYRIGHT file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+///
+/// Header file containing tests for sparse matrix patterns
+///
+
+#ifndef __TEST_UNIT_ALGORITHM_SPMV_HPP__
+#define __TEST_UNIT_ALGORITHM_SPMV_HPP__
+
+#include <vector>
+
+//
+// Build a CSR matrix with skewed row lengths: empty rows, short rows and a
+// few rows holding most of the nonzeros. Values are small integers so the
+// products are exact in any summation order.
+//
+template <typename INDEX_TYPE>
+void SpmvTestBuildMatrix(INDEX_TYPE nrows,
+                         INDEX_TYPE ncols,
+                         std::vector<INDEX_TYPE>& row_ptr,
+                         std::vector<INDEX_TYPE>& col_idx,
+                         std::vector<double>& values)
+{
+  row_ptr.assign(1, INDEX_TYPE(0));
+  col_idx.clear();
+  values.clear();
+
+  for (INDEX_TYPE r = 0; r < nrows; ++r) {
+    INDEX_TYPE len;
+    if (r % 17 == 3) {
+      len = ncols;
+    } else if (r % 5 == 0) {
+      len = 0;
+    } else {
+      len = (r % 7) < ncols ? (r % 7) : ncols;
+    }
+    for (INDEX_TYPE k = 0; k < len; ++k) {
+      col_idx.push_back((r + k * 3) % ncols);
+      values.push_back(double((r + k) % 4) - 1.0);
+    }
+    row_ptr.push_back(static_cast<INDEX_TYPE>(col_idx.size()));
+  }
+}
+
+template <typename INDEX_TYPE, typename EXEC_POLICY>
+void SpmvTestImpl(INDEX_TYPE nrows, INDEX_TYPE ncols)
+{
+  std::vector<INDEX_TYPE> row_ptr;
+  std::vector<INDEX_TYPE> col_idx;
+  std::vector<double> values;
+  SpmvTestBuildMatrix(nrows, ncols, row_ptr, col_idx, values);
+
+  RAJA::CSRView<double, INDEX_TYPE> A(nrows,
+                                      ncols,
+                                      row_ptr.data(),
+                                      col_idx.data(),
+                                      values.data());
+
+  std::vector<double> x(ncols);
+  for (INDEX_TYPE c = 0; c < ncols; ++c) {
+    x[c] = double(c % 5) + 1.0;
+  }
+
+  std::vector<double> ref(nrows);
+  for (INDEX_TYPE r = 0; r < nrows; ++r) {
+    double sum = 0.0;
+    for (INDEX_TYPE k = row_ptr[r]; k < row_ptr[r + 1]; ++k) {
+      sum += values[k] * x[col_idx[k]];
+    }
+    ref[r] = sum;
+  }
+
+  // y = A * x
+  std::vector<double> y(nrows, -7.0);
+  RAJA::spmv<EXEC_POLICY>(A, x.data(), y.data());
+  for (INDEX_TYPE r = 0; r < nrows; ++r) {
+    ASSERT_EQ(ref[r], y[r]);
+  }
+
+  // y = 2 * A * x + 3 * y
+  std::vector<double> y2(nrows, 1.0);
+  RAJA::spmv(EXEC_POLICY{}, A, x.data(), y2.data(), 2.0, 3.0);
+  for (INDEX_TYPE r = 0; r < nrows; ++r) {
+    ASSERT_EQ(2.0 * ref[r] + 3.0, y2[r]);
+  }
+
+  // SELL-C-sigma, with and without sorting
+  auto sell_sorted = RAJA::make_sell_matrix<4>(A, INDEX_TYPE(8));
+  auto sell_plain = RAJA::make_sell_matrix<8>(A, INDEX_TYPE(1));
+  ASSERT_GE(sell_sorted.storage_size(), A.nnz());
+
+  std::vector<double> ys(nrows, -7.0);
+  RAJA::spmv<EXEC_POLICY>(sell_sorted.view(), x.data(), ys.data());
+  for (INDEX_TYPE r = 0; r < nrows; ++r) {
+    ASSERT_EQ(ref[r], ys[r]);
+  }
+
+  std::vector<double> yp(nrows, 1.0);
+  RAJA::spmv(EXEC_POLICY{}, sell_plain.view(), x.data(), yp.data(), 2.0, 3.0);
+  for (INDEX_TYPE r = 0; r < nrows; ++r) {
+    ASSERT_EQ(2.0 * ref[r] + 3.0, yp[r]);
+  }
+
+  // every row visited exactly once
+  std::vector<int> count(nrows, 0);
+  int* count_ptr = count.data();
+  RAJA::sparse_forall_rows<EXEC_POLICY>(A, [=](INDEX_TYPE r) {
+    count_ptr[r] += 1;
+  });
+  for (INDEX_TYPE r = 0; r < nrows; ++r) {
+    ASSERT_EQ(1, count[r]);
+  }
+}
+
+
+TYPED_TEST_SUITE_P(SpmvUnitTest);
+template <typename T>
+class SpmvUnitTest : public ::testing::Test
+{
+};
+
+TYPED_TEST_P(SpmvUnitTest, SparseMatrixVector)
+{
+  using INDEX_TYPE  = typename camp::at<TypeParam, camp::num<0>>::type;
+  using EXEC_POLICY = typename camp::at<TypeParam, camp::num<1>>::type;
+
+  SpmvTestImpl<INDEX_TYPE, EXEC_POLICY>(1, 1);
+  SpmvTestImpl<INDEX_TYPE, EXEC_POLICY>(13, 9);
+  SpmvTestImpl<INDEX_TYPE, EXEC_POLICY>(1000, 257);
+}
+
+REGISTER_TYPED_TEST_SUITE_P(SpmvUnitTest,
+                            SparseMatrixVector);
+
+#endif  // __TEST_UNIT_ALGORITHM_SPMV_HPP__
@@ -104,7 +104,9 @@ using OpenMPStableSortSorters =
 using TBBStableSortSorters =
   camp::list<
               PolicyStableSort<RAJA::tbb_for_exec>,
-              PolicyStableSortPairs<RAJA::tbb_for_exec>
+              PolicyStableSortPairs<RAJA::tbb_for_exec>,
+              PolicyStableSort<RAJA::tbb_arena_for_exec>,
+              PolicyStableSortPairs<RAJA::tbb_arena_for_exec>
             >;
 
 #endif
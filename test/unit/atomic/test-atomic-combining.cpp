@@ -0,0 +1,156 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-20, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/COPYRIGHT file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+///
+/// Source file containing tests for the combining_atomic policy
+///
+
+#include "RAJA/RAJA.hpp"
+
+#include "RAJA_gtest.hpp"
+
+#include <vector>
+
+#if defined(RAJA_ENABLE_OPENMP)
+using CombiningExecPolicy = RAJA::omp_parallel_for_exec;
+using CombiningAtomicPolicy = RAJA::combining_atomic<RAJA::omp_atomic>;
+#else
+using CombiningExecPolicy = RAJA::loop_exec;
+using CombiningAtomicPolicy = RAJA::combining_atomic<RAJA::builtin_atomic>;
+#endif
+
+TEST(AtomicCombiningUnitTest, HotAddresses)
+{
+  using pol = CombiningAtomicPolicy;
+
+  const int N = 100000;
+
+  long sum = 0;
+  int count = 0;
+  unsigned int down = 0u;
+  double dsum = 0.0;
+  int minval = N;
+  int maxval = -1;
+  unsigned int bor = 0u;
+  unsigned int band = ~0u;
+  unsigned int bxor = 0u;
+
+  long* sum_ptr = &sum;
+  int* count_ptr = &count;
+  unsigned int* down_ptr = &down;
+  double* dsum_ptr = &dsum;
+  int* min_ptr = &minval;
+  int* max_ptr = &maxval;
+  unsigned int* bor_ptr = &bor;
+  unsigned int* band_ptr = &band;
+  unsigned int* bxor_ptr = &bxor;
+
+  RAJA::forall<CombiningExecPolicy>(RAJA::RangeSegment(0, N), [=](int i) {
+    RAJA::atomicAdd<pol>(sum_ptr, static_cast<long>(i));
+    RAJA::atomicInc<pol>(count_ptr);
+    RAJA::atomicDec<pol>(down_ptr);
+    RAJA::atomicSub<pol>(dsum_ptr, 0.5);
+    RAJA::atomicMin<pol>(min_ptr, i % 777 + 3);
+    RAJA::atomicMax<pol>(max_ptr, i % 777);
+    RAJA::atomicOr<pol>(bor_ptr, 1u << (i % 32));
+    RAJA::atomicAnd<pol>(band_ptr, ~(1u << (i % 31)));
+    RAJA::atomicXor<pol>(bxor_ptr, static_cast<unsigned int>(i & 1));
+  });
+
+  RAJA::atomicFlush<pol>();
+
+  ASSERT_EQ(sum, static_cast<long>(N) * (N - 1) / 2);
+  ASSERT_EQ(count, N);
+  ASSERT_EQ(down, 0u - static_cast<unsigned int>(N));
+  ASSERT_EQ(dsum, -0.5 * N);
+  ASSERT_EQ(minval, 3);
+  ASSERT_EQ(maxval, 776);
+  ASSERT_EQ(bor, ~0u);
+  ASSERT_EQ(band, 1u << 31);
+  ASSERT_EQ(bxor, 0u);
+}
+
+TEST(AtomicCombiningUnitTest, ManyAddresses)
+{
+  using pol = CombiningAtomicPolicy;
+
+  // more bins than thread and socket slots, so slots are evicted
+  const int N = 100000;
+  const int bins = 1000;
+  std::vector<long> hist(bins, 0);
+  long* hist_ptr = hist.data();
+
+  for (int round = 1; round <= 2; ++round) {
+    RAJA::forall<CombiningExecPolicy>(RAJA::RangeSegment(0, N), [=](int i) {
+      RAJA::AtomicRef<long, pol> bin(&hist_ptr[(static_cast<long>(i) * 7919) % bins]);
+      bin += 1;
+    });
+
+    RAJA::atomicFlush<pol>();
+
+    for (int b = 0; b < bins; ++b) {
+      ASSERT_EQ(hist[b], round * N / bins);
+    }
+  }
+}
+
+TEST(AtomicCombiningUnitTest, CollidingAddresses)
+{
+  using pol = CombiningAtomicPolicy;
+
+  // two counters whose addresses hash to the same thread slot
+  const size_t slots = RAJA::detail::combining_atomic_thread_slots;
+  std::vector<long> counters(16 * slots, 0);
+  long* a = &counters[0];
+  long* b = nullptr;
+  for (size_t i = 1; i < counters.size() && b == nullptr; ++i) {
+    if (RAJA::detail::combining_atomic_hash(&counters[i]) % slots ==
+        RAJA::detail::combining_atomic_hash(a) % slots) {
+      b = &counters[i];
+    }
+  }
+  ASSERT_NE(b, nullptr);
+
+  RAJA::atomicFlush<pol>();
+
+  const int N = 1000;
+  for (int i = 0; i < N; ++i) {
+    RAJA::atomicAdd<pol>(a, 1L);
+    RAJA::atomicAdd<pol>(b, 2L);
+  }
+
+  // both stay in the calling thread's slots instead of evicting each other
+  int buffered = 0;
+  for (auto& e : RAJA::detail::combining_atomic_buffer().entries) {
+    if (e.addr == a || e.addr == b) {
+      ++buffered;
+    }
+  }
+  ASSERT_EQ(buffered, 2);
+
+  RAJA::atomicFlush<pol>();
+
+  ASSERT_EQ(*a, N);
+  ASSERT_EQ(*b, 2 * N);
+}
+
+TEST(AtomicCombiningUnitTest, DirectOperations)
+{
+  using pol = CombiningAtomicPolicy;
+
+  int val = 3;
+
+  ASSERT_EQ(RAJA::atomicExchange<pol>(&val, 5), 3);
+  ASSERT_EQ(val, 5);
+  ASSERT_EQ(RAJA::atomicCAS<pol>(&val, 5, 7), 5);
+  ASSERT_EQ(val, 7);
+
+  // flush is a no-op for policies that do not buffer
+  RAJA::atomicFlush<RAJA::seq_atomic>();
+  RAJA::atomicFlush<pol>();
+  ASSERT_EQ(val, 7);
+}
@@ -0,0 +1,102 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-20, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/COPYRIGHT file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+///
+/// Source file containing tests for atomicMinLoc and atomicMaxLoc
+///
+
+#include "RAJA/RAJA.hpp"
+
+#include "RAJA_gtest.hpp"
+
+#if defined(RAJA_ENABLE_OPENMP)
+using LocExecPolicy = RAJA::omp_parallel_for_exec;
+using LocAtomicPolicy = RAJA::omp_atomic;
+#else
+using LocExecPolicy = RAJA::loop_exec;
+using LocAtomicPolicy = RAJA::builtin_atomic;
+#endif
+
+// every value appears many times, so the smallest location must win ties
+template <typename T, typename IndexType>
+void testMinMaxLoc()
+{
+  using pair = RAJA::ValLoc<T, IndexType>;
+
+  const int N = 100000;
+
+  pair minloc(static_cast<T>(2000), -1);
+  pair maxloc(static_cast<T>(-1), -1);
+
+  pair* min_ptr = &minloc;
+  RAJA::AtomicRef<pair, LocAtomicPolicy> max_ref(&maxloc);
+
+  RAJA::forall<LocExecPolicy>(RAJA::RangeSegment(0, N), [=](int i) {
+    T val = static_cast<T>((static_cast<long>(i) * 7919) % 1001);
+    RAJA::atomicMinLoc<LocAtomicPolicy>(min_ptr, val, i);
+    max_ref.max(pair(val, static_cast<IndexType>(N - 1 - i)));
+  });
+
+  pair expect_min(static_cast<T>(2000), -1);
+  pair expect_max(static_cast<T>(-1), -1);
+  for (int i = 0; i < N; ++i) {
+    T val = static_cast<T>((static_cast<long>(i) * 7919) % 1001);
+    if (val < expect_min.val) {
+      expect_min = pair(val, i);
+    }
+    if (val > expect_max.val ||
+        (val == expect_max.val && N - 1 - i < expect_max.loc)) {
+      expect_max = pair(val, N - 1 - i);
+    }
+  }
+
+  ASSERT_EQ(minloc.val, expect_min.val);
+  ASSERT_EQ(minloc.loc, expect_min.loc);
+  ASSERT_EQ(maxloc.val, expect_max.val);
+  ASSERT_EQ(maxloc.loc, expect_max.loc);
+}
+
+TEST(AtomicLocUnitTest, Packed64)
+{
+  testMinMaxLoc<float, int>();
+}
+
+TEST(AtomicLocUnitTest, Packed128)
+{
+  testMinMaxLoc<double, int>();
+  testMinMaxLoc<double, long>();
+  testMinMaxLoc<float, long>();
+}
+
+TEST(AtomicLocUnitTest, Locked)
+{
+  testMinMaxLoc<long double, long>();
+}
+
+TEST(AtomicLocUnitTest, ReturnValues)
+{
+  using pair = RAJA::ValLoc<double, int>;
+
+  pair val(5.0, 3);
+
+  pair old = RAJA::atomicMinLoc<RAJA::seq_atomic>(&val, 5.0, 1);
+  ASSERT_EQ(old.getVal(), 5.0);
+  ASSERT_EQ(old.getLoc(), 3);
+  ASSERT_EQ(val.getLoc(), 1);
+
+  old = RAJA::atomicMaxLoc<RAJA::builtin_atomic>(&val, pair(4.0, 0));
+  ASSERT_EQ(old.getLoc(), 1);
+  ASSERT_EQ(val.getVal(), 5.0);
+  ASSERT_EQ(val.getLoc(), 1);
+
+  RAJA::AtomicRef<pair, RAJA::auto_atomic> ref(&val);
+  ref = pair(2.0, 7);
+  ASSERT_EQ(ref.min(pair(3.0, 0)).getLoc(), 7);
+  ASSERT_EQ(ref.fetch_min(pair(1.0, 9)).getVal(), 2.0);
+  ASSERT_EQ(ref.load().getVal(), 1.0);
+  ASSERT_EQ(ref.load().getLoc(), 9);
+}
@@ -0,0 +1,140 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-20, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/COPYRIGHT file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+///
+/// Header file containing tests for LaunchGraph record and replay
+///
+
+#ifndef __TEST_UNIT_GRAPH_REPLAY_HPP__
+#define __TEST_UNIT_GRAPH_REPLAY_HPP__
+
+#include <vector>
+
+//
+// Graph policies and kernel policies usable inside a graph of that policy
+//
+using SequentialGraphPols = camp::list< RAJA::seq_graph >;
+
+using SequentialGraphKernelPols =
+  camp::list< RAJA::KernelPolicy<
+                RAJA::statement::For<0, RAJA::seq_exec,
+                  RAJA::statement::For<1, RAJA::seq_exec,
+                    RAJA::statement::Lambda<0> > > > >;
+
+#if defined(RAJA_ENABLE_OPENMP)
+using OpenMPGraphPols = camp::list< RAJA::omp_graph >;
+
+using OpenMPGraphKernelPols =
+  camp::list< RAJA::KernelPolicy<
+                RAJA::statement::For<0, RAJA::omp_for_nowait_exec,
+                  RAJA::statement::For<1, RAJA::seq_exec,
+                    RAJA::statement::Lambda<0> > > > >;
+#endif
+
+template <typename INDEX_TYPE, typename GRAPH_POLICY, typename KERNEL_POLICY>
+void GraphReplayTestImpl(INDEX_TYPE N, INDEX_TYPE M)
+{
+  std::vector<INDEX_TYPE> a_vec(N), b_vec(N), c_vec(N), d_vec(N), e_vec(N * M);
+  INDEX_TYPE* a = a_vec.data();
+  INDEX_TYPE* b = b_vec.data();
+  INDEX_TYPE* c = c_vec.data();
+  INDEX_TYPE* d = d_vec.data();
+  INDEX_TYPE* e = e_vec.data();
+
+  INDEX_TYPE offset = 0;
+  INDEX_TYPE* offset_ptr = &offset;
+
+  RAJA::TypedRangeSegment<INDEX_TYPE> range(0, N);
+
+  RAJA::LaunchGraph<GRAPH_POLICY> graph;
+
+  graph.forall(range, [=](INDEX_TYPE i) { a[i] = i + *offset_ptr; });
+  graph.forall(RAJA::GraphDep::pointwise, range, [=](INDEX_TYPE i) {
+    b[i] = 2 * a[i];
+  });
+  graph.forall(RAJA::GraphDep::none, range, [=](INDEX_TYPE i) { c[i] = 1; });
+  graph.forall(range, [=](INDEX_TYPE i) { d[i] = b[N - 1 - i] + c[i]; });
+  graph.template kernel<KERNEL_POLICY>(
+      RAJA::make_tuple(range, RAJA::TypedRangeSegment<INDEX_TYPE>(0, M)),
+      [=](INDEX_TYPE i, INDEX_TYPE j) { e[i * M + j] = d[i] + j; });
+
+  ASSERT_EQ(size_t(5), graph.size());
+  // only the reversed read and the kernel need a barrier
+  ASSERT_EQ(size_t(2), graph.num_barriers());
+
+  for (INDEX_TYPE cycle = 0; cycle < 3; ++cycle) {
+    offset = cycle;
+    graph.replay();
+
+    for (INDEX_TYPE i = 0; i < N; ++i) {
+      ASSERT_EQ(a[i], i + cycle);
+      ASSERT_EQ(b[i], 2 * (i + cycle));
+      ASSERT_EQ(c[i], INDEX_TYPE(1));
+      ASSERT_EQ(d[i], 2 * (N - 1 - i + cycle) + 1);
+      for (INDEX_TYPE j = 0; j < M; ++j) {
+        ASSERT_EQ(e[i * M + j], d[i] + j);
+      }
+    }
+  }
+
+  graph.clear();
+  ASSERT_EQ(size_t(0), graph.size());
+  graph.replay();
+}
+
+template <typename INDEX_TYPE, typename GRAPH_POLICY>
+void GraphPointwiseLengthTestImpl()
+{
+  RAJA::LaunchGraph<GRAPH_POLICY> graph;
+
+  graph.forall(RAJA::TypedRangeSegment<INDEX_TYPE>(0, 10), [=](INDEX_TYPE) {});
+  // a pointwise dependence on a loop of another length needs a barrier
+  graph.forall(RAJA::GraphDep::pointwise,
+               RAJA::TypedRangeSegment<INDEX_TYPE>(0, 9),
+               [=](INDEX_TYPE) {});
+  graph.forall(RAJA::GraphDep::pointwise,
+               RAJA::TypedRangeSegment<INDEX_TYPE>(1, 10),
+               [=](INDEX_TYPE) {});
+
+  ASSERT_EQ(size_t(1), graph.num_barriers());
+}
+
+
+template <typename T>
+class GraphReplayUnitTest : public ::testing::Test
+{
+};
+
+TYPED_TEST_SUITE_P(GraphReplayUnitTest);
+
+TYPED_TEST_P(GraphReplayUnitTest, Replay)
+{
+  using INDEX_TYPE    = typename camp::at<TypeParam, camp::num<0>>::type;
+  using GRAPH_POLICY  = typename camp::at<TypeParam, camp::num<1>>::type;
+  using KERNEL_POLICY = typename camp::at<TypeParam, camp::num<2>>::type;
+
+  GraphReplayTestImpl<INDEX_TYPE, GRAPH_POLICY, KERNEL_POLICY>(INDEX_TYPE(1),
+                                                               INDEX_TYPE(1));
+  GraphReplayTestImpl<INDEX_TYPE, GRAPH_POLICY, KERNEL_POLICY>(INDEX_TYPE(37),
+                                                               INDEX_TYPE(3));
+  GraphReplayTestImpl<INDEX_TYPE, GRAPH_POLICY, KERNEL_POLICY>(INDEX_TYPE(100),
+                                                               INDEX_TYPE(1));
+}
+
+TYPED_TEST_P(GraphReplayUnitTest, PointwiseLength)
+{
+  using INDEX_TYPE    = typename camp::at<TypeParam, camp::num<0>>::type;
+  using GRAPH_POLICY  = typename camp::at<TypeParam, camp::num<1>>::type;
+
+  GraphPointwiseLengthTestImpl<INDEX_TYPE, GRAPH_POLICY>();
+}
+
+REGISTER_TYPED_TEST_SUITE_P(GraphReplayUnitTest,
+                            Replay,
+                            PointwiseLength);
+
+#endif  // __TEST_UNIT_GRAPH_REPLAY_HPP__
@@ -0,0 +1,187 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-20, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/COPYRIGHT file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+///
+/// Header file containing tests for TaskGraph dataflow execution
+///
+
+#ifndef __TEST_UNIT_TASKGRAPH_HPP__
+#define __TEST_UNIT_TASKGRAPH_HPP__
+
+#include <atomic>
+#include <vector>
+
+//
+// TaskGraph policies and execution policies of the tasks in the graph
+//
+using SequentialTaskGraphPols = camp::list< RAJA::seq_taskgraph >;
+
+using SequentialTaskExecPols = camp::list< RAJA::seq_exec,
+                                           RAJA::loop_exec >;
+
+#if defined(RAJA_ENABLE_OPENMP)
+using OpenMPTaskGraphPols = camp::list< RAJA::omp_taskgraph >;
+
+using OpenMPTaskExecPols = camp::list< RAJA::seq_exec,
+                                       RAJA::omp_parallel_for_exec >;
+#endif
+
+#if defined(RAJA_ENABLE_TBB)
+using TBBTaskGraphPols = camp::list< RAJA::tbb_taskgraph >;
+
+using TBBTaskExecPols = camp::list< RAJA::seq_exec,
+                                    RAJA::tbb_for_exec >;
+#endif
+
+template <typename INDEX_TYPE, typename TASKGRAPH_POLICY, typename EXEC_POLICY>
+void TaskGraphDataflowTestImpl(INDEX_TYPE N)
+{
+  using kernel_policy = RAJA::KernelPolicy<
+                          RAJA::statement::For<0, RAJA::seq_exec,
+                            RAJA::statement::Lambda<0> > >;
+
+  std::vector<INDEX_TYPE> a_vec(N), b_vec(N), c_vec(N), d_vec(N);
+  INDEX_TYPE* a = a_vec.data();
+  INDEX_TYPE* b = b_vec.data();
+  INDEX_TYPE* c = c_vec.data();
+  INDEX_TYPE* d = d_vec.data();
+
+  RAJA::View<INDEX_TYPE, RAJA::Layout<1>> b_view(b, N);
+
+  INDEX_TYPE total = 0;
+  INDEX_TYPE* total_ptr = &total;
+
+  RAJA::TypedRangeSegment<INDEX_TYPE> range(0, N);
+
+  RAJA::TaskGraph<TASKGRAPH_POLICY> graph;
+
+  const size_t set_a = graph.template forall<EXEC_POLICY>(
+      RAJA::task_in(), RAJA::task_out(a), range, [=](INDEX_TYPE i) {
+        a[i] = i;
+      });
+  const size_t set_b = graph.template kernel<kernel_policy>(
+      RAJA::task_in(), RAJA::task_out(b_view), RAJA::make_tuple(range),
+      [=](INDEX_TYPE i) { b_view(i) = 2; });
+  const size_t set_c = graph.template forall<EXEC_POLICY>(
+      RAJA::task_in(a, b), RAJA::task_out(c), range, [=](INDEX_TYPE i) {
+        c[i] = a[i] + b[i];
+      });
+  const size_t set_d = graph.template forall<EXEC_POLICY>(
+      RAJA::task_in(a), RAJA::task_out(d), range, [=](INDEX_TYPE i) {
+        d[i] = 3 * a[i];
+      });
+  const size_t scan_c = graph.template inclusive_scan_inplace<EXEC_POLICY>(
+      RAJA::task_in(c), RAJA::task_out(c), c, c + N);
+  // overwrites a after set_c and set_d read it
+  const size_t reset_a = graph.template forall<EXEC_POLICY>(
+      RAJA::task_in(), RAJA::task_out(a), range, [=](INDEX_TYPE i) {
+        a[i] = -1;
+      });
+  const size_t sum = graph.task(
+      RAJA::task_in(c_vec, d), RAJA::task_out(total_ptr), [=]() {
+        *total_ptr = c[N - 1] + d[N - 1];
+      });
+
+  ASSERT_EQ(size_t(7), graph.size());
+
+  // set_a: set_c set_d reset_a, set_b: set_c, set_c: scan_c reset_a,
+  // set_d: reset_a sum, scan_c: sum
+  ASSERT_EQ(size_t(9), graph.num_dependences());
+  ASSERT_EQ(size_t(3), graph.successors(set_a).size());
+  ASSERT_EQ(size_t(1), graph.successors(set_b).size());
+  ASSERT_EQ(size_t(2), graph.successors(set_c).size());
+  ASSERT_EQ(size_t(2), graph.successors(set_d).size());
+  ASSERT_EQ(size_t(1), graph.successors(scan_c).size());
+  ASSERT_EQ(size_t(0), graph.successors(reset_a).size());
+  ASSERT_EQ(size_t(0), graph.successors(sum).size());
+
+  for (int cycle = 0; cycle < 3; ++cycle) {
+    total = 0;
+    graph.execute();
+
+    for (INDEX_TYPE i = 0; i < N; ++i) {
+      ASSERT_EQ(a[i], INDEX_TYPE(-1));
+      ASSERT_EQ(b[i], INDEX_TYPE(2));
+      ASSERT_EQ(c[i], (i * (i + 1)) / 2 + 2 * (i + 1));
+      ASSERT_EQ(d[i], 3 * i);
+    }
+    ASSERT_EQ(total, ((N - 1) * N) / 2 + 2 * N + 3 * (N - 1));
+  }
+
+  graph.clear();
+  ASSERT_EQ(size_t(0), graph.size());
+  ASSERT_EQ(size_t(0), graph.num_dependences());
+  graph.execute();
+}
+
+template <typename INDEX_TYPE, typename TASKGRAPH_POLICY, typename EXEC_POLICY>
+void TaskGraphExplicitDependenceTestImpl()
+{
+  std::vector<INDEX_TYPE> a(1), b(1);
+  INDEX_TYPE* a_ptr = a.data();
+  INDEX_TYPE* b_ptr = b.data();
+
+  std::atomic<int> step(0);
+  std::atomic<int>* step_ptr = &step;
+
+  RAJA::TaskGraph<TASKGRAPH_POLICY> graph;
+
+  const size_t first = graph.task(RAJA::task_in(), RAJA::task_out(a), [=]() {
+    *a_ptr = static_cast<INDEX_TYPE>(step_ptr->fetch_add(1));
+  });
+  const size_t second = graph.task(RAJA::task_in(), RAJA::task_out(b), [=]() {
+    *b_ptr = static_cast<INDEX_TYPE>(step_ptr->fetch_add(1));
+  });
+
+  ASSERT_EQ(size_t(0), graph.num_dependences());
+  graph.add_dependence(first, second);
+  ASSERT_EQ(size_t(1), graph.num_dependences());
+
+  for (int cycle = 0; cycle < 3; ++cycle) {
+    step = 0;
+    graph.execute();
+    ASSERT_EQ(a[0], INDEX_TYPE(0));
+    ASSERT_EQ(b[0], INDEX_TYPE(1));
+  }
+}
+
+
+template <typename T>
+class TaskGraphUnitTest : public ::testing::Test
+{
+};
+
+TYPED_TEST_SUITE_P(TaskGraphUnitTest);
+
+TYPED_TEST_P(TaskGraphUnitTest, Dataflow)
+{
+  using INDEX_TYPE       = typename camp::at<TypeParam, camp::num<0>>::type;
+  using TASKGRAPH_POLICY = typename camp::at<TypeParam, camp::num<1>>::type;
+  using EXEC_POLICY      = typename camp::at<TypeParam, camp::num<2>>::type;
+
+  TaskGraphDataflowTestImpl<INDEX_TYPE, TASKGRAPH_POLICY, EXEC_POLICY>(
+      INDEX_TYPE(1));
+  TaskGraphDataflowTestImpl<INDEX_TYPE, TASKGRAPH_POLICY, EXEC_POLICY>(
+      INDEX_TYPE(57));
+}
+
+TYPED_TEST_P(TaskGraphUnitTest, ExplicitDependence)
+{
+  using INDEX_TYPE       = typename camp::at<TypeParam, camp::num<0>>::type;
+  using TASKGRAPH_POLICY = typename camp::at<TypeParam, camp::num<1>>::type;
+  using EXEC_POLICY      = typename camp::at<TypeParam, camp::num<2>>::type;
+
+  TaskGraphExplicitDependenceTestImpl<INDEX_TYPE,
+                                      TASKGRAPH_POLICY,
+                                      EXEC_POLICY>();
+}
+
+REGISTER_TYPED_TEST_SUITE_P(TaskGraphUnitTest,
+                            Dataflow,
+                            ExplicitDependence);
+
+#endif  // __TEST_UNIT_TASKGRAPH_HPP__
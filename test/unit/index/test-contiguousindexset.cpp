@@ -0,0 +1,107 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-20, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/COPYRIGHT file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+///
+/// Source file containing unit tests for ContiguousIndexSet class.
+///
+
+#include "RAJA_test-base.hpp"
+
+#include "camp/resource.hpp"
+
+#include <vector>
+
+//
+// Resource object used to construct list segment objects with indices
+// living in host (CPU) memory. Used in all tests.
+//
+camp::resources::Resource host_res{camp::resources::Host()};
+
+using CIndexSetType = RAJA::TypedContiguousIndexSet<int>;
+
+TEST(ContiguousIndexSetUnitTest, Empty)
+{
+  CIndexSetType is;
+  ASSERT_EQ(0, is.size());
+  ASSERT_EQ(size_t(0), is.getLength());
+  ASSERT_EQ(is.begin(), is.end());
+}
+
+TEST(ContiguousIndexSetUnitTest, PushBackAndClear)
+{
+  CIndexSetType is;
+  is.reserve(4, 8);
+
+  int idx[] = {20, 11, 15};
+  for (int cycle = 0; cycle < 2; ++cycle) {
+    is.clear();
+    is.push_back(RAJA::TypedRangeSegment<int>(0, 5));
+    is.push_back_list(idx, 3);
+    is.push_back(RAJA::TypedRangeStrideSegment<int>(5, 11, 2));
+    is.push_back(RAJA::TypedListSegment<int>(idx, 2, host_res));
+
+    ASSERT_EQ(4, is.size());
+    ASSERT_EQ(size_t(13), is.getLength());
+    ASSERT_EQ(size_t(5), is.getNumListIndices());
+    ASSERT_EQ(0, is.getStartingIcount(0));
+    ASSERT_EQ(5, is.getStartingIcount(1));
+    ASSERT_EQ(8, is.getStartingIcount(2));
+    ASSERT_EQ(11, is.getStartingIcount(3));
+    ASSERT_EQ(CIndexSetType::RANGE, is.getSegmentType(0));
+    ASSERT_EQ(CIndexSetType::LIST, is.getSegmentType(1));
+    ASSERT_EQ(CIndexSetType::RANGE_STRIDE, is.getSegmentType(2));
+    ASSERT_EQ(CIndexSetType::LIST, is.getSegmentType(3));
+  }
+}
+
+TEST(ContiguousIndexSetUnitTest, FromTypedIndexSet)
+{
+  using RangeSegType = RAJA::TypedRangeSegment<int>;
+  using ListSegType = RAJA::TypedListSegment<int>;
+
+  RAJA::TypedIndexSet<RangeSegType, ListSegType> iset;
+  int idx[] = {10, 8, 9};
+  iset.push_back(RangeSegType(0, 4));
+  iset.push_back(ListSegType(idx, 3, host_res));
+  iset.push_back(RangeSegType(4, 6));
+
+  CIndexSetType cis(iset);
+  ASSERT_EQ(3, cis.size());
+  ASSERT_EQ(iset.getLength(), cis.getLength());
+  for (int seg = 0; seg < 3; ++seg) {
+    ASSERT_EQ(iset.getStartingIcount(seg), cis.getStartingIcount(seg));
+  }
+}
+
+TEST(ContiguousIndexSetUnitTest, Forall)
+{
+  CIndexSetType is;
+  int idx[] = {20, 11, 15};
+  is.push_back(RAJA::TypedRangeSegment<int>(0, 5));
+  is.push_back_list(idx, 3);
+  is.push_back(RAJA::TypedRangeStrideSegment<int>(5, 11, 2));
+
+  std::vector<int> expected = {0, 1, 2, 3, 4, 20, 11, 15, 5, 7, 9};
+
+  std::vector<int> visited;
+  RAJA::forall<RAJA::ExecPolicy<RAJA::seq_segit, RAJA::seq_exec>>(
+      is, [&](int i) { visited.push_back(i); });
+  ASSERT_EQ(expected, visited);
+
+  std::vector<int> icounts;
+  visited.clear();
+  RAJA::forall_Icount<RAJA::ExecPolicy<RAJA::flatten_segit<RAJA::seq_exec, 4>,
+                                       RAJA::loop_exec>>(
+      is, [&](int icount, int i) {
+        icounts.push_back(icount);
+        visited.push_back(i);
+      });
+  ASSERT_EQ(expected, visited);
+  for (int i = 0; i < static_cast<int>(icounts.size()); ++i) {
+    ASSERT_EQ(i, icounts[i]);
+  }
+}
@@ -0,0 +1,159 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-20, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/COPYRIGHT file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+///
+/// Source file containing tests for the host scratch arena used by
+/// cpu_tile_mem local arrays
+///
+
+#include "RAJA_test-base.hpp"
+
+#include <cstdint>
+#include <vector>
+
+using RAJA::detail::ScratchArenaCPU;
+using RAJA::detail::ScratchArrayCPU;
+
+static void fillNested(int depth, size_t num, int& errors)
+{
+  if (depth == 0) {
+    return;
+  }
+
+  ScratchArrayCPU<double> array(num);
+  if (reinterpret_cast<std::uintptr_t>(array.data()) %
+          ScratchArenaCPU::alignment != 0) {
+    ++errors;
+  }
+  for (size_t i = 0; i < num; ++i) {
+    array.data()[i] = depth;
+  }
+
+  fillNested(depth - 1, 3 * num + 1, errors);
+
+  for (size_t i = 0; i < num; ++i) {
+    if (array.data()[i] != depth) {
+      ++errors;
+    }
+  }
+}
+
+TEST(ScratchArenaUnitTest, NestedAllocations)
+{
+  int errors = 0;
+  fillNested(6, 1000, errors);
+  ASSERT_EQ(errors, 0);
+
+  // reused without growing once sized
+  const size_t capacity = ScratchArenaCPU::get().capacity();
+  fillNested(6, 1000, errors);
+  ASSERT_EQ(errors, 0);
+  ASSERT_EQ(ScratchArenaCPU::get().capacity(), capacity);
+}
+
+TEST(ScratchArenaUnitTest, GrowAndReplaceBlocks)
+{
+  const size_t KB = 1024;
+  ScratchArenaCPU arena;
+
+  // the second allocation does not fit in the first block and adds one
+  char* a = static_cast<char*>(arena.allocate(60 * KB));
+  char* b = static_cast<char*>(arena.allocate(10 * KB));
+  ASSERT_EQ(arena.capacity(), 64 * KB + 128 * KB);
+  arena.deallocate(10 * KB);
+  (void)b;
+
+  // the empty second block is too small and is replaced
+  char* c = static_cast<char*>(arena.allocate(200 * KB));
+  ASSERT_EQ(arena.capacity(), 64 * KB + 200 * KB);
+  ASSERT_EQ(reinterpret_cast<std::uintptr_t>(c) % ScratchArenaCPU::alignment,
+            0u);
+  for (size_t i = 0; i < 60 * KB; ++i) {
+    a[i] = 1;
+  }
+  for (size_t i = 0; i < 200 * KB; ++i) {
+    c[i] = 2;
+  }
+  for (size_t i = 0; i < 60 * KB; ++i) {
+    ASSERT_EQ(a[i], 1);
+  }
+  arena.deallocate(200 * KB);
+  arena.deallocate(60 * KB);
+
+  // releasing keeps the blocks, the next allocation merges them
+  ASSERT_EQ(arena.capacity(), 64 * KB + 200 * KB);
+  char* d = static_cast<char*>(arena.allocate(250 * KB));
+  ASSERT_EQ(arena.capacity(), 64 * KB + 200 * KB);
+  d[250 * KB - 1] = 3;
+  arena.deallocate(250 * KB);
+}
+
+TEST(ScratchArenaUnitTest, LargeTileTranspose)
+{
+  // 256 x 256 doubles per tile, too large for worker thread stacks
+  constexpr int TILE = 256;
+  constexpr int N = 2 * TILE + 17;
+
+  using TILE_MEM = RAJA::LocalArray<double,
+                                    RAJA::Perm<0, 1>,
+                                    RAJA::SizeList<TILE, TILE>>;
+
+#if defined(RAJA_ENABLE_OPENMP)
+  using OUTER_EXEC = RAJA::omp_parallel_for_exec;
+#else
+  using OUTER_EXEC = RAJA::loop_exec;
+#endif
+
+  using POLICY = RAJA::KernelPolicy<
+    RAJA::statement::Tile<1, RAJA::tile_fixed<TILE>, OUTER_EXEC,
+      RAJA::statement::Tile<0, RAJA::tile_fixed<TILE>, RAJA::loop_exec,
+        RAJA::statement::InitLocalMem<
+          RAJA::cpu_tile_mem_checked<TILE * TILE * sizeof(double)>,
+          RAJA::ParamList<0>,
+          RAJA::statement::ForICount<1, RAJA::statement::Param<2>, RAJA::loop_exec,
+            RAJA::statement::ForICount<0, RAJA::statement::Param<1>, RAJA::loop_exec,
+              RAJA::statement::Lambda<0>
+            >
+          >,
+          RAJA::statement::ForICount<0, RAJA::statement::Param<1>, RAJA::loop_exec,
+            RAJA::statement::ForICount<1, RAJA::statement::Param<2>, RAJA::loop_exec,
+              RAJA::statement::Lambda<1>
+            >
+          >
+        >
+      >
+    >
+  >;
+
+  std::vector<double> in(N * N);
+  std::vector<double> out(N * N, -1.0);
+  for (int i = 0; i < N * N; ++i) {
+    in[i] = i;
+  }
+  double* in_ptr = in.data();
+  double* out_ptr = out.data();
+
+  TILE_MEM tile;
+
+  RAJA::kernel_param<POLICY>(
+    RAJA::make_tuple(RAJA::RangeSegment(0, N), RAJA::RangeSegment(0, N)),
+    RAJA::make_tuple(tile, (int)0, (int)0),
+
+    [=](int col, int row, TILE_MEM& t, int tx, int ty) {
+      t(ty, tx) = in_ptr[row * N + col];
+    },
+
+    [=](int col, int row, TILE_MEM& t, int tx, int ty) {
+      out_ptr[col * N + row] = t(ty, tx);
+    });
+
+  for (int r = 0; r < N; ++r) {
+    for (int c = 0; c < N; ++c) {
+      ASSERT_EQ(out[c * N + r], in[r * N + c]);
+    }
+  }
+}
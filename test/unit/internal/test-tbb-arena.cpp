@@ -0,0 +1,92 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-20, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/COPYRIGHT file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+///
+/// Source file containing tests for the TBB policies that run in a
+/// user-provided task_arena
+///
+
+#include "RAJA/RAJA.hpp"
+
+#include "RAJA_gtest.hpp"
+
+#include <atomic>
+#include <vector>
+
+#include <tbb/task_arena.h>
+
+// an arena size that differs from the default arena, so running in the
+// wrong arena is visible through max_concurrency
+static int arenaThreads()
+{
+  return tbb::this_task_arena::max_concurrency() == 2 ? 3 : 2;
+}
+
+template <typename ArenaPolicy>
+void testForallInArena()
+{
+  const int threads = arenaThreads();
+  tbb::task_arena arena(threads);
+
+  const int N = 10000;
+  std::vector<int> concurrency(N, 0);
+  std::vector<int> thread_index(N, -1);
+  int* concurrency_ptr = concurrency.data();
+  int* thread_index_ptr = thread_index.data();
+
+  RAJA::forall(ArenaPolicy(arena), RAJA::RangeSegment(0, N), [=](int i) {
+    concurrency_ptr[i] = tbb::this_task_arena::max_concurrency();
+    thread_index_ptr[i] = tbb::this_task_arena::current_thread_index();
+  });
+
+  for (int i = 0; i < N; ++i) {
+    ASSERT_EQ(concurrency[i], threads);
+    ASSERT_GE(thread_index[i], 0);
+    ASSERT_LT(thread_index[i], threads);
+  }
+}
+
+TEST(TBBArenaUnitTest, ForallStatic)
+{
+  testForallInArena<RAJA::tbb_arena_for_exec>();
+  testForallInArena<RAJA::tbb_arena_for_static<8>>();
+}
+
+TEST(TBBArenaUnitTest, ForallDynamic)
+{
+  testForallInArena<RAJA::tbb_arena_for_dynamic>();
+}
+
+TEST(TBBArenaUnitTest, Sort)
+{
+  const int threads = arenaThreads();
+  tbb::task_arena arena(threads);
+
+  const int N = 100000;
+  std::vector<int> values(N);
+  for (int i = 0; i < N; ++i) {
+    values[i] = (static_cast<long>(i) * 7919) % N;
+  }
+
+  std::atomic<int> outside(0);
+  auto comp = [&](int a, int b) {
+    if (tbb::this_task_arena::max_concurrency() != threads) {
+      ++outside;
+    }
+    return a < b;
+  };
+
+  RAJA::sort(RAJA::tbb_arena_for_exec(arena),
+             values.begin(),
+             values.end(),
+             comp);
+
+  ASSERT_EQ(outside.load(), 0);
+  for (int i = 0; i < N; ++i) {
+    ASSERT_EQ(values[i], i);
+  }
+}
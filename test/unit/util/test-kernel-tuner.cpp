@@ -0,0 +1,103 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-20, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/COPYRIGHT file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+///
+/// Source file containing unit tests for KernelTuner and KernelTuningTable
+///
+
+#include "RAJA_test-base.hpp"
+
+#include "RAJA/util/KernelTuner.hpp"
+
+#include <sstream>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+using TunerFamily2D = RAJA::kernel_policy_family<RAJA::loop_exec,
+                                                 RAJA::loop_exec,
+                                                 RAJA::loop_orders_t<2>,
+                                                 camp::idx_seq<4, 16>>;
+
+using TunerFamily3D = RAJA::kernel_policy_family<RAJA::loop_exec,
+                                                 RAJA::seq_exec,
+                                                 RAJA::loop_orders_t<3>,
+                                                 camp::idx_seq<8>>;
+
+TEST(KernelTunerUnitTest, Family)
+{
+  ASSERT_EQ(RAJA::KernelTuner<TunerFamily2D::type>::num_policies, 6u);
+  ASSERT_EQ(RAJA::KernelTuner<TunerFamily3D::type>::num_policies, 12u);
+
+  std::vector<std::string> names = TunerFamily2D::names();
+  ASSERT_EQ(names.size(), 6u);
+  ASSERT_EQ(names[0], "order (0,1)");
+  ASSERT_EQ(names[5], "order (1,0) tile 16");
+
+  using expected = RAJA::KernelPolicy<
+      RAJA::statement::Tile<1, RAJA::tile_fixed<4>, RAJA::loop_exec,
+        RAJA::statement::Tile<0, RAJA::tile_fixed<4>, RAJA::seq_exec,
+          RAJA::statement::For<1, RAJA::seq_exec,
+            RAJA::statement::For<0, RAJA::seq_exec,
+              RAJA::statement::Lambda<0>>>>>>;
+  bool same = std::is_same<
+      RAJA::tiled_loop_order_policy<4, RAJA::loop_exec, RAJA::seq_exec, 1, 0>,
+      expected>::value;
+  ASSERT_TRUE(same);
+}
+
+TEST(KernelTunerUnitTest, RunAndTime)
+{
+  using tuner = RAJA::KernelTuner<TunerFamily2D::type>;
+
+  const int N = 37;
+  std::vector<int> A(N * N);
+  int* a = A.data();
+  auto segments = RAJA::make_tuple(RAJA::RangeSegment(0, N),
+                                   RAJA::RangeSegment(0, N));
+
+  for (size_t p = 0; p < tuner::num_policies; ++p) {
+    std::fill(A.begin(), A.end(), 0);
+    tuner::run(p, segments, [=](int i, int j) { a[i + N * j] += i + 100 * j; });
+    for (int j = 0; j < N; ++j) {
+      for (int i = 0; i < N; ++i) {
+        ASSERT_EQ(A[i + N * j], i + 100 * j);
+      }
+    }
+  }
+
+  std::vector<double> times =
+      tuner::time(segments, [=](int i, int j) { a[i + N * j] += 1; }, 2);
+  ASSERT_EQ(times.size(), tuner::num_policies);
+  for (double t : times) {
+    ASSERT_GE(t, 0.0);
+  }
+}
+
+TEST(KernelTunerUnitTest, Table)
+{
+  RAJA::KernelTuningTable table(TunerFamily2D::names());
+  table.add(1000, {3.0, 2.0, 1.0, 4.0, 5.0, 6.0});
+  table.add(10, {1.0, 2.0, 3.0, 4.0, 5.0, 6.0});
+  table.add(100, {3.0, 2.0, 3.0, 4.0, 0.5, 6.0});
+
+  ASSERT_EQ(table.num_sizes(), 3u);
+  ASSERT_EQ(table.best(1), 0u);
+  ASSERT_EQ(table.best(10), 0u);
+  ASSERT_EQ(table.best(11), 4u);
+  ASSERT_EQ(table.best(500), 2u);
+  ASSERT_EQ(table.best(100000), 2u);
+
+  std::ostringstream header;
+  table.write_header(header, "transpose");
+  std::string text = header.str();
+  ASSERT_NE(text.find("#ifndef TRANSPOSE_TUNING_HPP"), std::string::npos);
+  ASSERT_NE(text.find("namespace transpose_tuning"), std::string::npos);
+  ASSERT_NE(text.find("size_bounds[] = {10, 100, 1000};"), std::string::npos);
+  ASSERT_NE(text.find("best_policy[] = {0, 4, 2};"), std::string::npos);
+  ASSERT_NE(text.find("order (1,0) tile 4"), std::string::npos);
+}
@@ -0,0 +1,144 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-20, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/COPYRIGHT file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#include "RAJA_test-base.hpp"
+
+#include <cmath>
+#include <limits>
+#include <vector>
+
+TEST(ConvertingViewUnitTest, HalfConversion)
+{
+  // exactly representable values round trip
+  const float exact[] = {0.0f, 1.0f, -2.5f, 0.099975586f, 65504.0f,
+                         6.1035156e-05f, 5.9604645e-08f};
+  for (float f : exact) {
+    ASSERT_EQ(f, static_cast<float>(RAJA::half(f)));
+  }
+
+  ASSERT_EQ(0x3c00, RAJA::half(1.0f).bits);
+  ASSERT_EQ(0xc000, RAJA::half(-2.0f).bits);
+
+  // round to nearest even, 1 + 2^-11 is halfway between 1 and 1 + 2^-10
+  ASSERT_EQ(0x3c00, RAJA::half(1.0f + std::ldexp(1.0f, -11)).bits);
+  ASSERT_EQ(0x3c02, RAJA::half(1.0f + 3.0f * std::ldexp(1.0f, -11)).bits);
+
+  // overflow, infinity and NaN
+  ASSERT_EQ(0x7c00, RAJA::half(1.0e6f).bits);
+  ASSERT_EQ(0xfc00,
+            RAJA::half(-std::numeric_limits<float>::infinity()).bits);
+  ASSERT_TRUE(std::isnan(static_cast<float>(
+      RAJA::half(std::numeric_limits<float>::quiet_NaN()))));
+}
+
+TEST(ConvertingViewUnitTest, BFloat16Conversion)
+{
+  ASSERT_EQ(0x3f80, RAJA::bfloat16(1.0f).bits);
+  ASSERT_EQ(1.0f, static_cast<float>(RAJA::bfloat16(1.0f)));
+  ASSERT_EQ(-3.0f, static_cast<float>(RAJA::bfloat16(-3.0f)));
+
+  // round to nearest even on the dropped 16 bits
+  ASSERT_EQ(0x3f80, RAJA::bfloat16(1.0f + std::ldexp(1.0f, -8)).bits);
+  ASSERT_EQ(0x3f82, RAJA::bfloat16(1.0f + 3.0f * std::ldexp(1.0f, -8)).bits);
+
+  ASSERT_TRUE(std::isnan(static_cast<float>(
+      RAJA::bfloat16(std::numeric_limits<float>::quiet_NaN()))));
+}
+
+TEST(ConvertingViewUnitTest, HalfStorageDoubleCompute)
+{
+  constexpr int N = 4;
+  constexpr int M = 5;
+  std::vector<RAJA::half> storage(N * M);
+
+  RAJA::View<RAJA::half, RAJA::Layout<2>> h_view(storage.data(), N, M);
+  auto view = RAJA::make_converting_view<double>(h_view);
+
+  for (int i = 0; i < N; ++i) {
+    for (int j = 0; j < M; ++j) {
+      view(i, j) = 0.25 * (i * M + j);
+    }
+  }
+
+  for (int i = 0; i < N; ++i) {
+    for (int j = 0; j < M; ++j) {
+      double val = view(i, j);
+      ASSERT_EQ(0.25 * (i * M + j), val);
+    }
+  }
+
+  view(1, 1) += 1.0;
+  view(1, 2) -= 1.0;
+  view(1, 3) *= 2.0;
+  view(1, 4) /= 2.0;
+  view(0, 0) = view(3, 4);
+
+  ASSERT_EQ(0.25 * 6 + 1.0, static_cast<double>(view(1, 1)));
+  ASSERT_EQ(0.25 * 7 - 1.0, static_cast<double>(view(1, 2)));
+  ASSERT_EQ(0.25 * 8 * 2.0, static_cast<double>(view(1, 3)));
+  ASSERT_EQ(0.25 * 9 / 2.0, static_cast<double>(view(1, 4)));
+  ASSERT_EQ(0.25 * 19, static_cast<double>(view(0, 0)));
+
+  // read only storage returns values
+  RAJA::View<const RAJA::half, RAJA::Layout<2>> ch_view(storage.data(), N, M);
+  auto cview = RAJA::make_converting_view<double>(ch_view);
+  double cval = cview(2, 3);
+  ASSERT_EQ(0.25 * 13, cval);
+}
+
+TEST(ConvertingViewUnitTest, FloatStorageSimdForall)
+{
+  constexpr int N = 37;
+  std::vector<float> storage(N);
+  std::vector<double> result(N);
+
+  RAJA::ConvertingView<double, float, RAJA::Layout<1>> view(
+      RAJA::View<float, RAJA::Layout<1>>(storage.data(), N));
+  double* res = result.data();
+
+  RAJA::forall<RAJA::simd_exec>(RAJA::RangeSegment(0, N), [=](int i) {
+    view(i) = 1.5 * i;
+  });
+
+  RAJA::forall<RAJA::simd_exec>(RAJA::RangeSegment(0, N), [=](int i) {
+    res[i] = 2.0 * view(i);
+  });
+
+  for (int i = 0; i < N; ++i) {
+    ASSERT_EQ(1.5f * i, storage[i]);
+    ASSERT_EQ(3.0 * i, result[i]);
+  }
+}
+
+template <typename ExecPolicy, typename StorageType>
+void testConvertLoadStore()
+{
+  constexpr int N = 29;
+  std::vector<double> src(N);
+  std::vector<StorageType> storage(N);
+  std::vector<double> dst(N);
+
+  for (int i = 0; i < N; ++i) {
+    src[i] = 0.5 * i - 4.0;
+  }
+
+  RAJA::convert_store<ExecPolicy>(src.data(), storage.data(), N);
+  RAJA::convert_load<ExecPolicy>(storage.data(), dst.data(), N);
+
+  for (int i = 0; i < N; ++i) {
+    ASSERT_EQ(src[i], dst[i]);
+  }
+}
+
+TEST(ConvertingViewUnitTest, ConvertLoadStore)
+{
+  testConvertLoadStore<RAJA::seq_exec, RAJA::half>();
+  testConvertLoadStore<RAJA::simd_exec, RAJA::half>();
+  testConvertLoadStore<RAJA::seq_exec, RAJA::bfloat16>();
+  testConvertLoadStore<RAJA::simd_exec, RAJA::bfloat16>();
+  testConvertLoadStore<RAJA::simd_exec, float>();
+}
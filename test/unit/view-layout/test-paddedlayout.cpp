@@ -0,0 +1,187 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-20, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/COPYRIGHT file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#include "RAJA_test-base.hpp"
+
+#include <cstdint>
+#include <vector>
+
+TEST(PaddedLayoutUnitTest, 2D_ExplicitPadding)
+{
+  /*
+   * 3x4 layout with J stride-1, padded by 2 in J:
+   *
+   * I is stride 6
+   * J is stride 1
+   */
+  const auto layout =
+      RAJA::make_padded_layout({{3, 4}},
+                               {{0, 2}},
+                               RAJA::as_array<RAJA::PERM_IJ>::get());
+
+  ASSERT_EQ(3, layout.sizes[0]);
+  ASSERT_EQ(4, layout.sizes[1]);
+  ASSERT_EQ(6, layout.strides[0]);
+  ASSERT_EQ(1, layout.strides[1]);
+  ASSERT_EQ(12, layout.size());
+  ASSERT_EQ(16, RAJA::layout_storage_size(layout));
+
+  ASSERT_EQ(0, layout(0, 0));
+  ASSERT_EQ(3, layout(0, 3));
+  ASSERT_EQ(6, layout(1, 0));
+  ASSERT_EQ(15, layout(2, 3));
+
+  // toIndices must invert the padded mapping
+  for (int i = 0; i < 3; ++i) {
+    for (int j = 0; j < 4; ++j) {
+      int ii, jj;
+      layout.toIndices(layout(i, j), ii, jj);
+      ASSERT_EQ(i, ii);
+      ASSERT_EQ(j, jj);
+    }
+  }
+}
+
+TEST(PaddedLayoutUnitTest, 2D_PermutedPadding)
+{
+  /*
+   * 3x4 layout with I stride-1, padded by 1 in I:
+   *
+   * I is stride 1
+   * J is stride 4
+   */
+  const auto layout =
+      RAJA::make_padded_layout({{3, 4}},
+                               {{1, 0}},
+                               RAJA::as_array<RAJA::PERM_JI>::get());
+
+  ASSERT_EQ(1, layout.strides[0]);
+  ASSERT_EQ(4, layout.strides[1]);
+  ASSERT_EQ(15, RAJA::layout_storage_size(layout));
+
+  for (int i = 0; i < 3; ++i) {
+    for (int j = 0; j < 4; ++j) {
+      int ii, jj;
+      layout.toIndices(layout(i, j), ii, jj);
+      ASSERT_EQ(i, ii);
+      ASSERT_EQ(j, jj);
+    }
+  }
+}
+
+TEST(PaddedLayoutUnitTest, 3D_AlignedPowerOfTwo)
+{
+  /*
+   * 256x256x64 doubles: rows are 512 bytes, planes would be 128KB.
+   * The middle extent must be padded so the plane stride is no longer
+   * a multiple of 4K, rows stay dense since they are already aligned.
+   */
+  const auto layout =
+      RAJA::make_aligned_layout<double>({{256, 256, 64}},
+                                        RAJA::as_array<RAJA::PERM_IJK>::get(),
+                                        64,
+                                        4096);
+
+  ASSERT_EQ(1, layout.strides[2]);
+  ASSERT_EQ(64, layout.strides[1]);
+  ASSERT_EQ(257 * 64, layout.strides[0]);
+
+  for (int d = 0; d < 2; ++d) {
+    ASSERT_EQ(0u, (layout.strides[d] * sizeof(double)) % 64);
+    ASSERT_NE(0u, (layout.strides[d] * sizeof(double)) % 4096);
+  }
+}
+
+TEST(PaddedLayoutUnitTest, 2D_AlignedRows)
+{
+  /*
+   * 10x512 floats with I stride-1: rows of 10 floats are padded to 16 to
+   * reach 64 byte alignment, the 512 extent is the outermost and not padded.
+   */
+  const auto layout =
+      RAJA::make_aligned_layout<float>({{10, 512}},
+                                       RAJA::as_array<RAJA::PERM_JI>::get(),
+                                       64,
+                                       4096);
+
+  ASSERT_EQ(1, layout.strides[0]);
+  ASSERT_EQ(16, layout.strides[1]);
+  ASSERT_EQ(511 * 16 + 10, RAJA::layout_storage_size(layout));
+
+  /*
+   * 512x1024 floats with J stride-1: rows are exactly 4K and must be grown
+   * by one alignment unit.
+   */
+  const auto wide =
+      RAJA::make_aligned_layout<float>({{512, 1024}},
+                                       RAJA::as_array<RAJA::PERM_IJ>::get(),
+                                       64,
+                                       4096);
+
+  ASSERT_EQ(1024 + 16, wide.strides[0]);
+  ASSERT_EQ(1, wide.strides[1]);
+}
+
+TEST(PaddedLayoutUnitTest, 2D_AlignedOffset)
+{
+  const auto layout =
+      RAJA::make_aligned_offset_layout<double>(
+          {{-1, -1}},
+          {{254, 254}},
+          RAJA::as_array<RAJA::PERM_IJ>::get(),
+          64,
+          4096);
+
+  // 256 doubles per row is 2K, only the row alignment applies
+  ASSERT_EQ(0, layout(-1, -1));
+  ASSERT_EQ(1, layout(-1, 0));
+  ASSERT_EQ(256, layout(0, -1));
+  ASSERT_EQ(256 * 256, RAJA::layout_storage_size(layout));
+
+  const auto padded =
+      RAJA::make_padded_offset_layout<2>(
+          {{-1, -1}},
+          {{1, 1}},
+          {{0, 5}},
+          RAJA::as_array<RAJA::PERM_IJ>::get());
+
+  ASSERT_EQ(0, padded(-1, -1));
+  ASSERT_EQ(8, padded(0, -1));
+  ASSERT_EQ(19, RAJA::layout_storage_size(padded));
+}
+
+TEST(PaddedLayoutUnitTest, AlignedView)
+{
+  const auto layout =
+      RAJA::make_aligned_layout<double>({{7, 13}},
+                                        RAJA::as_array<RAJA::PERM_IJ>::get());
+
+  auto view = RAJA::make_aligned_view<double>(layout);
+
+  ASSERT_NE(nullptr, view.get_data());
+  ASSERT_EQ(0u,
+            reinterpret_cast<std::uintptr_t>(view.get_data()) %
+                RAJA::DATA_ALIGN);
+
+  for (int i = 0; i < 7; ++i) {
+    ASSERT_EQ(0u,
+              reinterpret_cast<std::uintptr_t>(&view(i, 0)) %
+                  RAJA::DATA_ALIGN);
+    for (int j = 0; j < 13; ++j) {
+      view(i, j) = i * 13 + j;
+    }
+  }
+
+  for (int i = 0; i < 7; ++i) {
+    for (int j = 0; j < 13; ++j) {
+      ASSERT_EQ(double(i * 13 + j), view(i, j));
+    }
+  }
+
+  RAJA::free_aligned_view(view);
+  ASSERT_EQ(nullptr, view.get_data());
+}